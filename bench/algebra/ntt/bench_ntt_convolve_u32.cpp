@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+constexpr arith_u32 MODULUS       = 998244353;  // 119 * 2^23 + 1.
+constexpr unsigned MAX_LOG_LENGTH = 23;
+
+static std::vector<arith_u32> a;
+static std::vector<arith_u32> b;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, MODULUS - 1);
+
+    a.resize(N);
+    b.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        a[i] = dist(rng);
+        b[i] = dist(rng);
+    }
+}
+
+static void bench_ntt_forward_u32(benchmark::State& state) {
+    const unsigned log_length = (unsigned)state.range(0);
+    const size_t N            = (size_t)1 << log_length;
+
+    arith_ntt_u32 ntt;
+    arith_ntt_init_u32(&ntt, MODULUS, MAX_LOG_LENGTH);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_ntt_forward_u32(&ntt, a.data(), log_length);
+        benchmark::DoNotOptimize(a.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_ntt_free_u32(&ntt);
+}
+
+static void bench_ntt_convolve_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    arith_ntt_u32 ntt;
+    arith_ntt_init_u32(&ntt, MODULUS, MAX_LOG_LENGTH);
+
+    generate_inputs(N);
+    std::vector<arith_u32> product(2 * N - 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_ntt_convolve_u32(&ntt, a.data(), N, b.data(), N, product.data()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_ntt_free_u32(&ntt);
+}
+
+
+BENCHMARK(bench_ntt_forward_u32)->Arg(10)->Arg(20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bench_ntt_convolve_u32)->Arg(1000)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+
+BENCHMARK_MAIN();
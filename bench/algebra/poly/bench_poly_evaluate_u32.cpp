@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/algebra/poly.h"
+#include "arithmos/core/types.h"
+
+
+
+constexpr arith_u32 MODULUS       = 998244353;  // 119 * 2^23 + 1.
+constexpr unsigned MAX_LOG_LENGTH = 23;
+
+static std::vector<arith_u32> coefficients;
+static std::vector<arith_u32> points;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, MODULUS - 1);
+
+    coefficients.resize(N);
+    points.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        coefficients[i] = dist(rng);
+        points[i]       = dist(rng);
+    }
+}
+
+static void bench_poly_divrem_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    arith_ntt_u32 ntt;
+    arith_ntt_init_u32(&ntt, MODULUS, MAX_LOG_LENGTH);
+
+    generate_inputs(N);
+
+    arith_poly_u32 a, b, quotient, remainder;
+    arith_poly_init_u32(&a);
+    arith_poly_init_u32(&b);
+    arith_poly_init_u32(&quotient);
+    arith_poly_init_u32(&remainder);
+    arith_poly_set_u32(&ntt, &a, coefficients.data(), N);
+    arith_poly_set_u32(&ntt, &b, points.data(), N / 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_poly_divrem_u32(&ntt, &a, &b, &quotient, &remainder));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_poly_free_u32(&a);
+    arith_poly_free_u32(&b);
+    arith_poly_free_u32(&quotient);
+    arith_poly_free_u32(&remainder);
+    arith_ntt_free_u32(&ntt);
+}
+
+static void bench_poly_evaluate_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    arith_ntt_u32 ntt;
+    arith_ntt_init_u32(&ntt, MODULUS, MAX_LOG_LENGTH);
+
+    generate_inputs(N);
+
+    arith_poly_u32 poly;
+    arith_poly_init_u32(&poly);
+    arith_poly_set_u32(&ntt, &poly, coefficients.data(), N);
+    std::vector<arith_u32> values(N);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_poly_evaluate_u32(&ntt, &poly, points.data(), N, values.data()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_poly_free_u32(&poly);
+    arith_ntt_free_u32(&ntt);
+}
+
+
+BENCHMARK(bench_poly_divrem_u32)->Arg(1000)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_poly_evaluate_u32)->Arg(1000)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/algebra/poly.h"
+#include "arithmos/core/types.h"
+
+
+
+constexpr arith_u32 MODULUS       = 998244353;  // 119 * 2^23 + 1.
+constexpr unsigned MAX_LOG_LENGTH = 23;
+
+static std::vector<arith_u32> coefficients;
+
+// Generates a series with constant coefficient `constant`, which has an inverse, logarithm, exponential or square root
+// depending on its value.
+static void generate_inputs(size_t N, arith_u32 constant) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, MODULUS - 1);
+
+    coefficients.resize(N);
+
+    for (size_t i = 0; i < N; ++i)
+        coefficients[i] = dist(rng);
+    coefficients[0] = constant;
+}
+
+using series_function = bool (*)(const arith_ntt_u32*, const arith_poly_u32*, size_t, arith_poly_u32*);
+
+static void bench_series(benchmark::State& state, series_function series, arith_u32 constant) {
+    const size_t N = (size_t)state.range(0);
+
+    arith_ntt_u32 ntt;
+    arith_ntt_init_u32(&ntt, MODULUS, MAX_LOG_LENGTH);
+
+    generate_inputs(N, constant);
+
+    arith_poly_u32 a, out;
+    arith_poly_init_u32(&a);
+    arith_poly_init_u32(&out);
+    arith_poly_set_u32(&ntt, &a, coefficients.data(), N);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(series(&ntt, &a, N, &out));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_poly_free_u32(&a);
+    arith_poly_free_u32(&out);
+    arith_ntt_free_u32(&ntt);
+}
+
+static void bench_poly_inverse_series_u32(benchmark::State& state) {
+    bench_series(state, arith_poly_inverse_series_u32, 1);
+}
+
+static void bench_poly_log_series_u32(benchmark::State& state) {
+    bench_series(state, arith_poly_log_series_u32, 1);
+}
+
+static void bench_poly_exp_series_u32(benchmark::State& state) {
+    bench_series(state, arith_poly_exp_series_u32, 0);
+}
+
+static void bench_poly_sqrt_series_u32(benchmark::State& state) {
+    bench_series(state, arith_poly_sqrt_series_u32, 4);
+}
+
+
+BENCHMARK(bench_poly_inverse_series_u32)->Arg(1000)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_poly_log_series_u32)->Arg(1000)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_poly_exp_series_u32)->Arg(1000)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_poly_sqrt_series_u32)->Arg(1000)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/barrett.h"
+#include "arithmos/numeric/multiply.h"
+
+
+
+// The workload is a modular dot product with a fixed, even modulus, which rules out Montgomery arithmetic.
+static std::vector<arith_u32> multipliers;
+static std::vector<arith_u32> multiplicands;
+static arith_u32 modulus;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, ARITH_U32_MAX);
+
+    multipliers.resize(N);
+    multiplicands.resize(N);
+
+    modulus = (dist(rng) | 2) & ~(arith_u32)1;
+
+    for (size_t i = 0; i < N; ++i) {
+        multipliers[i]   = dist(rng) % modulus;
+        multiplicands[i] = dist(rng) % modulus;
+    }
+}
+
+static void bench_mod_mul_u32(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_u32 sum = 0;
+        for (size_t i = 0; i < N; ++i) {
+            const arith_u32 product = arith_mod_mul_u32(multipliers[i], multiplicands[i], modulus);
+            sum                    = (sum >= modulus - product) ? sum - (modulus - product) : sum + product;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_barrett_mod_mul_u32(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N);
+
+    arith_barrett_u32 barrett;
+    arith_barrett_init_u32(&barrett, modulus);
+
+    for (auto _ : state) {
+        arith_u32 sum = 0;
+        for (size_t i = 0; i < N; ++i) {
+            const arith_u32 product = arith_barrett_mod_mul_u32(&barrett, multipliers[i], multiplicands[i]);
+            sum                    = arith_barrett_mod_add_u32(&barrett, sum, product);
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_mod_mul_u32);
+BENCHMARK(bench_barrett_mod_mul_u32);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/bigint.h"
+
+
+
+constexpr unsigned MAX_LOG_LENGTH = 20;
+
+static std::vector<arith_u64> limbs;
+static std::vector<arith_u64> memory;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist;
+
+    limbs.resize(2 * N);
+
+    for (size_t i = 0; i < 2 * N; ++i)
+        limbs[i] = dist(rng) | 1;
+}
+
+// Multiplies two integers of `N` limbs each, with NTTs for the long ones if `ntt` is not `nullptr`.
+static void bench_mul(benchmark::State& state, const arith_bigint_ntt* ntt) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+    memory.resize(2 * N + 16 * N);
+
+    arith_bigint a = {limbs.data(), N, N};
+    arith_bigint b = {limbs.data() + N, N, N};
+    arith_bigint out;
+    arith_bigint_init(&out);
+
+    arith_bigint_arena arena;
+    arith_bigint_arena_init(&arena, memory.data(), memory.size());
+
+    for (auto _ : state) {
+        arith_bigint_arena_reset(&arena);
+        arith_bigint_init(&out);
+        benchmark::DoNotOptimize(arith_bigint_mul(ntt, &arena, &a, &b, &out));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_bigint_mul(benchmark::State& state) {
+    arith_bigint_ntt ntt;
+    arith_bigint_ntt_init(&ntt, MAX_LOG_LENGTH);
+
+    bench_mul(state, &ntt);
+
+    arith_bigint_ntt_free(&ntt);
+}
+
+static void bench_bigint_mul_no_ntt(benchmark::State& state) {
+    bench_mul(state, nullptr);
+}
+
+static void bench_bigint_power_u64(benchmark::State& state) {
+    const arith_u64 exponent = (arith_u64)state.range(0);
+
+    arith_bigint_ntt ntt;
+    arith_bigint_ntt_init(&ntt, MAX_LOG_LENGTH);
+
+    // `3^exponent` has about `exponent / 40` limbs.
+    memory.resize(exponent);
+
+    arith_bigint_arena arena;
+    arith_bigint_arena_init(&arena, memory.data(), memory.size());
+
+    arith_bigint out;
+
+    for (auto _ : state) {
+        arith_bigint_arena_reset(&arena);
+        arith_bigint_init(&out);
+        benchmark::DoNotOptimize(arith_bigint_power_u64(&ntt, &arena, 3, exponent, &out));
+        benchmark::ClobberMemory();
+    }
+
+    arith_bigint_ntt_free(&ntt);
+}
+
+
+BENCHMARK(bench_bigint_mul)->Arg(16)->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_bigint_mul_no_ntt)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_bigint_power_u64)->Arg(100000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+
+BENCHMARK_MAIN();
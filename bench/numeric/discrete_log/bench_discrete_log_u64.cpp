@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/discrete_log.h"
+#include "arithmos/numeric/power.h"
+
+
+
+// Primes whose `p - 1` has largest prime factor about `2^16`, `2^32` and `2^38`, with a generator of each. The last
+// one takes a baby-step table of 4 MiB.
+static const arith_u64 primes[]     = {0xffffffff00000001, 4294967291, 0x800001800e00002b};
+static const arith_u64 generators[] = {7, 3, 2};
+
+static std::vector<arith_u64> hs;
+static std::vector<arith_u64> xs;
+
+static void generate_inputs(size_t N, const arith_u64 g, const arith_u64 p) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, p - 2);
+
+    hs.resize(N);
+    xs.resize(N);
+
+    for (size_t i = 0; i < N; ++i)
+        hs[i] = arith_power_mod_u64(g, dist(rng), p);
+}
+
+static void bench_log_base_discrete_log_u64(benchmark::State& state) {
+    const size_t N    = (size_t)state.range(0);
+    const arith_u64 g = generators[state.range(1)];
+    const arith_u64 p = primes[state.range(1)];
+
+    generate_inputs(N, g, p);
+
+    arith_log_base_u64 base;
+    arith_log_base_init_u64(&base, g, p);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            arith_log_base_discrete_log_u64(&base, hs[i], &xs[i]);
+
+        benchmark::DoNotOptimize(xs.data());
+        benchmark::ClobberMemory();
+    }
+
+    arith_log_base_free_u64(&base);
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_discrete_log_u64(benchmark::State& state) {
+    const size_t N    = (size_t)state.range(0);
+    const arith_u64 g = generators[state.range(1)];
+    const arith_u64 p = primes[state.range(1)];
+
+    generate_inputs(N, g, p);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            arith_discrete_log_u64(g, hs[i], p, &xs[i]);
+
+        benchmark::DoNotOptimize(xs.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_log_base_discrete_log_u64)->ArgsProduct({{100}, {0, 1, 2}});
+BENCHMARK(bench_discrete_log_u64)->ArgsProduct({{10}, {0, 1}});
+
+BENCHMARK_MAIN();
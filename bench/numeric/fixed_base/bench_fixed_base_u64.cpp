@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/fixed_base.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/power.h"
+
+
+
+constexpr arith_u64 BASE    = 3;
+constexpr arith_u64 MODULUS = 18446744073709551557ULL;  // The largest prime below 2^64.
+
+static std::vector<arith_u64> exponents;
+static std::vector<arith_u64> results;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+
+    exponents.resize(N);
+    results.resize(N);
+
+    for (size_t i = 0; i < N; ++i)
+        exponents[i] = dist(rng);
+}
+
+static void bench_power_mod_u64(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            results[i] = arith_power_mod_u64(BASE, exponents[i], MODULUS);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_montgomery_power_mod_u64(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N);
+
+    arith_montgomery_u64 montgomery;
+    arith_montgomery_init_u64(&montgomery, MODULUS);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            results[i] = arith_montgomery_power_mod_u64(&montgomery, BASE, exponents[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+// Exponentiations with digits of `state.range(0)` bits.
+static void bench_fixed_base_power_u64(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N);
+
+    arith_fixed_base_u64 fixed_base;
+    arith_fixed_base_init_u64(&fixed_base, BASE, MODULUS, (unsigned)state.range(0));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            results[i] = arith_fixed_base_power_u64(&fixed_base, exponents[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_fixed_base_free_u64(&fixed_base);
+}
+
+static void bench_fixed_base_power_u64_batch(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N);
+
+    arith_fixed_base_u64 fixed_base;
+    arith_fixed_base_init_u64(&fixed_base, BASE, MODULUS, (unsigned)state.range(0));
+
+    for (auto _ : state) {
+        arith_fixed_base_power_u64_batch(&fixed_base, exponents.data(), results.data(), N);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+    arith_fixed_base_free_u64(&fixed_base);
+}
+
+// Filling the table, which has to be amortized over the exponentiations.
+static void bench_fixed_base_init_u64(benchmark::State& state) {
+    arith_fixed_base_u64 fixed_base;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_fixed_base_init_u64(&fixed_base, BASE, MODULUS, (unsigned)state.range(0)));
+        arith_fixed_base_free_u64(&fixed_base);
+    }
+}
+
+
+BENCHMARK(bench_power_mod_u64);
+BENCHMARK(bench_montgomery_power_mod_u64);
+BENCHMARK(bench_fixed_base_power_u64)->Arg(4)->Arg(8)->Arg(11)->Arg(16);
+BENCHMARK(bench_fixed_base_power_u64_batch)->Arg(4)->Arg(8)->Arg(11)->Arg(16);
+BENCHMARK(bench_fixed_base_init_u64)->Arg(4)->Arg(8)->Arg(11)->Arg(16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+
+
+
+static std::vector<arith_u64> values;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    // A common factor keeps the gcd from reaching 1, so that all values are processed.
+    std::uniform_int_distribution<arith_u64> dist(1, (arith_u64)1 << 40);
+    const arith_u64 factor = 0x123457;
+
+    values.resize(N);
+
+    for (size_t i = 0; i < N; ++i)
+        values[i] = factor * dist(rng);
+}
+
+static void bench_gcd_u64_fold(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_u64 gcd = 0;
+        for (size_t i = 0; i < N; ++i)
+            gcd = arith_gcd_u64(gcd, values[i]);
+
+        benchmark::DoNotOptimize(gcd);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_gcd_u64_array(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        const arith_u64 gcd = arith_gcd_u64_array(values.data(), N);
+
+        benchmark::DoNotOptimize(gcd);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_gcd_u64_fold)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_gcd_u64_array)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
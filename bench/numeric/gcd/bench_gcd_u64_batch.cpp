@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+
+
+
+static std::vector<arith_u64> ms;
+static std::vector<arith_u64> ns;
+static std::vector<arith_u64> gcds;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+
+    ms.resize(N);
+    ns.resize(N);
+    gcds.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        ms[i] = dist(rng);
+        ns[i] = dist(rng);
+    }
+}
+
+static void bench_gcd_u64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            gcds[i] = arith_gcd_u64(ms[i], ns[i]);
+
+        benchmark::DoNotOptimize(gcds.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_gcd_u64_batch(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_gcd_u64_batch(ms.data(), ns.data(), gcds.data(), N);
+
+        benchmark::DoNotOptimize(gcds.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_gcd_u64)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_gcd_u64_batch)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
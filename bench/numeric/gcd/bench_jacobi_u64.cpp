@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+
+
+
+static std::vector<arith_u64> as;
+static std::vector<arith_u64> ns;
+static std::vector<int> symbols;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+
+    as.resize(N);
+    ns.resize(N);
+    symbols.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        as[i] = dist(rng);
+        ns[i] = dist(rng) | 1;
+    }
+}
+
+static void bench_jacobi_u64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            symbols[i] = arith_jacobi_u64(as[i], ns[i]);
+
+        benchmark::DoNotOptimize(symbols.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_jacobi_u64_batch(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_jacobi_u64_batch(as.data(), ns.data(), symbols.data(), N);
+
+        benchmark::DoNotOptimize(symbols.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_kronecker_i64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            symbols[i] = arith_kronecker_i64((arith_i64)as[i], (arith_i64)(ns[i] << (i % 4)));
+
+        benchmark::DoNotOptimize(symbols.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_jacobi_u64)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_jacobi_u64_batch)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_kronecker_i64)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
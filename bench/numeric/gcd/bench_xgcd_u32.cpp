@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+
+
+
+static std::vector<arith_u32> ms;
+static std::vector<arith_u32> ns;
+static std::vector<arith_u32> gcds;
+static std::vector<arith_i32> xs;
+static std::vector<arith_i32> ys;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, ARITH_U32_MAX);
+
+    ms.resize(N);
+    ns.resize(N);
+    gcds.resize(N);
+    xs.resize(N);
+    ys.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        ms[i] = dist(rng);
+        ns[i] = dist(rng);
+    }
+}
+
+// The textbook extended Euclidean algorithm, with a hardware division for every quotient.
+static arith_u32 xgcd_u32_division(arith_u32 m, arith_u32 n, arith_i32* x, arith_i32* y) {
+    arith_u32 x0 = 1;
+    arith_u32 x1 = 0;
+    arith_u32 y0 = 0;
+    arith_u32 y1 = 1;
+
+    while (n != 0) {
+        const arith_u32 quotient  = m / n;
+        const arith_u32 remainder = m % n;
+        m                         = n;
+        n                         = remainder;
+
+        const arith_u32 x_next = x0 - quotient * x1;
+        const arith_u32 y_next = y0 - quotient * y1;
+        x0                     = x1;
+        x1                     = x_next;
+        y0                     = y1;
+        y1                     = y_next;
+    }
+
+    *x = (arith_i32)x0;
+    *y = (arith_i32)y0;
+    return m;
+}
+
+static void bench_gcd_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            gcds[i] = arith_gcd_u32(ms[i], ns[i]);
+
+        benchmark::DoNotOptimize(gcds.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_xgcd_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            gcds[i] = arith_xgcd_u32(ms[i], ns[i], &xs[i], &ys[i]);
+
+        benchmark::DoNotOptimize(gcds.data());
+        benchmark::DoNotOptimize(xs.data());
+        benchmark::DoNotOptimize(ys.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_xgcd_u32_division(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            gcds[i] = xgcd_u32_division(ms[i], ns[i], &xs[i], &ys[i]);
+
+        benchmark::DoNotOptimize(gcds.data());
+        benchmark::DoNotOptimize(xs.data());
+        benchmark::DoNotOptimize(ys.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_gcd_u32)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_xgcd_u32)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_xgcd_u32_division)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/abs.h"
+#include "arithmos/numeric/gcd.h"
+#include "arithmos/numeric/multiply.h"
+
+
+
+// Compares calls into the library with the header-only versions of arithmos_inline.h, which are used by the kernels
+// of bench_inline_kernels.cpp. Both do the same work, so the difference is the cost of the calls, including the
+// indirect call of the CPU dispatch for gcd.
+arith_u64 sum_abs_i64_inline(const arith_i64* x, const size_t N);
+arith_u64 dot_mod_mul_u64_inline(const arith_u64* multipliers, const arith_u64* multiplicands, const size_t N,
+                                 const arith_u64 modulus);
+arith_u64 sum_gcd_u64_inline(const arith_u64* m, const arith_u64* n, const size_t N);
+
+
+static std::vector<arith_u64> m_values;
+static std::vector<arith_u64> n_values;
+static arith_u64 modulus;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+
+    m_values.resize(N);
+    n_values.resize(N);
+
+    modulus = dist(rng) | 1;
+
+    for (size_t i = 0; i < N; ++i) {
+        m_values[i] = dist(rng) % modulus;
+        n_values[i] = dist(rng) % modulus;
+    }
+}
+
+static void bench_abs_i64_call(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+    const arith_i64* x = reinterpret_cast<const arith_i64*>(m_values.data());
+
+    for (auto _ : state) {
+        arith_u64 sum = 0;
+        for (size_t i = 0; i < N; ++i)
+            sum += arith_unsigned_abs_i64(x[i]);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_abs_i64_inline(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+    const arith_i64* x = reinterpret_cast<const arith_i64*>(m_values.data());
+
+    for (auto _ : state) {
+        const arith_u64 sum = sum_abs_i64_inline(x, N);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_mod_mul_u64_call(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_u64 sum = 0;
+        for (size_t i = 0; i < N; ++i) {
+            const arith_u64 product = arith_mod_mul_u64(m_values[i], n_values[i], modulus);
+            sum                     = (sum >= modulus - product) ? sum - (modulus - product) : sum + product;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_mod_mul_u64_inline(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        const arith_u64 sum = dot_mod_mul_u64_inline(m_values.data(), n_values.data(), N, modulus);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_gcd_u64_call(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_u64 sum = 0;
+        for (size_t i = 0; i < N; ++i)
+            sum += arith_gcd_u64(m_values[i], n_values[i]);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_gcd_u64_inline(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        const arith_u64 sum = sum_gcd_u64_inline(m_values.data(), n_values.data(), N);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_abs_i64_call)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_abs_i64_inline)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_mod_mul_u64_call)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_mod_mul_u64_inline)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_gcd_u64_call)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_gcd_u64_inline)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,40 @@
+// The kernels of bench_inline.cpp with the header-only versions of the functions. They live in a separate translation
+// unit, since the header-only and the library versions have the same names.
+
+#define ARITHMOS_HEADER_ONLY
+
+#include <cstddef>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/abs.h"
+#include "arithmos/numeric/gcd.h"
+#include "arithmos/numeric/multiply.h"
+
+
+
+arith_u64 sum_abs_i64_inline(const arith_i64* x, const size_t N) {
+    arith_u64 sum = 0;
+    for (size_t i = 0; i < N; ++i)
+        sum += arith_unsigned_abs_i64(x[i]);
+
+    return sum;
+}
+
+arith_u64 dot_mod_mul_u64_inline(const arith_u64* multipliers, const arith_u64* multiplicands, const size_t N,
+                                 const arith_u64 modulus) {
+    arith_u64 sum = 0;
+    for (size_t i = 0; i < N; ++i) {
+        const arith_u64 product = arith_mod_mul_u64(multipliers[i], multiplicands[i], modulus);
+        sum                     = (sum >= modulus - product) ? sum - (modulus - product) : sum + product;
+    }
+
+    return sum;
+}
+
+arith_u64 sum_gcd_u64_inline(const arith_u64* m, const arith_u64* n, const size_t N) {
+    arith_u64 sum = 0;
+    for (size_t i = 0; i < N; ++i)
+        sum += arith_gcd_u64(m[i], n[i]);
+
+    return sum;
+}
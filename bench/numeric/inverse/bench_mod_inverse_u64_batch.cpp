@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/inverse.h"
+
+
+
+// The Mersenne prime 2^61 - 1.
+static constexpr arith_u64 modulus = 2305843009213693951;
+
+static std::vector<arith_u64> as;
+static std::vector<arith_u64> inverses;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(1, modulus - 1);
+
+    as.resize(N);
+    inverses.resize(N);
+
+    for (size_t i = 0; i < N; ++i)
+        as[i] = dist(rng);
+}
+
+static void bench_mod_inverse_u64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            inverses[i] = arith_mod_inverse_u64(as[i], modulus);
+
+        benchmark::DoNotOptimize(inverses.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_mod_inverse_u64_batch(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N);
+
+    for (auto _ : state) {
+        arith_mod_inverse_u64_batch(as.data(), modulus, inverses.data(), N);
+
+        benchmark::DoNotOptimize(inverses.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_mod_inverse_u64)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_mod_inverse_u64_batch)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
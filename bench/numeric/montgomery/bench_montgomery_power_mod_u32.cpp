@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/power.h"
+
+
+
+// The workload consists of many exponentiations against a few fixed odd moduli.
+static constexpr size_t MODULUS_COUNT = 4;
+
+static std::vector<arith_u32> bases;
+static std::vector<arith_u32> exponents;
+static std::vector<arith_u32> modulos;
+static std::vector<arith_montgomery_u32> montgomeries;
+
+static void generate_inputs(size_t N) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, ARITH_U32_MAX);
+
+    bases.resize(N);
+    exponents.resize(N);
+    modulos.resize(MODULUS_COUNT);
+    montgomeries.resize(MODULUS_COUNT);
+
+    for (size_t i = 0; i < N; ++i) {
+        bases[i]     = dist(rng);
+        exponents[i] = dist(rng);
+    }
+
+    for (size_t i = 0; i < MODULUS_COUNT; ++i) {
+        modulos[i] = dist(rng) | 1;
+        arith_montgomery_init_u32(&montgomeries[i], modulos[i]);
+    }
+}
+
+static void bench_power_mod_u32(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_power_mod_u32(bases[i], exponents[i], modulos[i % MODULUS_COUNT]));
+
+        i = (i + 1) % N;
+    }
+}
+
+static void bench_montgomery_power_mod_u32(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        const arith_montgomery_u32* montgomery = &montgomeries[i % MODULUS_COUNT];
+        benchmark::DoNotOptimize(arith_montgomery_power_mod_u32(montgomery, bases[i], exponents[i]));
+
+        i = (i + 1) % N;
+    }
+}
+
+
+BENCHMARK(bench_power_mod_u32);
+BENCHMARK(bench_montgomery_power_mod_u32);
+
+BENCHMARK_MAIN();
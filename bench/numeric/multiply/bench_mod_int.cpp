@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/arithmos.hpp"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/multiply.h"
+
+
+
+// The workload is a modular dot product. arith_mod_mul_*() only knows the modulus at run time and divides, while
+// mod_int<M> reduces with a reciprocal of the compile-time modulus.
+constexpr arith_u64 MODULUS_U32 = 4294967291;              // The largest 32-bit prime.
+constexpr arith_u64 MODULUS_U64 = 18446744073709551557ULL;  // The largest 64-bit prime.
+
+static std::vector<arith_u64> multipliers;
+static std::vector<arith_u64> multiplicands;
+
+static void generate_inputs(size_t N, const arith_u64 modulus) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, modulus - 1);
+
+    multipliers.resize(N);
+    multiplicands.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        multipliers[i]   = dist(rng);
+        multiplicands[i] = dist(rng);
+    }
+}
+
+static void bench_mod_mul_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N, MODULUS_U32);
+    // Hide the modulus from the compiler, so that it is only known at run time as for arith_mod_mul_u32().
+    arith_u32 modulus = MODULUS_U32;
+    benchmark::DoNotOptimize(modulus);
+
+    for (auto _ : state) {
+        arith_u32 sum = 0;
+        for (size_t i = 0; i < N; ++i) {
+            const arith_u32 product =
+            arith_mod_mul_u32((arith_u32)multipliers[i], (arith_u32)multiplicands[i], modulus);
+            sum                     = (sum >= modulus - product) ? sum - (modulus - product) : sum + product;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_mod_int_u32(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N, MODULUS_U32);
+    const std::vector<arithmos::mod_int<MODULUS_U32>> residue_multipliers(multipliers.begin(), multipliers.end());
+    const std::vector<arithmos::mod_int<MODULUS_U32>> residue_multiplicands(multiplicands.begin(), multiplicands.end());
+
+    for (auto _ : state) {
+        arithmos::mod_int<MODULUS_U32> sum = 0;
+        for (size_t i = 0; i < N; ++i)
+            sum += residue_multipliers[i] * residue_multiplicands[i];
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_mod_mul_u64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N, MODULUS_U64);
+    arith_u64 modulus = MODULUS_U64;
+    benchmark::DoNotOptimize(modulus);
+
+    for (auto _ : state) {
+        arith_u64 sum = 0;
+        for (size_t i = 0; i < N; ++i) {
+            const arith_u64 product = arith_mod_mul_u64(multipliers[i], multiplicands[i], modulus);
+            sum                     = (sum >= modulus - product) ? sum - (modulus - product) : sum + product;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_mod_int_u64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    generate_inputs(N, MODULUS_U64);
+    const std::vector<arithmos::mod_int<MODULUS_U64>> residue_multipliers(multipliers.begin(), multipliers.end());
+    const std::vector<arithmos::mod_int<MODULUS_U64>> residue_multiplicands(multiplicands.begin(), multiplicands.end());
+
+    for (auto _ : state) {
+        arithmos::mod_int<MODULUS_U64> sum = 0;
+        for (size_t i = 0; i < N; ++i)
+            sum += residue_multipliers[i] * residue_multiplicands[i];
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_mod_mul_u32)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_mod_int_u32)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_mod_mul_u64)->Arg(1000)->Arg(1000000);
+BENCHMARK(bench_mod_int_u64)->Arg(1000)->Arg(1000000);
+
+BENCHMARK_MAIN();
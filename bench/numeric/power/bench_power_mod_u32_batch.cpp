@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/power.h"
+
+
+
+static std::vector<arith_u32> bases;
+static std::vector<arith_u32> exponents;
+static std::vector<arith_u32> moduli;
+static std::vector<arith_u32> results;
+
+// Generates random inputs with odd moduli of `modulus_bits` bits.
+static void generate_inputs(size_t N, unsigned modulus_bits) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u32> dist(0, ARITH_U32_MAX);
+
+    bases.resize(N);
+    exponents.resize(N);
+    moduli.resize(N);
+    results.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        bases[i]     = dist(rng);
+        exponents[i] = dist(rng);
+        moduli[i]    = (dist(rng) >> (32 - modulus_bits)) | 1;
+    }
+}
+
+static void bench_power_mod_u32(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N, (unsigned)state.range(0));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            results[i] = arith_power_mod_u32(bases[i], exponents[i], moduli[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_power_mod_u32_batch(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N, (unsigned)state.range(0));
+
+    for (auto _ : state) {
+        arith_power_mod_u32_batch(bases.data(), exponents.data(), moduli.data(), results.data(), N);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_power_mod_u32)->Arg(16)->Arg(32);
+BENCHMARK(bench_power_mod_u32_batch)->Arg(16)->Arg(32);
+
+BENCHMARK_MAIN();
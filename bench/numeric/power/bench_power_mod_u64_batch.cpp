@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/power.h"
+
+
+
+static std::vector<arith_u64> bases;
+static std::vector<arith_u64> exponents;
+static std::vector<arith_u64> moduli;
+static std::vector<arith_u64> results;
+
+// Generates random inputs with odd moduli of `modulus_bits` bits and exponents of at most `exponent_bits` bits.
+static void generate_inputs(size_t N, unsigned modulus_bits, unsigned exponent_bits) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+
+    bases.resize(N);
+    exponents.resize(N);
+    moduli.resize(N);
+    results.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        bases[i]     = dist(rng);
+        exponents[i] = dist(rng) >> (64 - exponent_bits);
+        moduli[i]    = (dist(rng) >> (64 - modulus_bits)) | 1;
+    }
+}
+
+static void bench_power_mod_u64(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N, (unsigned)state.range(0), (unsigned)state.range(1));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            results[i] = arith_power_mod_u64(bases[i], exponents[i], moduli[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_power_mod_u64_batch(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N, (unsigned)state.range(0), (unsigned)state.range(1));
+
+    for (auto _ : state) {
+        arith_power_mod_u64_batch(bases.data(), exponents.data(), moduli.data(), results.data(), N);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+// Moduli of 52 bits or less are handled in AVX-512 IFMA lanes, wider ones take the scalar path, which switches to
+// sliding-window exponentiation for long exponents.
+BENCHMARK(bench_power_mod_u64)->ArgsProduct({{52, 64}, {8, 16, 32, 64}});
+BENCHMARK(bench_power_mod_u64_batch)->ArgsProduct({{52, 64}, {8, 16, 32, 64}});
+
+BENCHMARK_MAIN();
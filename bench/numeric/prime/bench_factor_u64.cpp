@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+static std::vector<arith_u64> inputs;
+
+// Generates random inputs. If `factor_bits` is nonzero, every input is a product of two random primes of
+// `factor_bits` bits instead.
+static void generate_inputs(size_t N, unsigned factor_bits) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+
+    inputs.resize(N);
+
+    auto random_prime = [&]() {
+        arith_u64 p = (dist(rng) >> (64 - factor_bits)) | ((arith_u64)1 << (factor_bits - 1)) | 1;
+        while (!arith_is_prime_u64(p))
+            p += 2;
+
+        return p;
+    };
+
+    for (size_t i = 0; i < N; ++i)
+        inputs[i] = (factor_bits == 0) ? dist(rng) : random_prime() * random_prime();
+}
+
+static void bench_factor_u64(benchmark::State& state) {
+    constexpr size_t N = 1000;
+
+    generate_inputs(N, (unsigned)state.range(0));
+
+    arith_u64 primes[15];
+    unsigned exponents[15];
+
+    for (auto _ : state) {
+        unsigned count = 0;
+        for (size_t i = 0; i < N; ++i)
+            count += arith_factor_u64(inputs[i], primes, exponents);
+
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(primes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+// Random inputs (0) mostly consist of small factors, while the semiprimes take Pollard's rho method about
+// 2^(factor_bits / 2) steps.
+BENCHMARK(bench_factor_u64)->Arg(0)->Arg(16)->Arg(24)->Arg(32);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+static std::vector<arith_u64> inputs;
+
+// Generates random odd inputs. If `primes_only` is set, every input is replaced by the next prime.
+static void generate_inputs(size_t N, bool primes_only) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(ARITH_U64_MAX / 2, ARITH_U64_MAX - 2000);
+
+    inputs.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        inputs[i] = dist(rng) | 1;
+
+        while (primes_only && !arith_is_prime_u64(inputs[i]))
+            inputs[i] += 2;
+    }
+}
+
+static void bench_is_prime_u64(benchmark::State& state) {
+    constexpr size_t N = 10000;
+
+    generate_inputs(N, state.range(0) == 1);
+
+    for (auto _ : state) {
+        size_t count = 0;
+        for (size_t i = 0; i < N; ++i)
+            count += arith_is_prime_u64(inputs[i]);
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+// Random odd inputs (0) are mostly rejected by trial division or the first base, while primes (1) take every base.
+BENCHMARK(bench_is_prime_u64)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+static void bench_prime_count_u64(benchmark::State& state) {
+    arith_u64 x = 1;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        x *= 10;
+
+    const unsigned thread_count = (unsigned)state.range(1);
+
+    for (auto _ : state) {
+        arith_u64 count = 0;
+        arith_prime_count_u64(x, thread_count, &count);
+
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+
+// Counts the primes up to 10^k with 1 thread and with one per CPU. The time grows by about 10^(2/3) per step of k.
+BENCHMARK(bench_prime_count_u64)
+    ->ArgsProduct({{10, 12, 14, 16}, {1, 0}})
+    ->ArgNames({"log10_x", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
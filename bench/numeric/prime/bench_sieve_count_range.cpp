@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+static void bench_sieve_count_range(benchmark::State& state) {
+    constexpr arith_u64 N = 10000000000;
+
+    const unsigned thread_count = (unsigned)state.range(0);
+
+    for (auto _ : state) {
+        arith_u64 count = 0;
+        arith_sieve_count_range(0, N, thread_count, &count);
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+// Counts the primes up to 10^10 with 1 to 64 threads. The wall-clock time shows the scaling with the number of
+// threads, up to the number of cores.
+BENCHMARK(bench_sieve_count_range)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+static void count_primes(const arith_u64* primes, size_t count, void* context) {
+    benchmark::DoNotOptimize(primes);
+    *static_cast<arith_u64*>(context) += count;
+}
+
+static void bench_sieve_range(benchmark::State& state) {
+    constexpr arith_u64 N = 100000000;
+
+    const arith_u64 lo = (arith_u64)1 << state.range(0);
+
+    for (auto _ : state) {
+        arith_u64 count = 0;
+        arith_sieve_range(lo, lo + N - 1, count_primes, &count);
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+// Sieves 10^8 numbers starting at 2^k. Up to about 2^40, the cost is dominated by the small sieving primes. Beyond
+// that, most sieving primes are large and generating them takes an increasing part of the time.
+BENCHMARK(bench_sieve_range)->Arg(0)->Arg(32)->Arg(40)->Arg(48)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/power.h"
+#include "arithmos/numeric/root.h"
+
+
+
+static std::vector<arith_u64> values;
+
+// Generates random integers of all sizes, or perfect powers if `powers` is set.
+static void generate_inputs(size_t N, bool powers) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, ARITH_U64_MAX);
+    std::uniform_int_distribution<unsigned> shift_dist(0, 63);
+    std::uniform_int_distribution<unsigned> exponent_dist(2, 12);
+
+    values.resize(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        values[i] = dist(rng) >> shift_dist(rng);
+        if (powers) {
+            const unsigned k = exponent_dist(rng);
+            values[i]        = arith_power_u64(2 + values[i] % (arith_iroot_u64(ARITH_U64_MAX, k) - 1), k);
+        }
+    }
+}
+
+static void bench_isqrt_u64(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N, false);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_isqrt_u64(values[i]));
+
+        i = (i + 1) % N;
+    }
+}
+
+// `k`-th roots with `k = state.range(0)`.
+static void bench_iroot_u64(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N, false);
+
+    const unsigned k = (unsigned)state.range(0);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_iroot_u64(values[i], k));
+
+        i = (i + 1) % N;
+    }
+}
+
+// Random integers, which are almost never perfect powers, if `state.range(0)` is `0`, and perfect powers otherwise.
+static void bench_perfect_power_u64(benchmark::State& state) {
+    constexpr size_t N = 1000000;
+
+    generate_inputs(N, state.range(0) != 0);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arith_perfect_power_u64(values[i], nullptr));
+
+        i = (i + 1) % N;
+    }
+}
+
+
+BENCHMARK(bench_isqrt_u64);
+BENCHMARK(bench_iroot_u64)->Arg(3)->Arg(5)->Arg(13);
+BENCHMARK(bench_perfect_power_u64)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/sqrt_mod.h"
+
+
+
+// Primes `p = 3 (mod 4)`, `p = 5 (mod 8)`, and `p = 1 (mod 2^s)` for `s = 8, 32, 56`.
+static const arith_u64 primes[] = {
+    0xffffffffffffffc5, 0xfffffffffffffe95, 0xfffffffffffff101, 0xffffffff00000001, 0xf700000000000001,
+};
+
+static std::vector<arith_u64> as;
+static std::vector<arith_u64> roots;
+
+static void generate_inputs(size_t N, const arith_u64 p) {
+    std::mt19937_64 rng(69420);
+    std::uniform_int_distribution<arith_u64> dist(0, p - 1);
+
+    as.resize(N);
+    roots.resize(N);
+
+    // Squares only, as non-residues are rejected early by some of the algorithms.
+    for (size_t i = 0; i < N; ++i) {
+        const arith_u64 x = dist(rng);
+        as[i]             = (arith_u64)((arith_u128)x * x % p);
+    }
+}
+
+static void bench_sqrt_mod_u64(benchmark::State& state) {
+    const size_t N    = (size_t)state.range(0);
+    const arith_u64 p = primes[state.range(1)];
+
+    generate_inputs(N, p);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            arith_sqrt_mod_u64(as[i], p, &roots[i]);
+
+        benchmark::DoNotOptimize(roots.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_sqrt_prime_mod_u64(benchmark::State& state) {
+    const size_t N    = (size_t)state.range(0);
+    const arith_u64 p = primes[state.range(1)];
+
+    generate_inputs(N, p);
+
+    arith_sqrt_prime_u64 prime;
+    arith_sqrt_prime_init_u64(&prime, p, 1);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            arith_sqrt_prime_mod_u64(&prime, as[i], &roots[i]);
+
+        benchmark::DoNotOptimize(roots.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+static void bench_sqrt_prime_power_mod_u64(benchmark::State& state) {
+    const size_t N = (size_t)state.range(0);
+
+    // 1000003^3 < 2^60.
+    arith_sqrt_prime_u64 prime;
+    arith_sqrt_prime_init_u64(&prime, 1000003, 3);
+
+    generate_inputs(N, prime.power_montgomery.modulus);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < N; ++i)
+            arith_sqrt_prime_mod_u64(&prime, as[i], &roots[i]);
+
+        benchmark::DoNotOptimize(roots.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t)N);
+}
+
+
+BENCHMARK(bench_sqrt_mod_u64)->ArgsProduct({{1000}, {0, 1, 2, 3, 4}});
+BENCHMARK(bench_sqrt_prime_mod_u64)->ArgsProduct({{1000}, {0, 1, 2, 3, 4}});
+BENCHMARK(bench_sqrt_prime_power_mod_u64)->Arg(1000);
+
+BENCHMARK_MAIN();
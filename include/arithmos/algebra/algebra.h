@@ -9,6 +9,9 @@ extern "C" {
 #endif
 
 
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/algebra/poly.h"
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_ALGEBRA_NTT_H_
+#define ARITHMOS_ALGEBRA_NTT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// Precomputed tables for number-theoretic transforms (NTTs) of length `2^k` with `k <= max_log_length` modulo a prime
+// `p`, with `R = 2^32`. Initialize with `arith_ntt_init_u32()`, free with `arith_ntt_free_u32()` and treat the fields
+// as read-only. The tables take `2^(max_log_length + 3)` bytes.
+typedef struct arith_ntt_u32 {
+    arith_montgomery_u32 montgomery;  // Montgomery constants modulo `p`.
+    unsigned max_log_length;          // The largest `k` for which transforms of length `2^k` are supported.
+    arith_u32* roots;                 // `roots[h + j] = w^j * R (mod p)` for `0 <= j < h`, with `w` of order `2h`.
+    arith_u32* inverse_roots;         // As `roots`, with `w^-1` in place of `w`.
+} arith_ntt_u32;
+
+
+// Initializes `ntt` for transforms of length up to `2^max_log_length` modulo `modulus`. Returns `false` if `modulus` is
+// not a prime below `2^30`, if `2^max_log_length` does not divide `modulus - 1`, or if memory could not be allocated.
+// Suitable primes include `998244353 = 119 * 2^23 + 1` and `469762049 = 7 * 2^26 + 1`.
+bool arith_ntt_init_u32(arith_ntt_u32* ntt, const arith_u32 modulus, const unsigned max_log_length);
+
+// Frees the tables of `ntt`.
+void arith_ntt_free_u32(arith_ntt_u32* ntt);
+
+
+// Computes the NTT of the `2^log_length` values in `values` in place: `values[i]` is replaced by the evaluation at
+// `w^bitreverse(i)` of the polynomial with coefficients `values`, where `w` has order `2^log_length` and
+// `bitreverse()` reverses the lowest `log_length` bits. The values must be smaller than `p`, and so are the results. If
+// `log_length > max_log_length`, the behaviour is undefined.
+void arith_ntt_forward_u32(const arith_ntt_u32* ntt, arith_u32* values, const unsigned log_length);
+
+// Computes the inverse of arith_ntt_forward_u32() in place: takes the values in bit-reversed order and returns the
+// coefficients in natural order, including the scaling by `2^-log_length`. The values must be smaller than `p`, and so
+// are the results. If `log_length > max_log_length`, the behaviour is undefined.
+void arith_ntt_inverse_u32(const arith_ntt_u32* ntt, arith_u32* values, const unsigned log_length);
+
+// Computes `out[i] = a[i] * b[i] (mod p)` for `0 <= i < count`. The values of `a` and `b` must be smaller than `p`.
+// `out` may be equal to `a` or `b`.
+void arith_ntt_pointwise_mul_u32(const arith_ntt_u32* ntt, const arith_u32* a, const arith_u32* b, arith_u32* out,
+                                 const size_t count);
+
+
+// Computes the `a_count + b_count - 1` coefficients of the product of the polynomials with coefficients `a` and `b`
+// modulo `p`, and stores them in `out`. The values of `a` and `b` do not need to be reduced, and `out` may overlap `a`
+// or `b`. If `a_count` or `b_count` is `0`, stores nothing. Returns `false` if the product needs a transform longer
+// than `2^max_log_length` or memory could not be allocated, in which case `out` is unchanged.
+bool arith_ntt_convolve_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count, const arith_u32* b,
+                            const size_t b_count, arith_u32* out);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_ALGEBRA_NTT_H_
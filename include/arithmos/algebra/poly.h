@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_ALGEBRA_POLY_H_
+#define ARITHMOS_ALGEBRA_POLY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+// A polynomial with coefficients modulo the prime `p` of an `arith_ntt_u32`, which is passed to every operation.
+// Initialize with `arith_poly_init_u32()` and free with `arith_poly_free_u32()`. The functions below keep the
+// coefficients reduced and the leading one nonzero, and grow `coefficients` as needed.
+typedef struct arith_poly_u32 {
+    arith_u32* coefficients;  // `coefficients[i]` is the coefficient of `x^i`, in `[0, p)`.
+    size_t length;            // The number of coefficients, which is `0` for the zero polynomial.
+    size_t capacity;          // The number of coefficients `coefficients` has room for.
+} arith_poly_u32;
+
+
+// Initializes `poly` to the zero polynomial, without allocating memory.
+void arith_poly_init_u32(arith_poly_u32* poly);
+
+// Frees the coefficients of `poly`, which must be initialized again before it is used.
+void arith_poly_free_u32(arith_poly_u32* poly);
+
+// Sets `poly` to the polynomial with the `count` coefficients `coefficients`, in increasing order of degree, reduced
+// modulo `p`. Returns `false` if memory could not be allocated, in which case `poly` is unchanged.
+bool arith_poly_set_u32(const arith_ntt_u32* ntt, arith_poly_u32* poly, const arith_u32* coefficients,
+                        const size_t count);
+
+
+// Sets `out` to the product of `a` and `b`. Short operands are multiplied by schoolbook multiplication and longer ones
+// with NTTs, or by Karatsuba multiplication if the product is too long for the tables of `ntt`. `out` may be `a` or
+// `b`. Returns `false` if memory could not be allocated, in which case `out` is unchanged.
+bool arith_poly_mul_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const arith_poly_u32* b,
+                        arith_poly_u32* out);
+
+// Sets `quotient` and `remainder` to the quotient and remainder of the division of `a` by `b`, so that
+// `a = quotient * b + remainder` with the degree of `remainder` less than that of `b`. Long quotients are computed with
+// a Newton iteration for the inverse of the reversed divisor in `O(M(n))` time, where `M(n)` is the time of a
+// multiplication. Either output may be `NULL`, and they may be `a` or `b`, but not the same. Returns `false` if `b` is
+// zero or memory could not be allocated, in which case the outputs are unchanged.
+bool arith_poly_divrem_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const arith_poly_u32* b,
+                           arith_poly_u32* quotient, arith_poly_u32* remainder);
+
+
+// Sets `out` to the first `count` coefficients of the power series `1 / a`, computed with a Newton iteration in
+// `O(M(n))` time. `out` may be `a`. Returns `false` if the constant coefficient of `a` is `0` or memory could not be
+// allocated, in which case `out` is unchanged.
+bool arith_poly_inverse_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                                   arith_poly_u32* out);
+
+// Sets `out` to the first `count` coefficients of the power series `log(a)`, as the integral of `a' / a`. `out` may be
+// `a`. Returns `false` if the constant coefficient of `a` is not `1`, if `count > p`, or if memory could not be
+// allocated, in which case `out` is unchanged.
+bool arith_poly_log_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                               arith_poly_u32* out);
+
+// Sets `out` to the first `count` coefficients of the power series `exp(a)`, computed with a Newton iteration in
+// `O(M(n))` time. `out` may be `a`. Returns `false` if the constant coefficient of `a` is not `0`, if `count > p`, or
+// if memory could not be allocated, in which case `out` is unchanged.
+bool arith_poly_exp_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                               arith_poly_u32* out);
+
+// Sets `out` to the first `count` coefficients of a power series whose square is `a`, computed with a Newton iteration
+// in `O(M(n))` time. If `a = x^(2k) b` with `b(0)` nonzero, the result is `x^k` times the root with the smaller
+// constant coefficient of `b`. `out` may be `a`. Returns `false` if `a` has no square root, that is if its lowest power
+// of `x` is odd or `b(0)` is not a square modulo `p`, or if memory could not be allocated, in which case `out` is
+// unchanged.
+bool arith_poly_sqrt_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                                arith_poly_u32* out);
+
+
+// Stores the values of `poly` at the `count` points `points` in `values`, reducing the points modulo `p`. Uses a
+// subproduct tree, which takes `O(M(n) log n)` time for `n` points and a polynomial of degree below `n`. `values` may
+// be `points`. Returns `false` if memory could not be allocated.
+bool arith_poly_evaluate_u32(const arith_ntt_u32* ntt, const arith_poly_u32* poly, const arith_u32* points,
+                             const size_t count, arith_u32* values);
+
+// Sets `poly` to the polynomial of degree below `count` that takes the values `values` at the points `points`, in
+// `O(M(n) log n)` time with a subproduct tree. Returns `false` if two points are equal modulo `p` or memory could not
+// be allocated, in which case `poly` is unchanged.
+bool arith_poly_interpolate_u32(const arith_ntt_u32* ntt, const arith_u32* points, const arith_u32* values,
+                                const size_t count, arith_poly_u32* poly);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_ALGEBRA_POLY_H_
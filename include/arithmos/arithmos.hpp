@@ -0,0 +1,385 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_HPP_
+#define ARITHMOS_HPP_
+
+// C++20 front-end of the library. The function templates below can be evaluated at compile time, and call the
+// corresponding C functions at run time, so that the CPU dispatch of the library is kept. `mod_int<M>` is a residue
+// modulo a modulus `M` that is known at compile time, for which the compiler replaces every division by a
+// multiplication with a precomputed reciprocal.
+
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+#include "arithmos/arithmos.h"
+
+
+
+namespace arithmos {
+
+
+// The integer types of the C interface.
+template <typename T>
+concept integer = std::same_as<T, arith_i32> || std::same_as<T, arith_i64> || std::same_as<T, arith_u32>
+                  || std::same_as<T, arith_u64>;
+
+
+namespace detail {
+
+// Converts `x` to `T`. Unlike `static_cast`, this does not warn with -Wuseless-cast if `x` already has type `T`.
+template <typename T, typename U>
+constexpr T convert(const U x) {
+    if constexpr (std::same_as<T, U>)
+        return x;
+    else
+        return static_cast<T>(x);
+}
+
+// The unsigned type that holds the product of two values of type `U`.
+template <typename U>
+using wide = std::conditional_t<sizeof(U) == sizeof(arith_u32), arith_u64, arith_u128>;
+
+// Computes the absolute value of `x`, and returns it as an unsigned value.
+template <std::integral T>
+constexpr std::make_unsigned_t<T> unsigned_abs(const T x) {
+    const std::make_unsigned_t<T> unsigned_x = convert<std::make_unsigned_t<T>>(x);
+
+    if constexpr (std::is_signed_v<T>)
+        return (x < 0) ? -unsigned_x : unsigned_x;
+    else
+        return unsigned_x;
+}
+
+// Computes the greatest common devisor of `m` and `n` with the binary GCD loop of gcd_u64.c.
+template <std::unsigned_integral U>
+constexpr U gcd(U m, U n) {
+    if (m == 0)
+        return n;
+
+    if (n == 0)
+        return m;
+
+    const int i = std::countr_zero(m);
+    m >>= i;
+    const int j = std::countr_zero(n);
+    n >>= j;
+    const int k = (i < j) ? i : j;
+
+    for (;;) {
+        const U n_cpy = n;
+        const U diff  = m - n;
+        n             = -diff;
+
+        if (n == 0)
+            return m << k;
+
+        if (m > n_cpy) {
+            m = n_cpy;
+            n = diff;
+        }
+
+        n >>= std::countr_zero(n);
+    }
+}
+
+// Computes `multiplier * multiplicand (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+template <std::unsigned_integral U>
+constexpr U mod_mul(const U multiplier, const U multiplicand, const U modulus) {
+    return convert<U>(convert<wide<U>>(multiplier) * multiplicand % modulus);
+}
+
+// Computes `base ^ exponent`, wrapping around on overflow.
+template <std::unsigned_integral U>
+constexpr U power(U base, U exponent) {
+    U result = 1;
+
+    for (;;) {
+        if ((exponent & 1) == 1)
+            result *= base;
+
+        if (exponent <= 1)
+            return result;
+
+        exponent >>= 1;
+        base *= base;
+    }
+}
+
+// Computes `base ^ exponent (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+template <std::unsigned_integral U>
+constexpr U power_mod(U base, U exponent, const U modulus) {
+    if (modulus == 1)
+        return 0;
+
+    U result = 1;
+    base %= modulus;
+
+    for (;;) {
+        if ((exponent & 1) == 1)
+            result = mod_mul(result, base, modulus);
+
+        if (exponent <= 1)
+            return result;
+
+        exponent >>= 1;
+        base = mod_mul(base, base, modulus);
+    }
+}
+
+// Computes the inverse of `a` modulo `modulus` in `[0, modulus)`, or `0` if `gcd(a, modulus) != 1`. If `modulus` is
+// `0`, the behaviour is undefined.
+template <std::unsigned_integral U>
+constexpr U mod_inverse(const U a, const U modulus) {
+    // The extended Euclidean algorithm, where the coefficients of `a` are kept modulo `modulus`.
+    U r0 = modulus;
+    U r1 = a % modulus;
+    U t0 = 0;
+    U t1 = 1;
+
+    while (r1 != 0) {
+        const U quotient  = r0 / r1;
+        const U remainder = r0 - quotient * r1;
+        const U product   = mod_mul(quotient, t1, modulus);
+        const U t         = (t0 >= product) ? t0 - product : t0 + (modulus - product);
+
+        r0 = r1;
+        r1 = remainder;
+        t0 = t1;
+        t1 = t;
+    }
+
+    return (r0 == 1) ? t0 : 0;
+}
+
+}  // namespace detail
+
+
+// Computes the greatest common devisor of `m` and `n`. If both `m` and `n` are `0`, returns `0`. If `gcd(m, n)` is not
+// representable as a value of type `T`, the behaviour is undefined.
+template <integer T>
+constexpr T gcd(const T m, const T n) {
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::same_as<T, arith_i32>)
+            return arith_gcd_i32(m, n);
+        else if constexpr (std::same_as<T, arith_i64>)
+            return arith_gcd_i64(m, n);
+        else if constexpr (std::same_as<T, arith_u32>)
+            return arith_gcd_u32(m, n);
+        else
+            return arith_gcd_u64(m, n);
+    }
+
+    return detail::convert<T>(detail::gcd(detail::unsigned_abs(m), detail::unsigned_abs(n)));
+}
+
+// Computes the least common multiple of `m` and `n`. If `lcm(m, n)` is not representable as a value of type `T`, the
+// behaviour is undefined for signed `T`, and the result is taken modulo `2^N` for unsigned `T` with `N` bits.
+template <integer T>
+constexpr T lcm(const T m, const T n) {
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::same_as<T, arith_i32>)
+            return arith_lcm_i32(m, n);
+        else if constexpr (std::same_as<T, arith_i64>)
+            return arith_lcm_i64(m, n);
+        else if constexpr (std::same_as<T, arith_u32>)
+            return arith_lcm_u32(m, n);
+        else
+            return arith_lcm_u64(m, n);
+    }
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    const std::make_unsigned_t<T> um = detail::unsigned_abs(m);
+    const std::make_unsigned_t<T> un = detail::unsigned_abs(n);
+
+    return detail::convert<T>(um / detail::gcd(um, un) * un);
+}
+
+// Computes `base ^ exponent`. If both `base` and `exponent` are `0`, returns `1`. If `base ^ exponent` is not
+// representable as a value of type `T`, the behaviour is undefined for signed `T`, and the result is taken modulo `2^N`
+// for unsigned `T` with `N` bits.
+template <integer T>
+constexpr T power(const T base, const std::make_unsigned_t<T> exponent) {
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::same_as<T, arith_i32>)
+            return arith_power_i32(base, exponent);
+        else if constexpr (std::same_as<T, arith_i64>)
+            return arith_power_i64(base, exponent);
+        else if constexpr (std::same_as<T, arith_u32>)
+            return arith_power_u32(base, exponent);
+        else
+            return arith_power_u64(base, exponent);
+    }
+
+    return detail::convert<T>(detail::power(detail::convert<std::make_unsigned_t<T>>(base), exponent));
+}
+
+// Computes `base ^ exponent (mod modulus)` in `[0, modulus)`. If `modulus` is `0`, the behaviour is undefined. If both
+// `base` and `exponent` are `0`, `base ^ exponent == 1`. For signed `T`, the behaviour is undefined if the result is
+// not representable as a value of type `T`, which will not occur if `modulus` is at most the maximum of `T` plus `1`.
+template <integer T>
+constexpr T power_mod(const T base, const std::make_unsigned_t<T> exponent, const std::make_unsigned_t<T> modulus) {
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::same_as<T, arith_i32>)
+            return arith_power_mod_i32(base, exponent, modulus);
+        else if constexpr (std::same_as<T, arith_i64>)
+            return arith_power_mod_i64(base, exponent, modulus);
+        else if constexpr (std::same_as<T, arith_u32>)
+            return arith_power_mod_u32(base, exponent, modulus);
+        else
+            return arith_power_mod_u64(base, exponent, modulus);
+    }
+
+    std::make_unsigned_t<T> unsigned_base = detail::unsigned_abs(base) % modulus;
+    if constexpr (std::is_signed_v<T>) {
+        if (base < 0 && unsigned_base != 0)
+            unsigned_base = modulus - unsigned_base;
+    }
+
+    return detail::convert<T>(detail::power_mod(unsigned_base, exponent, modulus));
+}
+
+
+// A residue modulo the compile-time constant `Modulus`, which is kept in `[0, Modulus)`. Since the modulus is a
+// constant, no operation uses a division instruction: products of residues below `2^32` are reduced by the compiler
+// with a multiplication by a reciprocal, and larger products with the division by an invariant integer of Moller and
+// Granlund, whose reciprocal is computed at compile time. All operations are `constexpr`, so that tables of residues
+// can be built at compile time.
+template <arith_u64 Modulus>
+    requires(Modulus > 0)
+class mod_int {
+public:
+    // The type of the residue, which is `arith_u32` if the modulus allows it.
+    using value_type = std::conditional_t<Modulus <= ARITH_U32_MAX, arith_u32, arith_u64>;
+
+    constexpr mod_int() = default;
+
+    // Constructs the residue of `x`, which may be negative.
+    template <std::integral T>
+    constexpr mod_int(const T x) : value_(reduce(x)) {}
+
+    static constexpr value_type modulus() { return Modulus; }
+
+    constexpr value_type value() const { return value_; }
+
+    constexpr mod_int& operator+=(const mod_int other) {
+        // Comparing with `modulus() - other.value_` avoids sums that wrap around, and takes a single comparison, which
+        // the compiler turns into a conditional move.
+        const value_type complement = modulus() - other.value_;
+        value_                      = (value_ >= complement) ? value_ - complement : value_ + other.value_;
+
+        return *this;
+    }
+
+    constexpr mod_int& operator-=(const mod_int other) {
+        const value_type difference = value_ - other.value_;
+        value_                      = (value_ < other.value_) ? difference + modulus() : difference;
+
+        return *this;
+    }
+
+    constexpr mod_int& operator*=(const mod_int other) {
+        value_ = multiply(value_, other.value_);
+
+        return *this;
+    }
+
+    // Multiplies by the inverse of `other`. If `other` is not invertible, the result is `0`.
+    constexpr mod_int& operator/=(const mod_int other) { return *this *= other.inverse(); }
+
+    constexpr mod_int operator-() const { return mod_int() - *this; }
+
+    // Computes `*this ^ exponent`, where `0 ^ 0 == 1` unless the modulus is `1`.
+    constexpr mod_int pow(arith_u64 exponent) const {
+        mod_int result = 1;
+        mod_int base   = *this;
+
+        for (;;) {
+            if ((exponent & 1) == 1)
+                result *= base;
+
+            if (exponent <= 1)
+                return result;
+
+            exponent >>= 1;
+            base *= base;
+        }
+    }
+
+    // Computes the inverse of `*this`, or `0` if it is not invertible, that is, if `gcd(value(), Modulus) != 1`.
+    constexpr mod_int inverse() const { return from_value(detail::mod_inverse(value_, modulus())); }
+
+    friend constexpr mod_int operator+(mod_int augend, const mod_int addend) { return augend += addend; }
+
+    friend constexpr mod_int operator-(mod_int minuend, const mod_int subtrahend) { return minuend -= subtrahend; }
+
+    friend constexpr mod_int operator*(mod_int multiplier, const mod_int multiplicand) {
+        return multiplier *= multiplicand;
+    }
+
+    friend constexpr mod_int operator/(mod_int dividend, const mod_int divisor) { return dividend /= divisor; }
+
+    friend constexpr bool operator==(const mod_int, const mod_int) = default;
+
+private:
+    // The constants of internal_barrett_reduce_2_by_1_u64(), for a modulus of more than 32 bits.
+    static constexpr int shift         = std::countl_zero(Modulus);
+    static constexpr arith_u64 divisor = Modulus << shift;
+    static constexpr arith_u64 reciprocal =
+    static_cast<arith_u64>(((static_cast<arith_u128>(~divisor) << 64) | ARITH_U64_MAX) / divisor);
+
+    value_type value_ = 0;
+
+    static constexpr mod_int from_value(const value_type value) {
+        mod_int result;
+        result.value_ = value;
+
+        return result;
+    }
+
+    template <std::integral T>
+    static constexpr value_type reduce(const T x) {
+        const value_type residue = detail::convert<value_type>(detail::unsigned_abs(x) % Modulus);
+
+        if constexpr (std::is_signed_v<T>)
+            return (x < 0 && residue != 0) ? modulus() - residue : residue;
+        else
+            return residue;
+    }
+
+    static constexpr value_type multiply(const value_type multiplier, const value_type multiplicand) {
+        if constexpr (std::same_as<value_type, arith_u32>) {
+            return static_cast<arith_u32>(static_cast<arith_u64>(multiplier) * multiplicand % Modulus);
+        } else {
+            // See internal_barrett_reduce_2_by_1_u64() for implementation details. The product of two residues has
+            // a high word below the modulus.
+            const arith_u128 product = static_cast<arith_u128>(multiplier) * multiplicand;
+            const arith_u64 high     = static_cast<arith_u64>(product >> 64);
+            const arith_u64 low      = static_cast<arith_u64>(product);
+
+            const arith_u64 u1 = (high << shift) | ((low >> 1) >> (63 - shift));
+            const arith_u64 u0 = low << shift;
+
+            const arith_u128 estimate =
+            static_cast<arith_u128>(reciprocal) * u1 + ((static_cast<arith_u128>(u1) << 64) | u0);
+            const arith_u64 quotient  = static_cast<arith_u64>(estimate >> 64) + 1;
+            arith_u64 remainder       = u0 - quotient * divisor;
+
+            if (remainder > static_cast<arith_u64>(estimate))
+                remainder += divisor;
+
+            if (remainder >= divisor)
+                remainder -= divisor;
+
+            return remainder >> shift;
+        }
+    }
+};
+
+
+}  // namespace arithmos
+
+#endif  // #ifndef ARITHMOS_HPP_
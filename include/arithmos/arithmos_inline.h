@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_ARITHMOS_INLINE_H_
+#define ARITHMOS_ARITHMOS_INLINE_H_
+
+// Header-only mode of the small scalar kernels: the functions of abs.h and multiply.h, and the scalar functions of
+// gcd.h and lcm.h. They are defined here as `static inline` functions with the same names and behaviour as the
+// library functions, so that they can be inlined into the caller. This saves the function call, and for gcd and lcm
+// also the indirect call of the CPU dispatch, which link-time optimization cannot remove.
+//
+// To use it, either include this header before any other arithmos header, or define `ARITHMOS_HEADER_ONLY` before
+// including them, in which case abs.h, multiply.h, gcd.h and lcm.h include this header instead of declaring these
+// functions. All other functions are still declared as usual and require linking with the library.
+
+#if !defined(ARITHMOS_HEADER_ONLY)                                                                                 \
+&& (defined(ARITHMOS_NUMERIC_ABS_H_) || defined(ARITHMOS_NUMERIC_MULTIPLY_H_) || defined(ARITHMOS_NUMERIC_GCD_H_) \
+    || defined(ARITHMOS_NUMERIC_LCM_H_))
+#error "arithmos_inline.h must be included before any other arithmos header, or ARITHMOS_HEADER_ONLY must be defined"
+#endif
+
+#ifndef ARITHMOS_HEADER_ONLY
+#define ARITHMOS_HEADER_ONLY 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "arithmos/core/types.h"
+
+
+
+// Computes the absolute value of `x`. The behaviour is undefined if
+// the result cannot be represented as a value of type `arith_i32`.
+static inline arith_i32 arith_abs_i32(const arith_i32 x) {
+    return (x < 0) ? -x : x;
+}
+
+// Computes the absolute value of `x`. The behaviour is undefined if
+// the result cannot be represented as a value of type `arith_i64`.
+static inline arith_i64 arith_abs_i64(const arith_i64 x) {
+    return (x < 0) ? -x : x;
+}
+
+// Computes the absolute value of `x`, and returns it as an unsigned value.
+static inline arith_u32 arith_unsigned_abs_i32(const arith_i32 x) {
+    return (x < 0) ? -(arith_u32)x : (arith_u32)x;
+}
+
+// Computes the absolute value of `x`, and returns it as an unsigned value.
+static inline arith_u64 arith_unsigned_abs_i64(const arith_i64 x) {
+    return (x < 0) ? -(arith_u64)x : (arith_u64)x;
+}
+
+
+// Computes `multiplier * multiplicand (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+// If `multiplier * multiplicand (mod modulus)` is not representable as a value of `arith_i32`, the
+// behaviour is undefined (this case will not occur if `modulus <= ARITH_I32_MAX + 1`).
+static inline arith_i32 arith_mod_mul_i32(const arith_i32 multiplier, const arith_i32 multiplicand,
+                                          const arith_u32 modulus) {
+    const arith_i64 signed_result = (arith_i64)multiplier * multiplicand % modulus;
+
+    return (arith_i32)((signed_result < 0) ? signed_result + modulus : signed_result);
+}
+
+// Computes `multiplier * multiplicand (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+// If `multiplier * multiplicand (mod modulus)` is not representable as a value of `arith_i64`, the
+// behaviour is undefined (this case will not occur if `modulus <= ARITH_I64_MAX + 1`).
+static inline arith_i64 arith_mod_mul_i64(const arith_i64 multiplier, const arith_i64 multiplicand,
+                                          const arith_u64 modulus) {
+    const arith_i128 signed_result = (arith_i128)multiplier * multiplicand % modulus;
+
+    return (arith_i64)((signed_result < 0) ? signed_result + modulus : signed_result);
+}
+
+// Computes `multiplier * multiplicand (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+static inline arith_u32 arith_mod_mul_u32(const arith_u32 multiplier, const arith_u32 multiplicand,
+                                          const arith_u32 modulus) {
+    return (arith_u32)((arith_u64)multiplier * multiplicand % modulus);
+}
+
+// Computes `multiplier * multiplicand (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+static inline arith_u64 arith_mod_mul_u64(const arith_u64 multiplier, const arith_u64 multiplicand,
+                                          const arith_u64 modulus) {
+    return (arith_u64)((arith_u128)multiplier * multiplicand % modulus);
+}
+
+
+// Computes `multiplier * multiplicand`, and returns it as an `arith_i128`.
+static inline arith_i128 arith_multiply_i64(const arith_i64 multiplier, const arith_i64 multiplicand) {
+    return (arith_i128)multiplier * multiplicand;
+}
+
+// Computes `multiplier * multiplicand`, and returns it as an `arith_u128`.
+static inline arith_u128 arith_multiply_u64(const arith_u64 multiplier, const arith_u64 multiplicand) {
+    return (arith_u128)multiplier * multiplicand;
+}
+
+
+// Computes the greatest common devisor of `m` and `n`. If both `m` and `n`
+// are `0`, returns `0`.
+static inline arith_u32 arith_gcd_u32(arith_u32 m, arith_u32 n) {
+    // A copy of arith_gcd_u32() in src/numeric/gcd/gcd_u32.c and of its loop internal_gcd_u32() in
+    // src/numeric/numeric_internal.h. Keep them in sync.
+
+    if (m == 0)
+        return n;
+
+    if (n == 0)
+        return m;
+
+    const int i = __builtin_ctz(m);
+    m >>= i;
+    const int j = __builtin_ctz(n);
+    n >>= j;
+    const int k = (i < j) ? i : j;
+
+    for (;;) {
+        const arith_u32 n_cpy = n;
+        const arith_u32 diff  = m - n;
+        n                     = -diff;
+
+        if (__builtin_expect(n == 0, 0))
+            return m << k;
+
+        if (m > n_cpy) {
+            m = n_cpy;
+            n = diff;
+        }
+
+        n >>= __builtin_ctz(n);
+    }
+}
+
+// Computes the greatest common devisor of `m` and `n`. If both `m` and `n`
+// are `0`, returns `0`.
+static inline arith_u64 arith_gcd_u64(arith_u64 m, arith_u64 n) {
+    // A copy of arith_gcd_u64() in src/numeric/gcd/gcd_u64.c and of its loop internal_gcd_u64() in
+    // src/numeric/numeric_internal.h. Keep them in sync.
+
+    if (m == 0)
+        return n;
+
+    if (n == 0)
+        return m;
+
+    const int i = __builtin_ctzll(m);
+    m >>= i;
+    const int j = __builtin_ctzll(n);
+    n >>= j;
+    const int k = (i < j) ? i : j;
+
+    for (;;) {
+        const arith_u64 n_cpy = n;
+        const arith_u64 diff  = m - n;
+        n                     = -diff;
+
+        if (__builtin_expect(n == 0, 0))
+            return m << k;
+
+        if (m > n_cpy) {
+            m = n_cpy;
+            n = diff;
+        }
+
+        n >>= __builtin_ctzll(n);
+    }
+}
+
+// Computes the greatest common devisor (gcd) of `m` and `n`. If both `m`
+// and `n` are `0`, returns `0`. If `gcd(m, n)` is not representable as a
+// value of type `arith_i32`, the behaviour is undefined.
+static inline arith_i32 arith_gcd_i32(const arith_i32 m, const arith_i32 n) {
+    return (arith_i32)arith_gcd_u32(arith_unsigned_abs_i32(m), arith_unsigned_abs_i32(n));
+}
+
+// Computes the greatest common devisor (gcd) of `m` and `n`. If both `m`
+// and `n` are `0`, returns `0`. If `gcd(m, n)` is not representable as a
+// value of type `arith_i64`, the behaviour is undefined.
+static inline arith_i64 arith_gcd_i64(const arith_i64 m, const arith_i64 n) {
+    return (arith_i64)arith_gcd_u64(arith_unsigned_abs_i64(m), arith_unsigned_abs_i64(n));
+}
+
+
+// Computes least common multiple (lcm) of `m` and `n`. If `lcm(m, n)` is not representable
+// as a value of type `arith_i32`, the behaviour is undefined.
+static inline arith_i32 arith_lcm_i32(const arith_i32 m, const arith_i32 n) {
+    if (m == 0 || n == 0)
+        return 0;
+
+    const arith_u32 um = arith_unsigned_abs_i32(m);
+    const arith_u32 un = arith_unsigned_abs_i32(n);
+
+    return (arith_i32)(um / arith_gcd_u32(um, un) * un);
+}
+
+// Computes least common multiple (lcm) of `m` and `n`. If `lcm(m, n)` is not representable
+// as a value of type `arith_i64`, the behaviour is undefined.
+static inline arith_i64 arith_lcm_i64(const arith_i64 m, const arith_i64 n) {
+    if (m == 0 || n == 0)
+        return 0;
+
+    const arith_u64 um = arith_unsigned_abs_i64(m);
+    const arith_u64 un = arith_unsigned_abs_i64(n);
+
+    return (arith_i64)(um / arith_gcd_u64(um, un) * un);
+}
+
+// Computes least common multiple (lcm) of `m` and `n`. If `lcm(m, n)` is not
+// representable as a value of type `arith_u32`, returns `lcm(m, n) (mod ARITH_U32_MAX + 1)`.
+static inline arith_u32 arith_lcm_u32(const arith_u32 m, const arith_u32 n) {
+    if (m == 0 || n == 0)
+        return 0;
+
+    return m / arith_gcd_u32(m, n) * n;
+}
+
+// Computes least common multiple (lcm) of `m` and `n`. If `lcm(m, n)` is not
+// representable as a value of type `arith_u64`, returns `lcm(m, n) (mod ARITH_U64_MAX + 1)`.
+static inline arith_u64 arith_lcm_u64(const arith_u64 m, const arith_u64 n) {
+    if (m == 0 || n == 0)
+        return 0;
+
+    return m / arith_gcd_u64(m, n) * n;
+}
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_ARITHMOS_INLINE_H_
@@ -13,6 +13,12 @@ extern "C" {
 
 
 
+#ifdef ARITHMOS_HEADER_ONLY
+
+#include "arithmos/arithmos_inline.h"
+
+#else
+
 // Computes the absolute value of `x`. The behaviour is undefined if
 // the result cannot be represented as a value of type `arith_i32`.
 arith_i32 arith_abs_i32(const arith_i32 x);
@@ -27,6 +33,8 @@ arith_u32 arith_unsigned_abs_i32(const arith_i32 x);
 // Computes the absolute value of `x`, and returns it as an unsigned value.
 arith_u64 arith_unsigned_abs_i64(const arith_i64 x);
 
+#endif  // #ifdef ARITHMOS_HEADER_ONLY
+
 
 
 #ifdef __cplusplus
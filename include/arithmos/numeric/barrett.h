@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_BARRETT_H_
+#define ARITHMOS_NUMERIC_BARRETT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "arithmos/core/types.h"
+
+
+
+// Precomputed reciprocal for reduction modulo a fixed `modulus` without hardware division. Unlike Montgomery
+// arithmetic, any nonzero modulus is supported and values stay in ordinary form. Initialize with
+// `arith_barrett_init_u32()` and treat the fields as read-only.
+typedef struct arith_barrett_u32 {
+    arith_u32 modulus;     // The modulus `n`.
+    arith_u64 reciprocal;  // `floor((2^64 - 1) / n)`.
+} arith_barrett_u32;
+
+// Precomputed reciprocal for reduction modulo a fixed `modulus` without hardware division. Unlike Montgomery
+// arithmetic, any nonzero modulus is supported and values stay in ordinary form. Initialize with
+// `arith_barrett_init_u64()` and treat the fields as read-only.
+typedef struct arith_barrett_u64 {
+    arith_u64 modulus;     // The modulus `n`.
+    arith_u64 divisor;     // `n << shift`, which has its most significant bit set.
+    arith_u64 reciprocal;  // `floor((2^128 - 1) / divisor) - 2^64`.
+    unsigned shift;        // The number of leading `0`-bits of `n`.
+} arith_barrett_u64;
+
+
+// Initializes `barrett` for arithmetic modulo `modulus`. If `modulus` is `0`, the behaviour is undefined.
+void arith_barrett_init_u32(arith_barrett_u32* barrett, const arith_u32 modulus);
+
+// Initializes `barrett` for arithmetic modulo `modulus`. If `modulus` is `0`, the behaviour is undefined.
+void arith_barrett_init_u64(arith_barrett_u64* barrett, const arith_u64 modulus);
+
+
+// Computes `x (mod modulus)`.
+arith_u32 arith_barrett_reduce_u32(const arith_barrett_u32* barrett, const arith_u64 x);
+
+// Computes `x (mod modulus)`.
+arith_u64 arith_barrett_reduce_u64(const arith_barrett_u64* barrett, const arith_u128 x);
+
+
+// Computes `multiplier * multiplicand (mod modulus)`. The operands do not need to be reduced.
+arith_u32 arith_barrett_mod_mul_u32(const arith_barrett_u32* barrett, const arith_u32 multiplier,
+                                    const arith_u32 multiplicand);
+
+// Computes `multiplier * multiplicand (mod modulus)`. The operands do not need to be reduced, but the computation is
+// fastest if they are.
+arith_u64 arith_barrett_mod_mul_u64(const arith_barrett_u64* barrett, const arith_u64 multiplier,
+                                    const arith_u64 multiplicand);
+
+
+// Computes `augend + addend (mod modulus)`. If `augend` or `addend` is not smaller than `modulus`, the behaviour is
+// undefined.
+arith_u32 arith_barrett_mod_add_u32(const arith_barrett_u32* barrett, const arith_u32 augend, const arith_u32 addend);
+
+// Computes `augend + addend (mod modulus)`. If `augend` or `addend` is not smaller than `modulus`, the behaviour is
+// undefined.
+arith_u64 arith_barrett_mod_add_u64(const arith_barrett_u64* barrett, const arith_u64 augend, const arith_u64 addend);
+
+
+// Computes `minuend - subtrahend (mod modulus)`. If `minuend` or `subtrahend` is not smaller than `modulus`, the
+// behaviour is undefined.
+arith_u32 arith_barrett_mod_sub_u32(const arith_barrett_u32* barrett, const arith_u32 minuend,
+                                    const arith_u32 subtrahend);
+
+// Computes `minuend - subtrahend (mod modulus)`. If `minuend` or `subtrahend` is not smaller than `modulus`, the
+// behaviour is undefined.
+arith_u64 arith_barrett_mod_sub_u64(const arith_barrett_u64* barrett, const arith_u64 minuend,
+                                    const arith_u64 subtrahend);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_BARRETT_H_
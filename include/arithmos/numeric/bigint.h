@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_BIGINT_H_
+#define ARITHMOS_NUMERIC_BIGINT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+// A bump allocator over memory supplied by the caller, from which arbitrary-precision integers take their limbs and
+// scratch space. Nothing is freed individually: limbs stay valid until the arena is reset, and the scratch space of an
+// operation is handed back when it returns. Initialize with `arith_bigint_arena_init()` and treat the fields as
+// read-only.
+typedef struct arith_bigint_arena {
+    arith_u64* memory;  // The memory supplied by the caller.
+    size_t capacity;    // The number of limbs `memory` has room for.
+    size_t used;        // The number of limbs handed out.
+} arith_bigint_arena;
+
+// An arbitrary-precision unsigned integer `sum_i limbs[i] * 2^(64 i)`. Initialize with `arith_bigint_init()`. The
+// functions below keep the leading limb nonzero, and take new limbs from an arena if `limbs` has too little room.
+typedef struct arith_bigint {
+    arith_u64* limbs;  // The limbs, least significant first.
+    size_t length;     // The number of limbs, which is `0` for `0`.
+    size_t capacity;   // The number of limbs `limbs` has room for.
+} arith_bigint;
+
+// NTT tables modulo the primes `998244353`, `469762049` and `167772161` for the multiplication of long integers, which
+// are split into 32-bit pieces whose products are recovered by the Chinese remainder theorem. Initialize with
+// `arith_bigint_ntt_init()` and free with `arith_bigint_ntt_free()`.
+typedef struct arith_bigint_ntt {
+    arith_ntt_u32 ntts[3];
+} arith_bigint_ntt;
+
+
+// Initializes `arena` to hand out the `capacity` limbs at `memory`, which must stay valid while `arena` is used.
+void arith_bigint_arena_init(arith_bigint_arena* arena, arith_u64* memory, const size_t capacity);
+
+// Hands all memory of `arena` out again, which invalidates the limbs of the integers that took them from it.
+void arith_bigint_arena_reset(arith_bigint_arena* arena);
+
+// Initializes `ntt` for products of up to `2^(max_log_length - 1)` limbs. Returns `false` if `max_log_length > 23` or
+// memory could not be allocated. The tables take `3 * 2^(max_log_length + 3)` bytes.
+bool arith_bigint_ntt_init(arith_bigint_ntt* ntt, const unsigned max_log_length);
+
+// Frees the tables of `ntt`.
+void arith_bigint_ntt_free(arith_bigint_ntt* ntt);
+
+
+// Initializes `x` to `0`, without taking memory.
+void arith_bigint_init(arith_bigint* x);
+
+// Sets `x` to `value`. Returns `false` if `arena` is exhausted, in which case `x` is unchanged.
+bool arith_bigint_set_u64(arith_bigint_arena* arena, arith_bigint* x, const arith_u64 value);
+
+// Returns a negative value, `0` or a positive value if `a` is smaller than, equal to or larger than `b`.
+int arith_bigint_compare(const arith_bigint* a, const arith_bigint* b);
+
+// Computes `a (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
+arith_u64 arith_bigint_mod_u64(const arith_bigint* a, const arith_u64 modulus);
+
+
+// Sets `out` to `a + b`. `out` may be `a` or `b`. Returns `false` if `arena` is exhausted, in which case `out` is
+// unchanged.
+bool arith_bigint_add(arith_bigint_arena* arena, const arith_bigint* a, const arith_bigint* b, arith_bigint* out);
+
+// Sets `out` to `a - b`. `out` may be `a` or `b`. Returns `false` if `a < b` or `arena` is exhausted, in which case
+// `out` is unchanged.
+bool arith_bigint_sub(arith_bigint_arena* arena, const arith_bigint* a, const arith_bigint* b, arith_bigint* out);
+
+// Sets `out` to `a * multiplier`. `out` may be `a`. Returns `false` if `arena` is exhausted, in which case `out` is
+// unchanged.
+bool arith_bigint_mul_u64(arith_bigint_arena* arena, const arith_bigint* a, const arith_u64 multiplier,
+                          arith_bigint* out);
+
+// Sets `out` to `a * b`. Short operands are multiplied by schoolbook multiplication, longer ones by Karatsuba and then
+// Toom-3 multiplication, and the longest ones with NTTs if `ntt` is not `NULL` and its tables are long enough. Besides
+// the limbs of `out`, the scratch space taken from `arena` is at most `8 * (a->length + b->length)` limbs. `out` may
+// be `a` or `b`, in which case it gets new limbs. Returns `false` if `arena` is exhausted, in which case `out` is
+// unchanged.
+bool arith_bigint_mul(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_bigint* a,
+                      const arith_bigint* b, arith_bigint* out);
+
+
+// Sets `out` to `base ^ exponent` where `^` is exponentiation, exactly. If both `base` and `exponent` are `0`, sets
+// `out` to `1`. `ntt` may be `NULL`, as for arith_bigint_mul(). Returns `false` if `arena` is exhausted, in which case
+// `out` is unchanged.
+bool arith_bigint_power_u64(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64 base,
+                            const arith_u64 exponent, arith_bigint* out);
+
+// Sets `out` to the least common multiple of the `count` values `values`, exactly, or to `1` if `count` is `0`. If any
+// value is `0`, sets `out` to `0`. Returns `false` if `arena` is exhausted, in which case `out` is unchanged.
+bool arith_bigint_lcm_u64_array(arith_bigint_arena* arena, const arith_u64* values, const size_t count,
+                                arith_bigint* out);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_BIGINT_H_
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_DISCRETE_LOG_H_
+#define ARITHMOS_NUMERIC_DISCRETE_LOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdbool.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// The part of the order `n` of a base `g` belonging to one prime `q^e || n`. Montgomery forms are taken modulo `p`.
+typedef struct arith_log_subgroup_u64 {
+    arith_u64 prime;            // `q`.
+    unsigned exponent;          // `e`.
+    unsigned table_bits;        // The baby-step table has `2^table_bits` slots.
+    arith_u64 cofactor;         // `n / q^e`.
+    arith_u64 generator;        // `g^(n / q) * R (mod p)`, of order `q`.
+    arith_u64 inverse_base;     // `g^-(n / q^e) * R (mod p)`, of order `q^e`.
+    arith_u64 giant_step;       // `g^-(m * n / q) * R (mod p)` for `m` baby steps.
+    arith_u64 baby_steps;       // `m`.
+    arith_u64 crt_coefficient;  // `1 (mod q^e)` and `0 (mod n / q^e)`.
+    arith_u64* table;           // The baby steps, or `NULL` if the logarithms are found with Pollard's rho instead.
+} arith_log_subgroup_u64;
+
+// Precomputed constants for discrete logarithms to a fixed base `g` modulo a fixed odd prime `p`, for taking many
+// logarithms to that base. The logarithms are computed modulo every prime power `q^e` dividing the order of `g`
+// separately (Pohlig-Hellman), one base-`q` digit at a time. Each digit is a logarithm in the subgroup of order `q`,
+// which is found by baby-step giant-step with a table of baby steps built once, or with Pollard's rho if the table
+// would not fit in memory. Initialize with `arith_log_base_init_u64()`, free with `arith_log_base_free_u64()` and treat
+// the fields as read-only.
+typedef struct arith_log_base_u64 {
+    arith_montgomery_u64 montgomery;       // Montgomery constants modulo `p`.
+    arith_u64 base;                        // `g * R (mod p)`.
+    arith_u64 order;                       // The multiplicative order `n` of `g`.
+    unsigned subgroup_count;               // The number of distinct prime factors of `n`.
+    arith_log_subgroup_u64 subgroups[15];  // The subgroups, in increasing order of their primes.
+} arith_log_base_u64;
+
+
+// Initializes `base` for discrete logarithms to the base `g` modulo the prime `p`. This factors `p - 1`, and builds a
+// baby-step table of less than `32 * (sqrt(q) + 1)` bytes for every prime `q` up to `2^40` dividing the order of `g`:
+// at most 16 MiB for the largest ones, and far less for most `p`. Returns `false` if `p` is not an odd prime, if `g` is
+// divisible by `p`, or if memory could not be allocated.
+bool arith_log_base_init_u64(arith_log_base_u64* base, const arith_u64 g, const arith_u64 p);
+
+// Frees the baby-step tables of `base`.
+void arith_log_base_free_u64(arith_log_base_u64* base);
+
+// Computes the smallest `x` with `g^x = h (mod p)` for the `g` and `p` of `base`, and stores it in `x`. Returns
+// `false`, leaving `x` untouched, if `h` is not a power of `g`.
+bool arith_log_base_discrete_log_u64(const arith_log_base_u64* base, const arith_u64 h, arith_u64* x);
+
+
+// Computes the smallest `x` with `g^x = h (mod p)` for the prime `p`, and stores it in `x`. Returns `false`, leaving
+// `x` untouched, if `h` is not a power of `g`, or under the conditions of `arith_log_base_init_u64()`. For many
+// logarithms to the same base, use `arith_log_base_init_u64()` and `arith_log_base_discrete_log_u64()` instead.
+bool arith_discrete_log_u64(const arith_u64 g, const arith_u64 h, const arith_u64 p, arith_u64* x);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_DISCRETE_LOG_H_
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_FIXED_BASE_H_
+#define ARITHMOS_NUMERIC_FIXED_BASE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// Precomputed powers of a fixed base modulo a fixed odd modulus, for raising that base to many exponents. The exponent
+// is split into digits of `width` bits, and the table holds `base^(d * 2^(width * j))` for every digit `d` and position
+// `j`, so that an exponentiation takes one multiplication per digit and no squarings. Initialize with
+// `arith_fixed_base_init_u64()`, free with `arith_fixed_base_free_u64()` and treat the fields as read-only.
+typedef struct arith_fixed_base_u64 {
+    arith_montgomery_u64 montgomery;  // Montgomery constants modulo the modulus `n`.
+    unsigned width;                   // The number of bits per digit.
+    unsigned positions;               // `ceil(64 / width)`, the number of digits of a 64-bit exponent.
+    arith_u64* table;                 // `table[j * 2^width + d] = base^(d * 2^(width * j)) * R (mod n)`.
+} arith_fixed_base_u64;
+
+
+// Initializes `fixed_base` for powers of `base` modulo `modulus`, with digits of `width` bits. Wider digits take fewer
+// multiplications per exponentiation, `ceil(64 / width)`, but a larger table, of `ceil(64 / width) * 2^(width + 3)`
+// bytes: `width = 8` takes 8 multiplications and 16 KiB. Beyond a width of about 12, the table outgrows the caches and
+// the lookups cost more than the multiplications they save. Returns `false` if `modulus` is even, if `width` is `0` or
+// larger than `16`, or if memory could not be allocated.
+bool arith_fixed_base_init_u64(arith_fixed_base_u64* fixed_base, const arith_u64 base, const arith_u64 modulus,
+                               const unsigned width);
+
+// Frees the table of `fixed_base`.
+void arith_fixed_base_free_u64(arith_fixed_base_u64* fixed_base);
+
+
+// Computes `base ^ exponent (mod modulus)` where `^` is exponentiation, for the base and modulus of `fixed_base`. If
+// both `base` and `exponent` are `0`, `base ^ exponent == 1`.
+arith_u64 arith_fixed_base_power_u64(const arith_fixed_base_u64* fixed_base, const arith_u64 exponent);
+
+// Computes `out[i] = base ^ exponent[i] (mod modulus)` for every `i < count`, where `^` is exponentiation, for the base
+// and modulus of `fixed_base`. `out` may alias `exponent`.
+void arith_fixed_base_power_u64_batch(const arith_fixed_base_u64* fixed_base, const arith_u64* exponent, arith_u64* out,
+                                      const size_t count);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_FIXED_BASE_H_
@@ -1,18 +1,26 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (C) 2026 Pieter te Brake
 
-#ifndef ARITHMOS_NUMBER_LCM_H_
-#define ARITHMOS_NUMBER_LCM_H_
+#ifndef ARITHMOS_NUMERIC_GCD_H_
+#define ARITHMOS_NUMERIC_GCD_H_
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+#include <stddef.h>
+
 #include "arithmos/core/types.h"
 
 
 
+#ifdef ARITHMOS_HEADER_ONLY
+
+#include "arithmos/arithmos_inline.h"
+
+#else
+
 // Computes the greatest common devisor (gcd) of `m` and `n`. If both `m`
 // and `n` are `0`, returns `0`. If `gcd(m, n)` is not representable as a
 // value of type `arith_i32`, the behaviour is undefined.
@@ -31,10 +39,104 @@ arith_u32 arith_gcd_u32(arith_u32 m, arith_u32 n);
 // are `0`, returns `0`.
 arith_u64 arith_gcd_u64(arith_u64 m, arith_u64 n);
 
+#endif  // #ifdef ARITHMOS_HEADER_ONLY
+
+
+// Computes the greatest common devisor `g` of `m` and `n`, and stores
+// coefficients in `x` and `y` such that `m * x + n * y = g`. These are the
+// coefficients of the extended Euclidean algorithm, so that
+// `|x| <= max(1, |n| / (2g))` and `|y| <= max(1, |m| / (2g))`. If `g` is not
+// representable as a value of type `arith_i32`, the behaviour is undefined.
+arith_i32 arith_xgcd_i32(const arith_i32 m, const arith_i32 n, arith_i32* x, arith_i32* y);
+
+// Computes the greatest common devisor `g` of `m` and `n`, and stores
+// coefficients in `x` and `y` such that `m * x + n * y = g`. These are the
+// coefficients of the extended Euclidean algorithm, so that
+// `|x| <= max(1, |n| / (2g))` and `|y| <= max(1, |m| / (2g))`. If `g` is not
+// representable as a value of type `arith_i64`, the behaviour is undefined.
+arith_i64 arith_xgcd_i64(const arith_i64 m, const arith_i64 n, arith_i64* x, arith_i64* y);
+
+// Computes the greatest common devisor `g` of `m` and `n`, and stores
+// coefficients in `x` and `y` such that `m * x + n * y = g`. These are the
+// coefficients of the extended Euclidean algorithm, so that
+// `|x| <= max(1, n / (2g))` and `|y| <= max(1, m / (2g))`.
+arith_u32 arith_xgcd_u32(arith_u32 m, arith_u32 n, arith_i32* x, arith_i32* y);
+
+// Computes the greatest common devisor `g` of `m` and `n`, and stores
+// coefficients in `x` and `y` such that `m * x + n * y = g`. These are the
+// coefficients of the extended Euclidean algorithm, so that
+// `|x| <= max(1, n / (2g))` and `|y| <= max(1, m / (2g))`. Unlike the
+// textbook algorithm, hardly any 64-bit divisions are used.
+arith_u64 arith_xgcd_u64(arith_u64 m, arith_u64 n, arith_i64* x, arith_i64* y);
+
+
+// Computes `out[i] = gcd(m[i], n[i])` for every `i < count`, processing
+// several pairs at once with SIMD instructions where available. `out` may
+// alias `m` or `n`.
+void arith_gcd_u32_batch(const arith_u32* m, const arith_u32* n, arith_u32* out, const size_t count);
+
+// Computes `out[i] = gcd(m[i], n[i])` for every `i < count`, processing
+// several pairs at once with SIMD instructions where available. `out` may
+// alias `m` or `n`.
+void arith_gcd_u64_batch(const arith_u64* m, const arith_u64* n, arith_u64* out, const size_t count);
+
+
+// Computes the greatest common devisor of `values[0], ..., values[count - 1]`,
+// or `0` if `count` is `0`. Returns as soon as the gcd is `1`. If the gcd is
+// not representable as a value of type `arith_i32`, the behaviour is
+// undefined.
+arith_i32 arith_gcd_i32_array(const arith_i32* values, const size_t count);
+
+// Computes the greatest common devisor of `values[0], ..., values[count - 1]`,
+// or `0` if `count` is `0`. Returns as soon as the gcd is `1`. If the gcd is
+// not representable as a value of type `arith_i64`, the behaviour is
+// undefined.
+arith_i64 arith_gcd_i64_array(const arith_i64* values, const size_t count);
+
+// Computes the greatest common devisor of `values[0], ..., values[count - 1]`,
+// or `0` if `count` is `0`. Returns as soon as the gcd is `1`.
+arith_u32 arith_gcd_u32_array(const arith_u32* values, const size_t count);
+
+// Computes the greatest common devisor of `values[0], ..., values[count - 1]`,
+// or `0` if `count` is `0`. Returns as soon as the gcd is `1`.
+arith_u64 arith_gcd_u64_array(const arith_u64* values, const size_t count);
+
+
+// Computes the Jacobi symbol `(a / n)`, which is `0`, `1` or `-1`. `n`
+// must be odd, otherwise the behaviour is undefined. Like the gcd, it is
+// computed without any divisions.
+int arith_jacobi_u64(const arith_u64 a, const arith_u64 n);
+
+// Computes the Jacobi symbol `(a / n)`, which is `0`, `1` or `-1`. `n`
+// must be positive and odd, otherwise the behaviour is undefined. Like the
+// gcd, it is computed without any divisions.
+int arith_jacobi_i64(const arith_i64 a, const arith_i64 n);
+
+// Computes the Kronecker symbol `(a / n)`, which is `0`, `1` or `-1`. It
+// extends the Jacobi symbol to all `n`, with `(a / 0) = 1` if `a` is `1`
+// or `-1` and `0` otherwise, `(a / -1) = -1` if `a < 0` and `1` otherwise,
+// and `(a / 2) = 0` if `a` is even, `1` if `a = 1, 7 (mod 8)` and `-1` if
+// `a = 3, 5 (mod 8)`.
+int arith_kronecker_i64(const arith_i64 a, const arith_i64 n);
+
+
+// Computes `out[i] = (a[i] / n[i])` for every `i < count`, where `(a / n)`
+// is the Jacobi symbol, processing several pairs at once with SIMD
+// instructions where available. Every `n[i]` must be odd.
+void arith_jacobi_u64_batch(const arith_u64* a, const arith_u64* n, int* out, const size_t count);
+
+// Computes `out[i] = (a[i] / n[i])` for every `i < count`, where `(a / n)`
+// is the Jacobi symbol. Every `n[i]` must be positive and odd.
+void arith_jacobi_i64_batch(const arith_i64* a, const arith_i64* n, int* out, const size_t count);
+
+// Computes `out[i] = (a[i] / n[i])` for every `i < count`, where `(a / n)`
+// is the Kronecker symbol.
+void arith_kronecker_i64_batch(const arith_i64* a, const arith_i64* n, int* out, const size_t count);
+
 
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif  // #ifndef ARITHMOS_NUMBER_LCM_H_
+#endif  // #ifndef ARITHMOS_NUMERIC_GCD_H_
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_INVERSE_H_
+#define ARITHMOS_NUMERIC_INVERSE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stddef.h>
+
+#include "arithmos/core/types.h"
+
+
+
+// Computes the inverse `x` of `a` modulo `modulus`, with `a * x = 1 (mod modulus)` and `0 <= x < modulus`. If `a` is
+// not invertible, that is, if `gcd(a, modulus) != 1`, returns `0`. `a` does not need to be reduced. If `modulus` is
+// `0`, the behaviour is undefined.
+arith_u32 arith_mod_inverse_u32(const arith_u32 a, const arith_u32 modulus);
+
+// Computes the inverse `x` of `a` modulo `modulus`, with `a * x = 1 (mod modulus)` and `0 <= x < modulus`. If `a` is
+// not invertible, that is, if `gcd(a, modulus) != 1`, returns `0`. `a` does not need to be reduced. If `modulus` is
+// `0`, the behaviour is undefined.
+arith_u64 arith_mod_inverse_u64(const arith_u64 a, const arith_u64 modulus);
+
+
+// Computes `out[i] = arith_mod_inverse_u64(a[i], modulus)` for every `i < count`. If all `a[i]` are invertible, this
+// takes a single inversion and `3 * (count - 1)` modular multiplications, which are Montgomery products for an odd
+// `modulus`. Otherwise, every element is inverted on its own. `out` must not overlap `a`. If `modulus` is `0`, the
+// behaviour is undefined.
+void arith_mod_inverse_u64_batch(const arith_u64* a, const arith_u64 modulus, arith_u64* out, const size_t count);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_INVERSE_H_
@@ -1,18 +1,27 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (C) 2026 Pieter te Brake
 
-#ifndef ARITHMOS_NUMBER_GCD_H_
-#define ARITHMOS_NUMBER_GCD_H_
+#ifndef ARITHMOS_NUMERIC_LCM_H_
+#define ARITHMOS_NUMERIC_LCM_H_
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #include "arithmos/core/types.h"
 
 
 
+#ifdef ARITHMOS_HEADER_ONLY
+
+#include "arithmos/arithmos_inline.h"
+
+#else
+
 // Computes least common multiple (lcm) of `m` and `n`. If `lcm(m, n)` is not representable
 // as a value of type `arith_i32`, the behaviour is undefined.
 arith_i32 arith_lcm_i32(const arith_i32 m, const arith_i32 n);
@@ -29,10 +38,37 @@ arith_u32 arith_lcm_u32(arith_u32 m, const arith_u32 n);
 // representable as a value of type `arith_u64`, returns `lcm(m, n) (mod ARITH_U64_MAX + 1)`.
 arith_u64 arith_lcm_u64(arith_u64 m, const arith_u64 n);
 
+#endif  // #ifdef ARITHMOS_HEADER_ONLY
+
+
+// Computes the least common multiple of `values[0], ..., values[count - 1]`,
+// or `1` if `count` is `0`. If the lcm is not representable as a value of
+// type `arith_i32`, returns `0`. Unless `overflow` is `NULL`, `*overflow` is set
+// to whether this is the case.
+arith_i32 arith_lcm_i32_array(const arith_i32* values, const size_t count, bool* overflow);
+
+// Computes the least common multiple of `values[0], ..., values[count - 1]`,
+// or `1` if `count` is `0`. If the lcm is not representable as a value of
+// type `arith_i64`, returns `0`. Unless `overflow` is `NULL`, `*overflow` is set
+// to whether this is the case.
+arith_i64 arith_lcm_i64_array(const arith_i64* values, const size_t count, bool* overflow);
+
+// Computes the least common multiple of `values[0], ..., values[count - 1]`,
+// or `1` if `count` is `0`. If the lcm is not representable as a value of
+// type `arith_u32`, returns `0`. Unless `overflow` is `NULL`, `*overflow` is set
+// to whether this is the case.
+arith_u32 arith_lcm_u32_array(const arith_u32* values, const size_t count, bool* overflow);
+
+// Computes the least common multiple of `values[0], ..., values[count - 1]`,
+// or `1` if `count` is `0`. If the lcm is not representable as a value of
+// type `arith_u64`, returns `0`. Unless `overflow` is `NULL`, `*overflow` is set
+// to whether this is the case.
+arith_u64 arith_lcm_u64_array(const arith_u64* values, const size_t count, bool* overflow);
+
 
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif  // #ifndef ARITHMOS_NUMBER_GCD_H_
+#endif  // #ifndef ARITHMOS_NUMERIC_LCM_H_
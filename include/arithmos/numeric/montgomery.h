@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_MONTGOMERY_H_
+#define ARITHMOS_NUMERIC_MONTGOMERY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "arithmos/core/types.h"
+
+
+
+// Precomputed constants for Montgomery arithmetic modulo a fixed odd `modulus`, with `R = 2^32`. Initialize with
+// `arith_montgomery_init_u32()` and treat the fields as read-only.
+typedef struct arith_montgomery_u32 {
+    arith_u32 modulus;    // The odd modulus `n`.
+    arith_u32 inverse;    // `n^-1 (mod R)`.
+    arith_u32 one;        // `R (mod n)`, the Montgomery form of `1`.
+    arith_u32 r_squared;  // `R^2 (mod n)`.
+} arith_montgomery_u32;
+
+// Precomputed constants for Montgomery arithmetic modulo a fixed odd `modulus`, with `R = 2^64`. Initialize with
+// `arith_montgomery_init_u64()` and treat the fields as read-only.
+typedef struct arith_montgomery_u64 {
+    arith_u64 modulus;    // The odd modulus `n`.
+    arith_u64 inverse;    // `n^-1 (mod R)`.
+    arith_u64 one;        // `R (mod n)`, the Montgomery form of `1`.
+    arith_u64 r_squared;  // `R^2 (mod n)`.
+} arith_montgomery_u64;
+
+
+// Initializes `montgomery` for arithmetic modulo `modulus`. If `modulus` is even, the behaviour is undefined.
+void arith_montgomery_init_u32(arith_montgomery_u32* montgomery, const arith_u32 modulus);
+
+// Initializes `montgomery` for arithmetic modulo `modulus`. If `modulus` is even, the behaviour is undefined.
+void arith_montgomery_init_u64(arith_montgomery_u64* montgomery, const arith_u64 modulus);
+
+
+// Converts `x` to Montgomery form, i.e. computes `x * R (mod modulus)`. `x` does not need to be reduced.
+arith_u32 arith_montgomery_to_mont_u32(const arith_montgomery_u32* montgomery, const arith_u32 x);
+
+// Converts `x` to Montgomery form, i.e. computes `x * R (mod modulus)`. `x` does not need to be reduced.
+arith_u64 arith_montgomery_to_mont_u64(const arith_montgomery_u64* montgomery, const arith_u64 x);
+
+// Converts `x` from Montgomery form, i.e. computes `x * R^-1 (mod modulus)`. `x` does not need to be reduced.
+arith_u32 arith_montgomery_from_mont_u32(const arith_montgomery_u32* montgomery, const arith_u32 x);
+
+// Converts `x` from Montgomery form, i.e. computes `x * R^-1 (mod modulus)`. `x` does not need to be reduced.
+arith_u64 arith_montgomery_from_mont_u64(const arith_montgomery_u64* montgomery, const arith_u64 x);
+
+
+// Computes the Montgomery product `multiplier * multiplicand * R^-1 (mod modulus)`. If both operands are in
+// Montgomery form, so is the result. If `multiplier` or `multiplicand` is not smaller than `modulus`, the behaviour is
+// undefined.
+arith_u32 arith_montgomery_mul_u32(const arith_montgomery_u32* montgomery, const arith_u32 multiplier,
+                                   const arith_u32 multiplicand);
+
+// Computes the Montgomery product `multiplier * multiplicand * R^-1 (mod modulus)`. If both operands are in
+// Montgomery form, so is the result. If `multiplier` or `multiplicand` is not smaller than `modulus`, the behaviour is
+// undefined.
+arith_u64 arith_montgomery_mul_u64(const arith_montgomery_u64* montgomery, const arith_u64 multiplier,
+                                   const arith_u64 multiplicand);
+
+
+// Computes `base ^ exponent (mod modulus)` where `^` is exponentiation. `base` and the result are in ordinary (not
+// Montgomery) form. If both `base` and `exponent` are `0`, `base ^ exponent == 1`.
+arith_u32 arith_montgomery_power_mod_u32(const arith_montgomery_u32* montgomery, const arith_u32 base,
+                                         arith_u32 exponent);
+
+// Computes `base ^ exponent (mod modulus)` where `^` is exponentiation. `base` and the result are in ordinary (not
+// Montgomery) form. If both `base` and `exponent` are `0`, `base ^ exponent == 1`.
+arith_u64 arith_montgomery_power_mod_u64(const arith_montgomery_u64* montgomery, const arith_u64 base,
+                                         arith_u64 exponent);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_MONTGOMERY_H_
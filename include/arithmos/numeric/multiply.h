@@ -13,6 +13,12 @@ extern "C" {
 
 
 
+#ifdef ARITHMOS_HEADER_ONLY
+
+#include "arithmos/arithmos_inline.h"
+
+#else
+
 // Computes `multiplier * multiplicand (mod modulus)`. If `modulus` is `0`, the behaviour is undefined.
 // If `multiplier * multiplicand (mod modulus)` is not representable as a value of `arith_i32`, the
 // behaviour is undefined (this case will not occur if `modulus <= ARITH_I32_MAX + 1`).
@@ -36,6 +42,8 @@ arith_i128 arith_multiply_i64(const arith_i64 multiplier, const arith_i64 multip
 // Computes `multiplier * multiplicand`, and returns it as an `arith_u128`.
 arith_u128 arith_multiply_u64(const arith_u64 multiplier, const arith_u64 multiplicand);
 
+#endif  // #ifdef ARITHMOS_HEADER_ONLY
+
 
 
 #ifdef __cplusplus
@@ -10,10 +10,19 @@ extern "C" {
 
 
 #include "arithmos/numeric/abs.h"
+#include "arithmos/numeric/barrett.h"
+#include "arithmos/numeric/bigint.h"
+#include "arithmos/numeric/discrete_log.h"
+#include "arithmos/numeric/fixed_base.h"
 #include "arithmos/numeric/gcd.h"
+#include "arithmos/numeric/inverse.h"
 #include "arithmos/numeric/lcm.h"
+#include "arithmos/numeric/montgomery.h"
 #include "arithmos/numeric/multiply.h"
 #include "arithmos/numeric/power.h"
+#include "arithmos/numeric/prime.h"
+#include "arithmos/numeric/root.h"
+#include "arithmos/numeric/sqrt_mod.h"
 
 
 #ifdef __cplusplus
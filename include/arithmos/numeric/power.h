@@ -9,6 +9,8 @@ extern "C" {
 #endif
 
 
+#include <stddef.h>
+
 #include "arithmos/core/types.h"
 
 
@@ -57,6 +59,21 @@ arith_u32 arith_power_mod_u32(const arith_u32 base, arith_u32 exponent, const ar
 arith_u64 arith_power_mod_u64(const arith_u64 base, arith_u64 exponent, const arith_u64 modulus);
 
 
+// Computes `out[i] = base[i] ^ exponent[i] (mod modulus[i])` for every `i < count`, where
+// `^` is exponentiation. The exponentiations are interleaved across SIMD lanes where
+// available. If any `modulus[i]` is `0`, the behaviour is undefined. `out` may alias any of
+// the inputs.
+void arith_power_mod_u32_batch(const arith_u32* base, const arith_u32* exponent, const arith_u32* modulus,
+                               arith_u32* out, const size_t count);
+
+// Computes `out[i] = base[i] ^ exponent[i] (mod modulus[i])` for every `i < count`, where
+// `^` is exponentiation. The exponentiations are interleaved across SIMD lanes if AVX-512
+// IFMA is available, for odd moduli smaller than `2^52`. If any `modulus[i]` is `0`, the
+// behaviour is undefined. `out` may alias any of the inputs.
+void arith_power_mod_u64_batch(const arith_u64* base, const arith_u64* exponent, const arith_u64* modulus,
+                               arith_u64* out, const size_t count);
+
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_ROOT_H_
+#define ARITHMOS_NUMERIC_ROOT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "arithmos/core/types.h"
+
+
+
+// Computes `floor(sqrt(n))`, exactly.
+arith_u64 arith_isqrt_u64(const arith_u64 n);
+
+// Computes `floor(n^(1 / k))`, the largest `r` with `r^k <= n`, exactly. If `k` is `0`, the behaviour is undefined.
+arith_u64 arith_iroot_u64(const arith_u64 n, const unsigned k);
+
+// Computes the largest `k` such that `n = r^k` for an integer `r`, and stores that `r` in `root` unless it is `NULL`.
+// `n` is a perfect power if `k >= 2`. Otherwise, and for `n < 4`, returns `1` and stores `n`.
+unsigned arith_perfect_power_u64(const arith_u64 n, arith_u64* root);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_ROOT_H_
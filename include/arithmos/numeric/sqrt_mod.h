@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_SQRT_MOD_H_
+#define ARITHMOS_NUMERIC_SQRT_MOD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdbool.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// Precomputed constants for square roots modulo a power `p^k` of a fixed odd prime `p`. All divisions are done by
+// `arith_sqrt_prime_init_u64()`, so that the square roots themselves only take multiplications. Treat the fields as
+// read-only.
+typedef struct arith_sqrt_prime_u64 {
+    arith_montgomery_u64 montgomery;        // Montgomery constants modulo `p`.
+    arith_montgomery_u64 power_montgomery;  // Montgomery constants modulo `p^k`.
+    arith_u64 max_quotient;                 // `floor((2^64 - 1) / p)`, to test for divisibility by `p`.
+    arith_u64 odd_part;                     // The odd `q` with `p - 1 = 2^s * q`.
+    arith_u64 root_of_unity;                // `z^q * R (mod p)` for a non-residue `z`, of order `2^s`, if `s >= 3`.
+    unsigned two_adicity;                   // `s`.
+    unsigned exponent;                      // `k`.
+} arith_sqrt_prime_u64;
+
+
+// Initializes `prime` for square roots modulo `p^k`. Returns `false` if `p` is even or `1`, if `k` is `0`, or if
+// `p^k` does not fit in an `arith_u64`. `p` must be prime: otherwise, this may return `false` as well, and if it does
+// not, the square roots are meaningless.
+bool arith_sqrt_prime_init_u64(arith_sqrt_prime_u64* prime, const arith_u64 p, const unsigned k);
+
+// Computes the smallest square root of `a` modulo `p^k` for the `p` and `k` of `prime`, and stores it in `root`.
+// Returns `false`, leaving `root` untouched, if `a` is not a square modulo `p^k`. `a` does not need to be reduced.
+bool arith_sqrt_prime_mod_u64(const arith_sqrt_prime_u64* prime, const arith_u64 a, arith_u64* root);
+
+
+// Computes the smallest square root of `a` modulo the odd prime `p`, and stores it in `root`. Returns `false`, leaving
+// `root` untouched, if `a` is not a square modulo `p` or if `p` is even or `1`. For many square roots modulo the same
+// prime, use `arith_sqrt_prime_init_u64()` and `arith_sqrt_prime_mod_u64()` instead.
+bool arith_sqrt_mod_u64(const arith_u64 a, const arith_u64 p, arith_u64* root);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // #ifndef ARITHMOS_NUMERIC_SQRT_MOD_H_
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algebra/ntt/ntt_internal.h"
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// If the shorter operand has at most this many values, the product is computed by schoolbook multiplication.
+#define NTT_SCHOOLBOOK_THRESHOLD 32
+
+
+
+// Stores the `count` values of `in` reduced to `[0, 2p)` in `out`.
+static void internal_ntt_load_u32(const arith_montgomery_u32* montgomery, const arith_u32* in, const size_t count,
+                                  arith_u32* out) {
+    // A Montgomery multiplication by `R (mod p)` reduces any 32-bit value without a division.
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    const __m256i modulus = _mm256_set1_epi32((int)montgomery->modulus);
+    const __m256i inverse = _mm256_set1_epi32((int)montgomery->inverse);
+    const __m256i one     = _mm256_set1_epi32((int)montgomery->one);
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256i x = _mm256_loadu_si256((const __m256i*)(in + i));
+        _mm256_storeu_si256((__m256i*)(out + i), internal_ntt_mul_u32x8(x, one, modulus, inverse));
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+    for (; i < count; ++i)
+        out[i] = internal_ntt_mul_u32(montgomery, in[i], montgomery->one);
+}
+
+// Computes the product of `a` and `b` by schoolbook multiplication, as arith_ntt_convolve_u32() does.
+static bool internal_ntt_convolve_schoolbook_u32(const arith_montgomery_u32* montgomery, const arith_u32* a,
+                                                 const size_t a_count, const arith_u32* b, const size_t b_count,
+                                                 arith_u32* out) {
+    // With the operands in `[0, 2p)`, a product is below `4p^2`. The sums are kept below `8p^2` by subtracting `8p^2`,
+    // so they stay below `12p^2 < 2^64`, and are reduced only once at the end.
+    const size_t out_count = a_count + b_count - 1;
+    const arith_u64 bound  = 8 * (arith_u64)montgomery->modulus * montgomery->modulus;
+
+    arith_u32* buffer = malloc((a_count + b_count + out_count) * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* reduced_a = buffer;
+    arith_u32* reduced_b = buffer + a_count;
+    arith_u32* product   = buffer + a_count + b_count;
+    internal_ntt_load_u32(montgomery, a, a_count, reduced_a);
+    internal_ntt_load_u32(montgomery, b, b_count, reduced_b);
+
+    for (size_t k = 0; k < out_count; ++k) {
+        const size_t first = (k >= b_count) ? k - b_count + 1 : 0;
+        const size_t last  = (k < a_count) ? k : a_count - 1;
+
+        arith_u64 sum = 0;
+        for (size_t i = first; i <= last; ++i) {
+            sum += (arith_u64)reduced_a[i] * reduced_b[k - i];
+            sum  = (sum >= bound) ? sum - bound : sum;
+        }
+
+        product[k] = (arith_u32)(sum % montgomery->modulus);
+    }
+
+    memcpy(out, product, out_count * sizeof(*out));
+    free(buffer);
+
+    return true;
+}
+
+
+extern bool ARITHMOS_DISPATCHED(arith_ntt_convolve_u32)(const arith_ntt_u32* ntt, const arith_u32* a,
+                                                        const size_t a_count, const arith_u32* b,
+                                                        const size_t b_count, arith_u32* out) {
+    // The operands are padded with zeros to the smallest power of 2 that holds the product, so that the cyclic
+    // convolution computed by the transforms equals the product. The transformed operands are multiplied value by
+    // value, and the inverse transform of the result gives the product. A square needs only one forward transform.
+
+    if (a_count == 0 || b_count == 0)
+        return true;
+
+    if (a_count <= NTT_SCHOOLBOOK_THRESHOLD || b_count <= NTT_SCHOOLBOOK_THRESHOLD)
+        return internal_ntt_convolve_schoolbook_u32(&ntt->montgomery, a, a_count, b, b_count, out);
+
+    const size_t out_count    = a_count + b_count - 1;
+    const unsigned log_length = internal_bsr_u64(out_count - 1) + 1;
+    if (log_length > ntt->max_log_length)
+        return false;
+
+    const size_t length  = (size_t)1 << log_length;
+    const bool is_square = (a == b && a_count == b_count);
+
+    arith_u32* transformed_a = malloc((is_square ? 1 : 2) * length * sizeof(*transformed_a));
+    if (transformed_a == NULL)
+        return false;
+
+    arith_u32* transformed_b = is_square ? transformed_a : transformed_a + length;
+
+    internal_ntt_load_u32(&ntt->montgomery, a, a_count, transformed_a);
+    memset(transformed_a + a_count, 0, (length - a_count) * sizeof(*transformed_a));
+    arith_ntt_forward_u32(ntt, transformed_a, log_length);
+
+    if (!is_square) {
+        internal_ntt_load_u32(&ntt->montgomery, b, b_count, transformed_b);
+        memset(transformed_b + b_count, 0, (length - b_count) * sizeof(*transformed_b));
+        arith_ntt_forward_u32(ntt, transformed_b, log_length);
+    }
+
+    arith_ntt_pointwise_mul_u32(ntt, transformed_a, transformed_b, transformed_a, length);
+    arith_ntt_inverse_u32(ntt, transformed_a, log_length);
+
+    memcpy(out, transformed_a, out_count * sizeof(*out));
+    free(transformed_a);
+
+    return true;
+}
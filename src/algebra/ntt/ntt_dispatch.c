@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_ntt_forward_u32,
+                           (const arith_ntt_u32* ntt, arith_u32* values, const unsigned log_length));
+ARITHMOS_DEFINE_DISPATCHER(void, arith_ntt_inverse_u32,
+                           (const arith_ntt_u32* ntt, arith_u32* values, const unsigned log_length));
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_ntt_pointwise_mul_u32,
+                           (const arith_ntt_u32* ntt, const arith_u32* a, const arith_u32* b, arith_u32* out,
+                            const size_t count));
+
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_ntt_convolve_u32,
+                           (const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count, const arith_u32* b,
+                            const size_t b_count, arith_u32* out));
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stddef.h>
+
+#include "algebra/ntt/ntt_internal.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// Runs the layers of half-lengths `2 * quarter` and `quarter` on the blocks of `4 * quarter` values of `values`.
+static void internal_ntt_forward_radix_4_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length,
+                                             const size_t quarter) {
+    // The outer layer pairs `x_j` with `x_(j + 2q)` and `x_(j + q)` with `x_(j + 3q)`, with the twiddle factors of
+    // order `4q`. The inner layer then pairs `x_j` with `x_(j + q)` and `x_(j + 2q)` with `x_(j + 3q)`, with the same
+    // twiddle factor of order `2q` for both.
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+    const arith_u32* outer_roots           = ntt->roots + 2 * quarter;
+    const arith_u32* inner_roots           = ntt->roots + quarter;
+
+    for (arith_u32* block = values; block != values + length; block += 4 * quarter) {
+        size_t j = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+        const __m256i modulus = _mm256_set1_epi32((int)montgomery->modulus);
+        const __m256i inverse = _mm256_set1_epi32((int)montgomery->inverse);
+
+        for (; j + 8 <= quarter; j += 8) {
+            __m256i x0 = _mm256_loadu_si256((const __m256i*)(block + j));
+            __m256i x1 = _mm256_loadu_si256((const __m256i*)(block + j + quarter));
+            __m256i x2 = _mm256_loadu_si256((const __m256i*)(block + j + 2 * quarter));
+            __m256i x3 = _mm256_loadu_si256((const __m256i*)(block + j + 3 * quarter));
+
+            const __m256i w0 = _mm256_loadu_si256((const __m256i*)(outer_roots + j));
+            const __m256i w1 = _mm256_loadu_si256((const __m256i*)(outer_roots + j + quarter));
+            const __m256i w2 = _mm256_loadu_si256((const __m256i*)(inner_roots + j));
+
+            internal_ntt_forward_butterfly_u32x8(&x0, &x2, w0, modulus, inverse);
+            internal_ntt_forward_butterfly_u32x8(&x1, &x3, w1, modulus, inverse);
+            internal_ntt_forward_butterfly_u32x8(&x0, &x1, w2, modulus, inverse);
+            internal_ntt_forward_butterfly_u32x8(&x2, &x3, w2, modulus, inverse);
+
+            _mm256_storeu_si256((__m256i*)(block + j), x0);
+            _mm256_storeu_si256((__m256i*)(block + j + quarter), x1);
+            _mm256_storeu_si256((__m256i*)(block + j + 2 * quarter), x2);
+            _mm256_storeu_si256((__m256i*)(block + j + 3 * quarter), x3);
+        }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+        for (; j < quarter; ++j) {
+            arith_u32 x0 = block[j];
+            arith_u32 x1 = block[j + quarter];
+            arith_u32 x2 = block[j + 2 * quarter];
+            arith_u32 x3 = block[j + 3 * quarter];
+
+            internal_ntt_forward_butterfly_u32(montgomery, &x0, &x2, outer_roots[j]);
+            internal_ntt_forward_butterfly_u32(montgomery, &x1, &x3, outer_roots[j + quarter]);
+            internal_ntt_forward_butterfly_u32(montgomery, &x0, &x1, inner_roots[j]);
+            internal_ntt_forward_butterfly_u32(montgomery, &x2, &x3, inner_roots[j]);
+
+            block[j]               = x0;
+            block[j + quarter]     = x1;
+            block[j + 2 * quarter] = x2;
+            block[j + 3 * quarter] = x3;
+        }
+    }
+}
+
+// Runs the layer of half-length `half` on the blocks of `2 * half` values of `values`.
+static void internal_ntt_forward_radix_2_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length,
+                                             const size_t half) {
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+    const arith_u32* roots                 = ntt->roots + half;
+
+    for (arith_u32* block = values; block != values + length; block += 2 * half) {
+        size_t j = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+        const __m256i modulus = _mm256_set1_epi32((int)montgomery->modulus);
+        const __m256i inverse = _mm256_set1_epi32((int)montgomery->inverse);
+
+        for (; j + 8 <= half; j += 8) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(block + j));
+            __m256i y = _mm256_loadu_si256((const __m256i*)(block + j + half));
+
+            internal_ntt_forward_butterfly_u32x8(&x, &y, _mm256_loadu_si256((const __m256i*)(roots + j)), modulus,
+                                                 inverse);
+
+            _mm256_storeu_si256((__m256i*)(block + j), x);
+            _mm256_storeu_si256((__m256i*)(block + j + half), y);
+        }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+        for (; j < half; ++j)
+            internal_ntt_forward_butterfly_u32(montgomery, &block[j], &block[j + half], roots[j]);
+    }
+}
+
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+// Runs the layers of half-lengths 4, 2 and 1 on `values`, and reduces the results to `[0, p)`. `length` must be a
+// multiple of 16.
+static void internal_ntt_forward_tail_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length) {
+    // See ntt_internal.h for the order of the values after each shuffle. The layer of half-length 1 has the twiddle
+    // factor 1, so it needs no multiplication.
+    const arith_u32* roots = ntt->roots;
+
+    const __m256i modulus     = _mm256_set1_epi32((int)ntt->montgomery.modulus);
+    const __m256i inverse     = _mm256_set1_epi32((int)ntt->montgomery.inverse);
+    const __m256i two_modulus = _mm256_add_epi32(modulus, modulus);
+    const __m256i w4          = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(roots + 4)));
+    const __m256i w2          = _mm256_set1_epi64x((long long)(((arith_u64)roots[3] << 32) | roots[2]));
+
+    for (arith_u32* block = values; block != values + length; block += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)block);
+        __m256i y = _mm256_loadu_si256((const __m256i*)(block + 8));
+
+        internal_ntt_swap_128_u32x8(&x, &y);
+        internal_ntt_forward_butterfly_u32x8(&x, &y, w4, modulus, inverse);
+        internal_ntt_swap_64_u32x8(&x, &y);
+        internal_ntt_forward_butterfly_u32x8(&x, &y, w2, modulus, inverse);
+        internal_ntt_swap_32_u32x8(&x, &y, true);
+
+        const __m256i sum        = _mm256_add_epi32(x, y);
+        const __m256i difference = _mm256_add_epi32(_mm256_sub_epi32(x, y), two_modulus);
+
+        x = internal_ntt_reduce_u32x8(internal_ntt_reduce_u32x8(sum, two_modulus), modulus);
+        y = internal_ntt_reduce_u32x8(internal_ntt_reduce_u32x8(difference, two_modulus), modulus);
+
+        internal_ntt_swap_32_u32x8(&x, &y, false);
+        internal_ntt_swap_64_u32x8(&x, &y);
+        internal_ntt_swap_128_u32x8(&x, &y);
+
+        _mm256_storeu_si256((__m256i*)block, x);
+        _mm256_storeu_si256((__m256i*)(block + 8), y);
+    }
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+
+// Computes the forward transform of the `length` values of `values`, which must be in `[0, 2p)`. The results are in
+// `[0, p)` if `length >= 16` and AVX2 is available, and in `[0, 2p)` otherwise.
+static void internal_ntt_forward_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length) {
+    if (length > NTT_BLOCK_LENGTH) {
+        internal_ntt_forward_radix_4_u32(ntt, values, length, length / 4);
+        for (size_t i = 0; i < length; i += length / 4)
+            internal_ntt_forward_u32(ntt, values + i, length / 4);
+
+        return;
+    }
+
+    size_t last_half = 1;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    if (length >= 16)
+        last_half = 8;
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+    size_t half = length / 2;
+    for (; half >= 2 * last_half; half /= 4)
+        internal_ntt_forward_radix_4_u32(ntt, values, length, half / 2);
+
+    if (half == last_half)
+        internal_ntt_forward_radix_2_u32(ntt, values, length, half);
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    if (last_half == 8)
+        internal_ntt_forward_tail_u32(ntt, values, length);
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+}
+
+
+extern void ARITHMOS_DISPATCHED(arith_ntt_forward_u32)(const arith_ntt_u32* ntt, arith_u32* values,
+                                                       const unsigned log_length) {
+    // This is the decimation-in-frequency transform of Gentleman and Sande, which takes its input in natural order and
+    // leaves its output in bit-reversed order, so no reordering pass is needed.
+    const size_t length = (size_t)1 << log_length;
+
+    internal_ntt_forward_u32(ntt, values, length);
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    if (length >= 16)
+        return;
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+    for (size_t i = 0; i < length; ++i)
+        values[i] = internal_ntt_reduce_u32(values[i], ntt->montgomery.modulus);
+}
@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+
+extern void arith_ntt_free_u32(arith_ntt_u32* ntt) {
+    // Both tables share the allocation of `roots`.
+    free(ntt->roots);
+
+    ntt->roots         = NULL;
+    ntt->inverse_roots = NULL;
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "bit_operations.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+// Fills the `length` entries of `table` with the powers of `root`, which has order `length`, as described for
+// `arith_ntt_u32::roots`. `root` is in Montgomery form.
+static void internal_ntt_fill_roots_u32(const arith_montgomery_u32* montgomery, arith_u32* table, const size_t length,
+                                        const arith_u32 root) {
+    // The powers of `root` form the last level `h = length / 2`. Since the root of order `2h` is the square of the one
+    // of order `4h`, every other level takes every second entry of the level above it.
+    table[0] = montgomery->one;
+    if (length == 1)
+        return;
+
+    arith_u32 power = montgomery->one;
+    for (size_t j = 0; j < length / 2; ++j) {
+        table[length / 2 + j] = power;
+        power                 = internal_montgomery_mul_u32(montgomery, power, root);
+    }
+
+    for (size_t half = length / 4; half > 0; half /= 2) {
+        for (size_t j = 0; j < half; ++j)
+            table[half + j] = table[2 * half + 2 * j];
+    }
+}
+
+
+extern bool arith_ntt_init_u32(arith_ntt_u32* ntt, const arith_u32 modulus, const unsigned max_log_length) {
+    if (modulus < 3 || modulus >= (1U << 30) || (modulus & 1) == 0
+        || max_log_length > internal_bsf_u32(modulus - 1) || !arith_is_prime_u32(modulus))
+        return false;
+
+    arith_montgomery_init_u32(&ntt->montgomery, modulus);
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+
+    // A quadratic non-residue `c` has `c^((p - 1) / 2) = -1`. Hence `w = c^((p - 1) / 2^k)` has `w^(2^(k - 1)) = -1`,
+    // and its order is exactly `2^k`. Half of the residues are non-residues, so the search ends quickly.
+    const arith_u32 minus_one = modulus - montgomery->one;
+
+    arith_u32 candidate   = 2;
+    arith_u32 non_residue = internal_montgomery_to_mont_u32(montgomery, candidate);
+    while (internal_montgomery_power_u32(montgomery, non_residue, (modulus - 1) / 2) != minus_one)
+        non_residue = internal_montgomery_to_mont_u32(montgomery, ++candidate);
+
+    const size_t length = (size_t)1 << max_log_length;
+
+    arith_u32* roots = malloc(2 * length * sizeof(*roots));
+    if (roots == NULL)
+        return false;
+
+    const arith_u32 root = internal_montgomery_power_u32(montgomery, non_residue, (modulus - 1) >> max_log_length);
+
+    ntt->max_log_length = max_log_length;
+    ntt->roots          = roots;
+    ntt->inverse_roots  = roots + length;
+    internal_ntt_fill_roots_u32(montgomery, ntt->roots, length, root);
+
+    // The inverse of `w` is `w^(2^k - 1)`.
+    internal_ntt_fill_roots_u32(montgomery, ntt->inverse_roots, length,
+                                internal_montgomery_power_u32(montgomery, root, (arith_u32)(length - 1)));
+
+    return true;
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_ALGEBRA_NTT_INTERNAL_H_
+#define ARITHMOS_ALGEBRA_NTT_INTERNAL_H_
+
+
+#include <stdbool.h>
+
+#include "cpu_features.h"
+#include "inline.h"
+
+#if ARITHMOS_CPU_HAS_AVX2
+#    include <immintrin.h>
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// The transforms keep their values lazily reduced in `[0, 2p)`, which is possible since `4p < 2^32` for `p < 2^30`.
+// The twiddle factors are in Montgomery form, so a Montgomery multiplication by one of them leaves a value in ordinary
+// form, and its result in `(0, 2p)` needs no correction. Each butterfly therefore costs a single multiplication and two
+// conditional subtractions of `2p`, and the values are fully reduced only once at the end.
+//
+// Transforms longer than `NTT_BLOCK_LENGTH` are split: the two outermost layers are done over the whole array, after
+// which each quarter is transformed on its own. Once a quarter is no longer than `NTT_BLOCK_LENGTH`, all its remaining
+// layers run while it is in the cache.
+
+
+#define NTT_BLOCK_LENGTH 4096
+
+
+
+// Computes `a * w * R^-1 (mod p)` as a value in `(0, 2p)`. If `a * w >= p * R`, the behaviour is undefined.
+static INLINE arith_u32 internal_ntt_mul_u32(const arith_montgomery_u32* montgomery, const arith_u32 a,
+                                             const arith_u32 w) {
+    // The subtractive Montgomery reduction of internal_montgomery_reduce_u32(), where the difference in `(-p, p)` is
+    // always corrected by adding `p`.
+    const arith_u64 product  = (arith_u64)a * w;
+    const arith_u32 quotient = (arith_u32)product * montgomery->inverse;
+    const arith_u32 qp_high  = (arith_u32)(((arith_u64)quotient * montgomery->modulus) >> 32);
+
+    return (arith_u32)(product >> 32) - qp_high + montgomery->modulus;
+}
+
+// Returns `x - bound` if `x >= bound`, and `x` otherwise.
+static INLINE arith_u32 internal_ntt_reduce_u32(const arith_u32 x, const arith_u32 bound) {
+    return (x >= bound) ? x - bound : x;
+}
+
+// The butterfly of the forward transform, which maps `(x, y)` to `(x + y, (x - y) * w * R^-1)`.
+static INLINE void internal_ntt_forward_butterfly_u32(const arith_montgomery_u32* montgomery, arith_u32* x,
+                                                      arith_u32* y, const arith_u32 w) {
+    const arith_u32 two_modulus = 2 * montgomery->modulus;
+    const arith_u32 sum         = *x + *y;
+
+    *y = internal_ntt_mul_u32(montgomery, *x - *y + two_modulus, w);
+    *x = internal_ntt_reduce_u32(sum, two_modulus);
+}
+
+// The butterfly of the inverse transform, which maps `(x, y)` to `(x + y * w * R^-1, x - y * w * R^-1)`.
+static INLINE void internal_ntt_inverse_butterfly_u32(const arith_montgomery_u32* montgomery, arith_u32* x,
+                                                      arith_u32* y, const arith_u32 w) {
+    const arith_u32 two_modulus = 2 * montgomery->modulus;
+    const arith_u32 t           = internal_ntt_mul_u32(montgomery, *y, w);
+
+    *y = internal_ntt_reduce_u32(*x - t + two_modulus, two_modulus);
+    *x = internal_ntt_reduce_u32(*x + t, two_modulus);
+}
+
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+// Computes internal_ntt_mul_u32() for each 32-bit lane of `a` and `w`. `modulus` and `inverse` hold `p` and
+// `p^-1 (mod R)` in every lane.
+static INLINE __m256i internal_ntt_mul_u32x8(const __m256i a, const __m256i w, const __m256i modulus,
+                                             const __m256i inverse) {
+    // _mm256_mul_epu32() multiplies the even lanes into 64-bit products, so the odd lanes are moved down first. The
+    // high halves of the even products are moved down again, after which both halves are merged by a blend. The moves
+    // are shuffles instead of shifts, since these do not compete with the multiplications for execution ports.
+    const __m256i product_even  = _mm256_mul_epu32(a, w);
+    const __m256i product_odd   = _mm256_mul_epu32(_mm256_shuffle_epi32(a, 0xF5), _mm256_shuffle_epi32(w, 0xF5));
+    const __m256i quotient_even = _mm256_mul_epu32(product_even, inverse);
+    const __m256i quotient_odd  = _mm256_mul_epu32(product_odd, inverse);
+    const __m256i qp_even       = _mm256_mul_epu32(quotient_even, modulus);
+    const __m256i qp_odd        = _mm256_mul_epu32(quotient_odd, modulus);
+
+    const __m256i product_high = _mm256_blend_epi32(_mm256_shuffle_epi32(product_even, 0xF5), product_odd, 0xAA);
+    const __m256i qp_high      = _mm256_blend_epi32(_mm256_shuffle_epi32(qp_even, 0xF5), qp_odd, 0xAA);
+
+    return _mm256_add_epi32(_mm256_sub_epi32(product_high, qp_high), modulus);
+}
+
+// Computes internal_ntt_reduce_u32() for each 32-bit lane of `x`, with `bound` in every lane.
+static INLINE __m256i internal_ntt_reduce_u32x8(const __m256i x, const __m256i bound) {
+    // If `x < bound`, the difference wraps around and is larger than `x`.
+    return _mm256_min_epu32(x, _mm256_sub_epi32(x, bound));
+}
+
+// Computes internal_ntt_forward_butterfly_u32() for each 32-bit lane of `x`, `y` and `w`.
+static INLINE void internal_ntt_forward_butterfly_u32x8(__m256i* x, __m256i* y, const __m256i w,
+                                                        const __m256i modulus, const __m256i inverse) {
+    const __m256i two_modulus = _mm256_add_epi32(modulus, modulus);
+    const __m256i sum         = _mm256_add_epi32(*x, *y);
+    const __m256i difference  = _mm256_add_epi32(_mm256_sub_epi32(*x, *y), two_modulus);
+
+    *y = internal_ntt_mul_u32x8(difference, w, modulus, inverse);
+    *x = internal_ntt_reduce_u32x8(sum, two_modulus);
+}
+
+// Computes internal_ntt_inverse_butterfly_u32() for each 32-bit lane of `x`, `y` and `w`.
+static INLINE void internal_ntt_inverse_butterfly_u32x8(__m256i* x, __m256i* y, const __m256i w,
+                                                        const __m256i modulus, const __m256i inverse) {
+    const __m256i two_modulus = _mm256_add_epi32(modulus, modulus);
+    const __m256i t           = internal_ntt_mul_u32x8(*y, w, modulus, inverse);
+
+    *y = internal_ntt_reduce_u32x8(_mm256_add_epi32(_mm256_sub_epi32(*x, t), two_modulus), two_modulus);
+    *x = internal_ntt_reduce_u32x8(_mm256_add_epi32(*x, t), two_modulus);
+}
+
+
+// The last three layers of a transform pair values at distances 4, 2 and 1, which lie in the same vector. They are
+// done on blocks of 16 values `x_0, ..., x_15`, held in two vectors. The shuffles below regroup them such that the
+// pairs of a layer are in the same lanes of both vectors, and undoing them in reverse order restores the block:
+//
+//  - internal_ntt_swap_128_u32x8() pairs distance 4: `(x_0-x_3, x_8-x_11)` and `(x_4-x_7, x_12-x_15)`.
+//  - internal_ntt_swap_64_u32x8() then pairs distance 2: `(x_0, x_1, x_4, x_5, ...)` and `(x_2, x_3, x_6, x_7, ...)`.
+//  - internal_ntt_swap_32_u32x8() then pairs distance 1: `(x_0, x_4, x_2, x_6, ...)` and `(x_1, x_5, x_3, x_7, ...)`.
+
+// Exchanges the high 128 bits of `x` with the low 128 bits of `y`. This is its own inverse.
+static INLINE void internal_ntt_swap_128_u32x8(__m256i* x, __m256i* y) {
+    const __m256i low = _mm256_permute2x128_si256(*x, *y, 0x20);
+    *y                = _mm256_permute2x128_si256(*x, *y, 0x31);
+    *x                = low;
+}
+
+// Exchanges the odd 64-bit lanes of `x` with the even 64-bit lanes of `y`. This is its own inverse.
+static INLINE void internal_ntt_swap_64_u32x8(__m256i* x, __m256i* y) {
+    const __m256i low = _mm256_unpacklo_epi64(*x, *y);
+    *y                = _mm256_unpackhi_epi64(*x, *y);
+    *x                = low;
+}
+
+// Gathers the even 32-bit lanes of `x` and `y` in `x`, and the odd ones in `y`, if `forward`. Otherwise, undoes this.
+static INLINE void internal_ntt_swap_32_u32x8(__m256i* x, __m256i* y, const bool forward) {
+    if (forward) {
+        const __m256 even = _mm256_shuffle_ps(_mm256_castsi256_ps(*x), _mm256_castsi256_ps(*y), 0x88);
+        const __m256 odd  = _mm256_shuffle_ps(_mm256_castsi256_ps(*x), _mm256_castsi256_ps(*y), 0xDD);
+        *x                = _mm256_castps_si256(even);
+        *y                = _mm256_castps_si256(odd);
+    } else {
+        const __m256i low = _mm256_unpacklo_epi32(*x, *y);
+        *y                = _mm256_unpackhi_epi32(*x, *y);
+        *x                = low;
+    }
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+
+
+#endif  // #ifndef ARITHMOS_ALGEBRA_NTT_INTERNAL_H_
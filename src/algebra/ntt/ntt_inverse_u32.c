@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stddef.h>
+
+#include "algebra/ntt/ntt_internal.h"
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// Runs the layers of half-lengths `quarter` and `2 * quarter` on the blocks of `4 * quarter` values of `values`.
+static void internal_ntt_inverse_radix_4_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length,
+                                             const size_t quarter) {
+    // The layers of internal_ntt_forward_radix_4_u32() in reverse order.
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+    const arith_u32* outer_roots           = ntt->inverse_roots + 2 * quarter;
+    const arith_u32* inner_roots           = ntt->inverse_roots + quarter;
+
+    for (arith_u32* block = values; block != values + length; block += 4 * quarter) {
+        size_t j = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+        const __m256i modulus = _mm256_set1_epi32((int)montgomery->modulus);
+        const __m256i inverse = _mm256_set1_epi32((int)montgomery->inverse);
+
+        for (; j + 8 <= quarter; j += 8) {
+            __m256i x0 = _mm256_loadu_si256((const __m256i*)(block + j));
+            __m256i x1 = _mm256_loadu_si256((const __m256i*)(block + j + quarter));
+            __m256i x2 = _mm256_loadu_si256((const __m256i*)(block + j + 2 * quarter));
+            __m256i x3 = _mm256_loadu_si256((const __m256i*)(block + j + 3 * quarter));
+
+            const __m256i w0 = _mm256_loadu_si256((const __m256i*)(outer_roots + j));
+            const __m256i w1 = _mm256_loadu_si256((const __m256i*)(outer_roots + j + quarter));
+            const __m256i w2 = _mm256_loadu_si256((const __m256i*)(inner_roots + j));
+
+            internal_ntt_inverse_butterfly_u32x8(&x0, &x1, w2, modulus, inverse);
+            internal_ntt_inverse_butterfly_u32x8(&x2, &x3, w2, modulus, inverse);
+            internal_ntt_inverse_butterfly_u32x8(&x0, &x2, w0, modulus, inverse);
+            internal_ntt_inverse_butterfly_u32x8(&x1, &x3, w1, modulus, inverse);
+
+            _mm256_storeu_si256((__m256i*)(block + j), x0);
+            _mm256_storeu_si256((__m256i*)(block + j + quarter), x1);
+            _mm256_storeu_si256((__m256i*)(block + j + 2 * quarter), x2);
+            _mm256_storeu_si256((__m256i*)(block + j + 3 * quarter), x3);
+        }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+        for (; j < quarter; ++j) {
+            arith_u32 x0 = block[j];
+            arith_u32 x1 = block[j + quarter];
+            arith_u32 x2 = block[j + 2 * quarter];
+            arith_u32 x3 = block[j + 3 * quarter];
+
+            internal_ntt_inverse_butterfly_u32(montgomery, &x0, &x1, inner_roots[j]);
+            internal_ntt_inverse_butterfly_u32(montgomery, &x2, &x3, inner_roots[j]);
+            internal_ntt_inverse_butterfly_u32(montgomery, &x0, &x2, outer_roots[j]);
+            internal_ntt_inverse_butterfly_u32(montgomery, &x1, &x3, outer_roots[j + quarter]);
+
+            block[j]               = x0;
+            block[j + quarter]     = x1;
+            block[j + 2 * quarter] = x2;
+            block[j + 3 * quarter] = x3;
+        }
+    }
+}
+
+// Runs the layer of half-length `half` on the blocks of `2 * half` values of `values`.
+static void internal_ntt_inverse_radix_2_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length,
+                                             const size_t half) {
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+    const arith_u32* roots                 = ntt->inverse_roots + half;
+
+    for (arith_u32* block = values; block != values + length; block += 2 * half) {
+        size_t j = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+        const __m256i modulus = _mm256_set1_epi32((int)montgomery->modulus);
+        const __m256i inverse = _mm256_set1_epi32((int)montgomery->inverse);
+
+        for (; j + 8 <= half; j += 8) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(block + j));
+            __m256i y = _mm256_loadu_si256((const __m256i*)(block + j + half));
+
+            internal_ntt_inverse_butterfly_u32x8(&x, &y, _mm256_loadu_si256((const __m256i*)(roots + j)), modulus,
+                                                 inverse);
+
+            _mm256_storeu_si256((__m256i*)(block + j), x);
+            _mm256_storeu_si256((__m256i*)(block + j + half), y);
+        }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+        for (; j < half; ++j)
+            internal_ntt_inverse_butterfly_u32(montgomery, &block[j], &block[j + half], roots[j]);
+    }
+}
+
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+// Runs the layers of half-lengths 1, 2 and 4 on `values`. `length` must be a multiple of 16.
+static void internal_ntt_inverse_tail_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length) {
+    // See internal_ntt_forward_tail_u32().
+    const arith_u32* roots = ntt->inverse_roots;
+
+    const __m256i modulus     = _mm256_set1_epi32((int)ntt->montgomery.modulus);
+    const __m256i inverse     = _mm256_set1_epi32((int)ntt->montgomery.inverse);
+    const __m256i two_modulus = _mm256_add_epi32(modulus, modulus);
+    const __m256i w4          = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(roots + 4)));
+    const __m256i w2          = _mm256_set1_epi64x((long long)(((arith_u64)roots[3] << 32) | roots[2]));
+
+    for (arith_u32* block = values; block != values + length; block += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)block);
+        __m256i y = _mm256_loadu_si256((const __m256i*)(block + 8));
+
+        internal_ntt_swap_128_u32x8(&x, &y);
+        internal_ntt_swap_64_u32x8(&x, &y);
+        internal_ntt_swap_32_u32x8(&x, &y, true);
+
+        const __m256i sum        = _mm256_add_epi32(x, y);
+        const __m256i difference = _mm256_add_epi32(_mm256_sub_epi32(x, y), two_modulus);
+        x                        = internal_ntt_reduce_u32x8(sum, two_modulus);
+        y                        = internal_ntt_reduce_u32x8(difference, two_modulus);
+
+        internal_ntt_swap_32_u32x8(&x, &y, false);
+        internal_ntt_inverse_butterfly_u32x8(&x, &y, w2, modulus, inverse);
+        internal_ntt_swap_64_u32x8(&x, &y);
+        internal_ntt_inverse_butterfly_u32x8(&x, &y, w4, modulus, inverse);
+        internal_ntt_swap_128_u32x8(&x, &y);
+
+        _mm256_storeu_si256((__m256i*)block, x);
+        _mm256_storeu_si256((__m256i*)(block + 8), y);
+    }
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+
+// Computes the unscaled inverse transform of the `length` values of `values`, which must be in `[0, 2p)`. The results
+// are in `[0, 2p)`.
+static void internal_ntt_inverse_u32(const arith_ntt_u32* ntt, arith_u32* values, const size_t length) {
+    if (length > NTT_BLOCK_LENGTH) {
+        for (size_t i = 0; i < length; i += length / 4)
+            internal_ntt_inverse_u32(ntt, values + i, length / 4);
+        internal_ntt_inverse_radix_4_u32(ntt, values, length, length / 4);
+
+        return;
+    }
+
+    size_t half = 1;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    if (length >= 16) {
+        internal_ntt_inverse_tail_u32(ntt, values, length);
+        half = 8;
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+    // The layers of half-lengths `half, ..., length / 2` are done in pairs, after a single one if their number is odd.
+    if (half < length && (internal_bsf_u64(length / half) & 1) == 1) {
+        internal_ntt_inverse_radix_2_u32(ntt, values, length, half);
+        half *= 2;
+    }
+
+    for (; half < length; half *= 4)
+        internal_ntt_inverse_radix_4_u32(ntt, values, length, half);
+}
+
+
+extern void ARITHMOS_DISPATCHED(arith_ntt_inverse_u32)(const arith_ntt_u32* ntt, arith_u32* values,
+                                                       const unsigned log_length) {
+    // This is the decimation-in-time transform of Cooley and Tukey with the inverse twiddle factors, which undoes
+    // arith_ntt_forward_u32() layer by layer up to a factor 2 per layer. The factor `2^-log_length` is applied by a
+    // Montgomery multiplication with `2^-log_length * R (mod p)`, which also reduces the results to `[0, p)`.
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+    const size_t length                    = (size_t)1 << log_length;
+
+    internal_ntt_inverse_u32(ntt, values, length);
+
+    // Since `2^log_length` divides `p - 1`, `2^-log_length = p - (p - 1) / 2^log_length (mod p)`.
+    const arith_u32 length_inverse = montgomery->modulus - ((montgomery->modulus - 1) >> log_length);
+    const arith_u32 scale          = internal_ntt_mul_u32(montgomery, length_inverse, montgomery->r_squared);
+
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    const __m256i modulus = _mm256_set1_epi32((int)montgomery->modulus);
+    const __m256i inverse = _mm256_set1_epi32((int)montgomery->inverse);
+    const __m256i factor  = _mm256_set1_epi32((int)scale);
+
+    for (; i + 8 <= length; i += 8) {
+        const __m256i x = _mm256_loadu_si256((const __m256i*)(values + i));
+        _mm256_storeu_si256((__m256i*)(values + i),
+                            internal_ntt_reduce_u32x8(internal_ntt_mul_u32x8(x, factor, modulus, inverse), modulus));
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+    for (; i < length; ++i)
+        values[i] = internal_ntt_reduce_u32(internal_ntt_mul_u32(montgomery, values[i], scale), montgomery->modulus);
+}
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/ntt.h"
+
+#include <stddef.h>
+
+#include "algebra/ntt/ntt_internal.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+extern void ARITHMOS_DISPATCHED(arith_ntt_pointwise_mul_u32)(const arith_ntt_u32* ntt, const arith_u32* a,
+                                                             const arith_u32* b, arith_u32* out, const size_t count) {
+    // The Montgomery product `a * b * R^-1` is multiplied by `R^2` in Montgomery form, which gives `a * b` in ordinary
+    // form at the cost of a second multiplication but without a division.
+    const arith_montgomery_u32* montgomery = &ntt->montgomery;
+
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX2
+
+    const __m256i modulus   = _mm256_set1_epi32((int)montgomery->modulus);
+    const __m256i inverse   = _mm256_set1_epi32((int)montgomery->inverse);
+    const __m256i r_squared = _mm256_set1_epi32((int)montgomery->r_squared);
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        const __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+
+        const __m256i product = internal_ntt_mul_u32x8(internal_ntt_mul_u32x8(x, y, modulus, inverse), r_squared,
+                                                       modulus, inverse);
+        _mm256_storeu_si256((__m256i*)(out + i), internal_ntt_reduce_u32x8(product, modulus));
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+    for (; i < count; ++i) {
+        const arith_u32 product = internal_ntt_mul_u32(montgomery, internal_ntt_mul_u32(montgomery, a[i], b[i]),
+                                                       montgomery->r_squared);
+        out[i]                  = internal_ntt_reduce_u32(product, montgomery->modulus);
+    }
+}
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "algebra/poly/poly_internal.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bit_operations.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern void internal_poly_inverse_step_u32(const arith_ntt_u32* ntt, const arith_u32* transformed_a, arith_u32* g,
+                                           const size_t half, const unsigned log_length, arith_u32* work) {
+    // The step is `g <- g + g (1 - a g) (mod x^(2 half))`. Since `a g = 1 (mod x^half)`, only the coefficients
+    // `half, ..., 2 half - 1` of `a g` are needed, and the cyclic product of length `2 half` has them right: the part
+    // of degree `2 half` and more only wraps around onto the lower half. The same holds for the product of that upper
+    // half with `g`. The transform of `g` is used for both products.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const size_t length     = 2 * half;
+
+    arith_u32* transformed_g = work;
+    arith_u32* product       = work + length;
+
+    internal_poly_transform_u32(ntt, g, half, log_length, transformed_g);
+
+    arith_ntt_pointwise_mul_u32(ntt, transformed_a, transformed_g, product, length);
+    arith_ntt_inverse_u32(ntt, product, log_length);
+
+    memset(product, 0, half * sizeof(*product));
+    arith_ntt_forward_u32(ntt, product, log_length);
+    arith_ntt_pointwise_mul_u32(ntt, product, transformed_g, product, length);
+    arith_ntt_inverse_u32(ntt, product, log_length);
+
+    for (size_t i = half; i < length; ++i)
+        g[i] = (product[i] == 0) ? 0 : modulus - product[i];
+}
+
+// Does the same as internal_poly_inverse_step_u32() with two ordinary products, for when the NTT tables are too short.
+// `work` must have room for `5 * half` values. Returns `false` if memory could not be allocated.
+static bool internal_poly_newton_step_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                          arith_u32* g, const size_t half, arith_u32* work) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const size_t count      = (a_count < 2 * half) ? a_count : 2 * half;
+
+    // The product has `count + half - 1 < 3 half` coefficients, of which `half, ..., 2 half - 1` are kept.
+    if (!internal_poly_mul_u32(ntt, a, count, g, half, work))
+        return false;
+
+    const size_t upper_count = (count > 1) ? count - 1 : 0;
+    if (upper_count < half)
+        memset(work + half + upper_count, 0, (half - upper_count) * sizeof(*work));
+
+    if (!internal_poly_mul_u32(ntt, work + half, half, g, half, work + 3 * half - 1))
+        return false;
+
+    for (size_t i = 0; i < half; ++i)
+        g[half + i] = (work[3 * half - 1 + i] == 0) ? 0 : modulus - work[3 * half - 1 + i];
+
+    return true;
+}
+
+
+extern bool internal_poly_inverse_series_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                             const size_t count, arith_u32* out) {
+    // The first terms follow from `sum_j a_j g_(i - j) = 0` for `i > 0`, and the Newton iteration doubles the number of
+    // correct terms per step until there are at least `count`.
+    const arith_u32 modulus  = ntt->montgomery.modulus;
+    const arith_u32 inverse  = internal_mod_inverse_u32(a[0], modulus);
+    const arith_u64 bound    = 8 * (arith_u64)modulus * modulus;
+    const size_t first_count = (count < POLY_SERIES_THRESHOLD) ? count : POLY_SERIES_THRESHOLD;
+
+    for (size_t i = 0; i < first_count; ++i) {
+        arith_u64 sum = (i == 0) ? modulus - 1 : 0;
+        for (size_t j = 1; j <= i && j < a_count; ++j) {
+            sum += (arith_u64)a[j] * out[i - j];
+            sum  = (sum >= bound) ? sum - bound : sum;
+        }
+
+        const arith_u32 reduced = (arith_u32)(sum % modulus);
+        out[i]                  = internal_mod_mul_u32((reduced == 0) ? 0 : modulus - reduced, inverse, modulus);
+    }
+
+    if (count <= first_count)
+        return true;
+
+    size_t length = first_count;
+    while (length < count)
+        length *= 2;
+
+    arith_u32* buffer = malloc(4 * length * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* g    = buffer;
+    arith_u32* work = buffer + length;
+    memcpy(g, out, first_count * sizeof(*g));
+
+    bool success = true;
+    for (size_t half = first_count; half < count && success; half *= 2) {
+        const unsigned log_length = internal_bsr_u64(half) + 1;
+        if (log_length <= ntt->max_log_length) {
+            internal_poly_transform_u32(ntt, a, a_count, log_length, work);
+            internal_poly_inverse_step_u32(ntt, work, g, half, log_length, work + 2 * half);
+        } else
+            success = internal_poly_newton_step_u32(ntt, a, a_count, g, half, work);
+    }
+
+    if (success)
+        memcpy(out, g, count * sizeof(*out));
+    free(buffer);
+
+    return success;
+}
+
+
+// Divides `a` by `b` as internal_poly_divrem_u32() does, by long division.
+static bool internal_poly_long_division_u32(const arith_u32 modulus, const arith_u32* a, const size_t a_count,
+                                            const arith_u32* b, const size_t b_count, arith_u32* quotient,
+                                            arith_u32* remainder) {
+    arith_u32* rest = malloc(a_count * sizeof(*rest));
+    if (rest == NULL)
+        return false;
+
+    memcpy(rest, a, a_count * sizeof(*rest));
+
+    const arith_u32 inverse = internal_mod_inverse_u32(b[b_count - 1], modulus);
+    for (size_t i = a_count - b_count + 1; i-- > 0;) {
+        const arith_u32 factor = internal_mod_mul_u32(rest[i + b_count - 1], inverse, modulus);
+        if (quotient != NULL)
+            quotient[i] = factor;
+        if (factor == 0)
+            continue;
+
+        const arith_u32 negated = modulus - factor;
+        for (size_t k = 0; k < b_count - 1; ++k)
+            rest[i + k] = (arith_u32)((rest[i + k] + (arith_u64)negated * b[k]) % modulus);
+    }
+
+    if (remainder != NULL)
+        memcpy(remainder, rest, (b_count - 1) * sizeof(*remainder));
+    free(rest);
+
+    return true;
+}
+
+
+extern bool internal_poly_divrem_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                     const arith_u32* b, const size_t b_count, arith_u32* quotient,
+                                     arith_u32* remainder) {
+    // With `rev_n(f) = x^n f(1 / x)` the reversal, `a = q b + r` turns into `rev(a) = rev(q) rev(b) + x^m rev(r)` with
+    // `m = a_count - b_count + 1` the length of `q`. Hence `rev(q) = rev(a) / rev(b) (mod x^m)`, where `rev(b)` is
+    // invertible as a power series since its constant term is the leading coefficient of `b`. The remainder then
+    // follows from the lower `b_count - 1` coefficients of `a - q b`.
+    const arith_u32 modulus      = ntt->montgomery.modulus;
+    const size_t quotient_count  = a_count - b_count + 1;
+    const size_t remainder_count = b_count - 1;
+
+    if (quotient_count <= POLY_DIVISION_THRESHOLD || remainder_count <= POLY_DIVISION_THRESHOLD)
+        return internal_poly_long_division_u32(modulus, a, a_count, b, b_count, quotient, remainder);
+
+    // `reversed` holds the reversal of `b` and then that of `a`, and `product` the longer of the two products.
+    const size_t longer_count  = (quotient_count > remainder_count) ? quotient_count : remainder_count;
+    const size_t product_count = quotient_count + longer_count;
+
+    arith_u32* buffer = malloc((3 * quotient_count + product_count) * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* inverse  = buffer;
+    arith_u32* reversed = buffer + quotient_count;
+    arith_u32* q        = buffer + 2 * quotient_count;
+    arith_u32* product  = buffer + 3 * quotient_count;
+
+    const size_t reversed_count = (b_count < quotient_count) ? b_count : quotient_count;
+    for (size_t i = 0; i < reversed_count; ++i)
+        reversed[i] = b[b_count - 1 - i];
+
+    bool success = internal_poly_inverse_series_u32(ntt, reversed, reversed_count, quotient_count, inverse);
+
+    for (size_t i = 0; i < quotient_count; ++i)
+        reversed[i] = a[a_count - 1 - i];
+
+    success = success && internal_poly_mul_u32(ntt, reversed, quotient_count, inverse, quotient_count, product);
+    if (success) {
+        for (size_t i = 0; i < quotient_count; ++i)
+            q[i] = product[quotient_count - 1 - i];
+    }
+
+    // Only `q mod x^(b_count - 1)` contributes to the lower coefficients of `q b`.
+    const size_t low_count = (quotient_count < remainder_count) ? quotient_count : remainder_count;
+    if (success && remainder != NULL) {
+        success = internal_poly_mul_u32(ntt, b, remainder_count, q, low_count, product);
+        for (size_t i = 0; success && i < remainder_count; ++i)
+            remainder[i] = (a[i] >= product[i]) ? a[i] - product[i] : a[i] + modulus - product[i];
+    }
+
+    if (success && quotient != NULL)
+        memcpy(quotient, q, quotient_count * sizeof(*quotient));
+    free(buffer);
+
+    return success;
+}
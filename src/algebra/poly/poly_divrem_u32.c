@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algebra/poly/poly_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_poly_divrem_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const arith_poly_u32* b,
+                                  arith_poly_u32* quotient, arith_poly_u32* remainder) {
+    // The results go into new arrays, which are handed to the outputs only once nothing can fail anymore.
+    if (b->length == 0)
+        return false;
+
+    if (a->length < b->length) {
+        arith_u32* copy = NULL;
+        if (remainder != NULL && remainder != a && a->length > 0) {
+            copy = malloc(a->length * sizeof(*copy));
+            if (copy == NULL)
+                return false;
+
+            memcpy(copy, a->coefficients, a->length * sizeof(*copy));
+        }
+
+        const size_t length = a->length;
+        if (quotient != NULL)
+            quotient->length = 0;
+        if (copy != NULL)
+            internal_poly_replace_u32(remainder, copy, length, length);
+        else if (remainder != NULL && remainder != a)
+            remainder->length = 0;
+
+        return true;
+    }
+
+    const size_t quotient_length  = a->length - b->length + 1;
+    const size_t remainder_length = b->length - 1;
+
+    arith_u32* quotient_buffer  = NULL;
+    arith_u32* remainder_buffer = NULL;
+    if (quotient != NULL)
+        quotient_buffer = malloc(quotient_length * sizeof(*quotient_buffer));
+    if (remainder != NULL && remainder_length > 0)
+        remainder_buffer = malloc(remainder_length * sizeof(*remainder_buffer));
+
+    if ((quotient != NULL && quotient_buffer == NULL)
+        || (remainder != NULL && remainder_length > 0 && remainder_buffer == NULL)
+        || !internal_poly_divrem_u32(ntt, a->coefficients, a->length, b->coefficients, b->length, quotient_buffer,
+                                     remainder_buffer)) {
+        free(quotient_buffer);
+        free(remainder_buffer);
+        return false;
+    }
+
+    if (quotient != NULL)
+        internal_poly_replace_u32(quotient, quotient_buffer, quotient_length, quotient_length);
+    if (remainder != NULL)
+        internal_poly_replace_u32(remainder, remainder_buffer, remainder_length, remainder_length);
+
+    return true;
+}
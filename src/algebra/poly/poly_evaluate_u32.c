@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "algebra/poly/poly_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_poly_evaluate_u32(const arith_ntt_u32* ntt, const arith_poly_u32* poly, const arith_u32* points,
+                                    const size_t count, arith_u32* values) {
+    if (count == 0)
+        return true;
+
+    if (poly->length == 0) {
+        memset(values, 0, count * sizeof(*values));
+        return true;
+    }
+
+    internal_poly_tree_u32 tree;
+    if (!internal_poly_tree_init_u32(ntt, &tree, points, count))
+        return false;
+
+    const bool success = internal_poly_tree_evaluate_u32(ntt, &tree, poly->coefficients, poly->length, values);
+    internal_poly_tree_free_u32(&tree);
+
+    return success;
+}
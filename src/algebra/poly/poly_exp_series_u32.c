@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algebra/poly/poly_internal.h"
+#include "bit_operations.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+// Returns the coefficient of `x^i` of the power series with the `count` coefficients `coefficients`.
+static arith_u32 internal_poly_coefficient_u32(const arith_u32* coefficients, const size_t count, const size_t i) {
+    return (i < count) ? coefficients[i] : 0;
+}
+
+// Extends the first `m` coefficients of `g = exp(a)` to `2m` with a Newton step, using NTTs of lengths `m = 2^log_m`
+// and `2m`, given `h = g^-1 (mod x^(m / 2))`, which is extended to `g^-1 (mod x^m)`. `derivative` holds `a'` and
+// `inverses` the inverses of the integers, both with at least `2m` entries. `work` must have room for `4m` values.
+static void internal_poly_exp_step_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                       const arith_u32* derivative, const arith_u32* inverses, arith_u32* g,
+                                       arith_u32* h, const size_t m, const unsigned log_m, arith_u32* work) {
+    // The step is `g <- g (1 + a - log(g)) (mod x^(2m))`, where `log(g) = a (mod x^m)`. Following Bernstein, the
+    // logarithm is the integral of `a' + h (g' - g a')` with `a'` taken modulo `x^(m - 1)`. The difference
+    // `s = g' - g a'` vanishes modulo `x^(m - 1)`, so `h` is needed only modulo `x^m`, and the cyclic product `g a'` of
+    // length `m` suffices: the lower coefficients of `g a'` are those of `g'`, so what wrapped around onto them is
+    // their excess. The transform of `g` of length `m` serves both for `h` and for `g a'`.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_u32* transformed_g = work;
+    arith_u32* cyclic        = work + m;
+
+    internal_poly_transform_u32(ntt, g, m, log_m, transformed_g);
+    internal_poly_inverse_step_u32(ntt, transformed_g, h, m / 2, log_m, work + m);
+
+    internal_poly_transform_u32(ntt, derivative, m - 1, log_m, cyclic);
+    arith_ntt_pointwise_mul_u32(ntt, cyclic, transformed_g, cyclic, m);
+    arith_ntt_inverse_u32(ntt, cyclic, log_m);
+
+    // `t = s / x^(m - 1)`: its coefficient `i > 0` is `i g_i - cyclic[i - 1]`, and its constant one `-cyclic[m - 1]`.
+    const arith_u32 top = cyclic[m - 1];
+    for (size_t i = m - 1; i > 0; --i) {
+        const arith_u32 x = internal_mod_mul_u32((arith_u32)(i % modulus), g[i], modulus);
+        cyclic[i]         = (x >= cyclic[i - 1]) ? x - cyclic[i - 1] : x + modulus - cyclic[i - 1];
+    }
+    cyclic[0] = (top == 0) ? 0 : modulus - top;
+
+    // `u = h t (mod x^m)`, so that `log(g)` has the coefficients `u_i / (m + i)` from `x^m` on.
+    internal_poly_transform_u32(ntt, cyclic, m, log_m + 1, work + 2 * m);
+    internal_poly_transform_u32(ntt, h, m, log_m + 1, work);
+    arith_ntt_pointwise_mul_u32(ntt, work, work + 2 * m, work, 2 * m);
+    arith_ntt_inverse_u32(ntt, work, log_m + 1);
+
+    for (size_t i = 0; i < m; ++i) {
+        const arith_u32 x = internal_poly_coefficient_u32(a, a_count, m + i);
+        const arith_u32 y = internal_mod_mul_u32(work[i], inverses[m + i], modulus);
+        work[i]           = (x >= y) ? x - y : x + modulus - y;
+    }
+
+    // `g <- g + x^m (g v mod x^m)` with `v = (a - log(g)) / x^m`.
+    internal_poly_transform_u32(ntt, work, m, log_m + 1, work + 2 * m);
+    internal_poly_transform_u32(ntt, g, m, log_m + 1, work);
+    arith_ntt_pointwise_mul_u32(ntt, work, work + 2 * m, work, 2 * m);
+    arith_ntt_inverse_u32(ntt, work, log_m + 1);
+
+    memcpy(g + m, work, m * sizeof(*g));
+}
+
+// Does the same as internal_poly_exp_step_u32() with an ordinary logarithm and product, for when the NTT tables are
+// too short. `h` is not needed. `work` must have room for `5m` values. Returns `false` if memory could not be
+// allocated.
+static bool internal_poly_exp_step_generic_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                               arith_u32* g, const size_t m, arith_u32* work) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_u32* logarithm = work;
+    arith_u32* v         = work + 2 * m;
+    arith_u32* product   = work + 3 * m;
+    if (!internal_poly_log_series_u32(ntt, g, m, 2 * m, logarithm))
+        return false;
+
+    for (size_t i = 0; i < m; ++i) {
+        const arith_u32 x = internal_poly_coefficient_u32(a, a_count, m + i);
+        v[i]              = (x >= logarithm[m + i]) ? x - logarithm[m + i] : x + modulus - logarithm[m + i];
+    }
+
+    if (!internal_poly_mul_u32(ntt, g, m, v, m, product))
+        return false;
+
+    memcpy(g + m, product, m * sizeof(*g));
+
+    return true;
+}
+
+// Stores the first `count` coefficients of `exp(a)` in `out`, which must not overlap `a`. `a[0]` must be `0`, and
+// `count` positive and at most `p`. Returns `false` if memory could not be allocated.
+static bool internal_poly_exp_series_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                         const size_t count, arith_u32* out) {
+    // The first terms follow from `g' = g a'`, that is `n g_n = sum_k k a_k g_(n - k)`, and each Newton step doubles
+    // the number of correct terms.
+    const arith_u32 modulus  = ntt->montgomery.modulus;
+    const arith_u64 bound    = 8 * (arith_u64)modulus * modulus;
+    const size_t first_count = (count < POLY_SERIES_THRESHOLD) ? count : POLY_SERIES_THRESHOLD;
+
+    size_t length = first_count;
+    while (length < count)
+        length *= 2;
+
+    arith_u32* buffer = malloc(7 * length * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* g          = buffer;
+    arith_u32* h          = buffer + length;
+    arith_u32* derivative = buffer + 2 * length;
+    arith_u32* inverses   = buffer + 3 * length;
+    arith_u32* work       = buffer + 4 * length;
+
+    for (size_t i = 0; i < length; ++i) {
+        const arith_u32 x = internal_poly_coefficient_u32(a, a_count, i + 1);
+        derivative[i]     = internal_mod_mul_u32((arith_u32)((i + 1) % modulus), x, modulus);
+    }
+    internal_poly_integer_inverses_u32(modulus, inverses, length);
+
+    g[0] = 1;
+    for (size_t n = 1; n < first_count; ++n) {
+        arith_u64 sum = 0;
+        for (size_t k = 1; k <= n; ++k) {
+            sum += (arith_u64)derivative[k - 1] * g[n - k];
+            sum  = (sum >= bound) ? sum - bound : sum;
+        }
+
+        g[n] = internal_mod_mul_u32((arith_u32)(sum % modulus), inverses[n], modulus);
+    }
+
+    bool success = (count <= first_count)
+                || internal_poly_inverse_series_u32(ntt, g, first_count, first_count / 2, h);
+    for (size_t m = first_count; m < count && success; m *= 2) {
+        const unsigned log_m = internal_bsr_u64(m);
+        if (log_m + 1 <= ntt->max_log_length)
+            internal_poly_exp_step_u32(ntt, a, a_count, derivative, inverses, g, h, m, log_m, work);
+        else
+            success = internal_poly_exp_step_generic_u32(ntt, a, a_count, g, m, work);
+    }
+
+    if (success)
+        memcpy(out, g, count * sizeof(*out));
+    free(buffer);
+
+    return success;
+}
+
+
+extern bool arith_poly_exp_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                                      arith_poly_u32* out) {
+    if ((a->length > 0 && a->coefficients[0] != 0) || count > ntt->montgomery.modulus)
+        return false;
+
+    if (count == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    arith_u32* coefficients = malloc(count * sizeof(*coefficients));
+    if (coefficients == NULL)
+        return false;
+
+    if (!internal_poly_exp_series_u32(ntt, a->coefficients, a->length, count, coefficients)) {
+        free(coefficients);
+        return false;
+    }
+
+    internal_poly_replace_u32(out, coefficients, count, count);
+
+    return true;
+}
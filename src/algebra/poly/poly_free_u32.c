@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+
+extern void arith_poly_free_u32(arith_poly_u32* poly) {
+    free(poly->coefficients);
+
+    poly->coefficients = NULL;
+    poly->length       = 0;
+    poly->capacity     = 0;
+}
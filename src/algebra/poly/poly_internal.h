@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_ALGEBRA_POLY_INTERNAL_H_
+#define ARITHMOS_ALGEBRA_POLY_INTERNAL_H_
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "inline.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/algebra/poly.h"
+#include "arithmos/core/types.h"
+
+
+
+// The routines below work on plain arrays of coefficients in `[0, p)`, in increasing order of degree and with a length
+// that is passed along, so that the public functions can share them. Unlike `arith_poly_u32`, the arrays may end in
+// zeros.
+
+
+// If the shorter operand has at most this many coefficients, a product is computed by schoolbook multiplication. Longer
+// products are computed with NTTs, which beat Karatsuba multiplication from here on (about 1 us against 2.5 us for 48
+// coefficients), so Karatsuba multiplication is used only for products that are too long for the tables of the NTT.
+#define POLY_SCHOOLBOOK_THRESHOLD 32
+
+// If the quotient or the divisor has at most this many coefficients, a division is done by long division.
+#define POLY_DIVISION_THRESHOLD 32
+
+// The first terms of the inverse, exponential and square root of a power series are computed directly, and the Newton
+// iterations double the number of terms from there.
+#define POLY_SERIES_THRESHOLD 32
+
+// Once the nodes of a subproduct tree have at most this many points, their remainders are evaluated directly.
+#define POLY_EVALUATE_THRESHOLD 32
+
+
+// A subproduct tree of the points `x_i` for `0 <= i < count`. The node `j` of level `k` is the product of `x - x_i`
+// for the `s = min(2^k, count - j * 2^k)` points from `i = j * 2^k` on, so the leaves are at level `0` and the root at
+// level `height`. It is stored as its `s + 1` coefficients at offset `j * (2^k + 1)` of `levels[k]`.
+typedef struct internal_poly_tree_u32 {
+    size_t count;
+    unsigned height;
+    arith_u32* levels[64];
+} internal_poly_tree_u32;
+
+
+// Stores the `a_count + b_count - 1` coefficients of the product of `a` and `b` in `out`, which must not overlap the
+// operands. `a_count` and `b_count` must be positive. Returns `false` if memory could not be allocated.
+__attribute__((visibility("hidden"))) bool internal_poly_mul_u32(const arith_ntt_u32* ntt, const arith_u32* a,
+                                                                 size_t a_count, const arith_u32* b, size_t b_count,
+                                                                 arith_u32* out);
+
+// Stores the first `count` coefficients of the inverse of the power series with the `a_count` coefficients `a` in
+// `out`, which must not overlap `a`. `a[0]` must be nonzero. Returns `false` if memory could not be allocated.
+__attribute__((visibility("hidden"))) bool internal_poly_inverse_series_u32(const arith_ntt_u32* ntt,
+                                                                            const arith_u32* a, size_t a_count,
+                                                                            size_t count, arith_u32* out);
+
+// Extends the first `half` coefficients of the inverse `g` of a power series `a` to `2 * half` with a Newton step,
+// where `transformed_a` is the NTT of length `2 * half = 2^log_length` of `a mod x^(2 half)` and is left unchanged.
+// `work` must have room for `4 * half` values, and starts with the NTT of length `2 * half` of the old `g` afterwards.
+__attribute__((visibility("hidden"))) void internal_poly_inverse_step_u32(const arith_ntt_u32* ntt,
+                                                                          const arith_u32* transformed_a, arith_u32* g,
+                                                                          size_t half, unsigned log_length,
+                                                                          arith_u32* work);
+
+// Divides `a` by `b`, with `a_count >= b_count >= 1` and `b[b_count - 1]` nonzero. Stores the `a_count - b_count + 1`
+// coefficients of the quotient in `quotient` and the `b_count - 1` of the remainder in `remainder`, each unless it is
+// `NULL`. The outputs must not overlap the inputs. Returns `false` if memory could not be allocated.
+__attribute__((visibility("hidden"))) bool internal_poly_divrem_u32(const arith_ntt_u32* ntt, const arith_u32* a,
+                                                                    size_t a_count, const arith_u32* b,
+                                                                    size_t b_count, arith_u32* quotient,
+                                                                    arith_u32* remainder);
+
+
+// Stores the first `count` coefficients of the logarithm of the power series with the `a_count` coefficients `a` in
+// `out`, which must not overlap `a`. `a[0]` must be `1`, and `count` at most `p`. Returns `false` if memory could not
+// be allocated.
+__attribute__((visibility("hidden"))) bool internal_poly_log_series_u32(const arith_ntt_u32* ntt, const arith_u32* a,
+                                                                        size_t a_count, size_t count, arith_u32* out);
+
+// Stores `i^-1 (mod p)` in `inverses[i]` for `0 < i < count`, or `0` if `p` divides `i`, and `0` in `inverses[0]`.
+__attribute__((visibility("hidden"))) void internal_poly_integer_inverses_u32(arith_u32 modulus, arith_u32* inverses,
+                                                                              size_t count);
+
+
+// Builds the subproduct tree of the `count` points `points`, reduced modulo `p`. `count` must be positive. Returns
+// `false` if memory could not be allocated, in which case `tree` needs no freeing.
+__attribute__((visibility("hidden"))) bool internal_poly_tree_init_u32(const arith_ntt_u32* ntt,
+                                                                       internal_poly_tree_u32* tree,
+                                                                       const arith_u32* points, size_t count);
+
+// Frees the memory held by `tree`.
+__attribute__((visibility("hidden"))) void internal_poly_tree_free_u32(internal_poly_tree_u32* tree);
+
+// Stores the values of the polynomial with the `length` coefficients `coefficients` at the points of `tree` in
+// `values`. Returns `false` if memory could not be allocated.
+__attribute__((visibility("hidden"))) bool internal_poly_tree_evaluate_u32(const arith_ntt_u32* ntt,
+                                                                           const internal_poly_tree_u32* tree,
+                                                                           const arith_u32* coefficients,
+                                                                           size_t length, arith_u32* values);
+
+
+// Returns the number of the `count` coefficients of `coefficients` that are left without the trailing zeros.
+static INLINE size_t internal_poly_trim_u32(const arith_u32* coefficients, size_t count) {
+    while (count > 0 && coefficients[count - 1] == 0)
+        --count;
+
+    return count;
+}
+
+// Stores the NTT of length `2^log_length` of the first `count` coefficients of `coefficients`, padded with zeros, in
+// `out`. Coefficients beyond the length of the transform are left out.
+static INLINE void internal_poly_transform_u32(const arith_ntt_u32* ntt, const arith_u32* coefficients, size_t count,
+                                               const unsigned log_length, arith_u32* out) {
+    const size_t length = (size_t)1 << log_length;
+    count               = (count < length) ? count : length;
+
+    memcpy(out, coefficients, count * sizeof(*out));
+    memset(out + count, 0, (length - count) * sizeof(*out));
+    arith_ntt_forward_u32(ntt, out, log_length);
+}
+
+// Hands the array `coefficients` with room for `capacity` values to `poly`, of which the first `length` are its
+// coefficients, and frees the previous one.
+static INLINE void internal_poly_replace_u32(arith_poly_u32* poly, arith_u32* coefficients, const size_t capacity,
+                                             const size_t length) {
+    free(poly->coefficients);
+
+    poly->coefficients = coefficients;
+    poly->capacity     = capacity;
+    poly->length       = internal_poly_trim_u32(coefficients, length);
+}
+
+
+
+#endif  // #ifndef ARITHMOS_ALGEBRA_POLY_INTERNAL_H_
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algebra/poly/poly_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+// Replaces the `count` values of `values` by their inverses modulo `modulus`, with `prefix` as scratch space. Returns
+// `false` if one of them is `0`.
+static bool internal_poly_invert_u32(const arith_u32 modulus, arith_u32* values, arith_u32* prefix,
+                                     const size_t count) {
+    // Montgomery's trick: the inverse of the product of all values gives those of the single values with three
+    // multiplications each.
+    arith_u32 product = 1;
+    for (size_t i = 0; i < count; ++i) {
+        prefix[i] = product;
+        product   = internal_mod_mul_u32(product, values[i], modulus);
+    }
+
+    if (product == 0)
+        return false;
+
+    arith_u32 inverse = internal_mod_inverse_u32(product, modulus);
+    for (size_t i = count; i-- > 0;) {
+        const arith_u32 value = values[i];
+        values[i]             = internal_mod_mul_u32(inverse, prefix[i], modulus);
+        inverse               = internal_mod_mul_u32(inverse, value, modulus);
+    }
+
+    return true;
+}
+
+
+extern bool arith_poly_interpolate_u32(const arith_ntt_u32* ntt, const arith_u32* points, const arith_u32* values,
+                                       const size_t count, arith_poly_u32* poly) {
+    // Lagrange's formula gives `sum_i c_i M(x) / (x - x_i)` with `M = prod_i (x - x_i)` and `c_i = y_i / M'(x_i)`. The
+    // values `M'(x_i)` come from a multipoint evaluation with the subproduct tree, and the sum is built up the tree:
+    // the sum over a node is that over its left child times its right child, plus the other way around.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    if (count == 0) {
+        poly->length = 0;
+        return true;
+    }
+
+    internal_poly_tree_u32 tree;
+    if (!internal_poly_tree_init_u32(ntt, &tree, points, count))
+        return false;
+
+    // `current` holds the sums of a level at the offsets of the first points of their nodes, `next` those of the level
+    // above, and `products` the two products of a node.
+    arith_u32* buffer   = malloc(4 * count * sizeof(*buffer));
+    arith_u32* current  = buffer;
+    arith_u32* next     = buffer + count;
+    arith_u32* products = buffer + 2 * count;
+    if (buffer == NULL) {
+        internal_poly_tree_free_u32(&tree);
+        return false;
+    }
+
+    const arith_u32* root = tree.levels[tree.height];
+    for (size_t i = 0; i < count; ++i)
+        next[i] = internal_mod_mul_u32((arith_u32)((i + 1) % modulus), root[i + 1], modulus);
+
+    bool success = internal_poly_tree_evaluate_u32(ntt, &tree, next, count, current)
+                && internal_poly_invert_u32(modulus, current, next, count);
+    for (size_t i = 0; success && i < count; ++i)
+        current[i] = internal_mod_mul_u32(current[i], values[i] % modulus, modulus);
+
+    for (unsigned level = 1; success && level <= tree.height; ++level) {
+        const size_t span = (size_t)1 << level;
+
+        for (size_t j = 0; success && j <= (count - 1) >> level; ++j) {
+            const size_t first       = j * span;
+            const size_t node_count  = (count - first < span) ? count - first : span;
+            const size_t left_count  = (node_count < span / 2) ? node_count : span / 2;
+            const size_t right_count = node_count - left_count;
+
+            if (right_count == 0) {
+                memcpy(next + first, current + first, node_count * sizeof(*next));
+                continue;
+            }
+
+            const arith_u32* left  = tree.levels[level - 1] + 2 * j * (span / 2 + 1);
+            const arith_u32* right = left + span / 2 + 1;
+
+            success = internal_poly_mul_u32(ntt, current + first, left_count, right, right_count + 1, products)
+                   && internal_poly_mul_u32(ntt, current + first + left_count, right_count, left, left_count + 1,
+                                            products + node_count);
+            for (size_t i = 0; success && i < node_count; ++i) {
+                const arith_u32 sum = products[i] + products[node_count + i];
+                next[first + i]     = (sum >= modulus) ? sum - modulus : sum;
+            }
+        }
+
+        arith_u32* swap = current;
+        current         = next;
+        next            = swap;
+    }
+
+    internal_poly_tree_free_u32(&tree);
+
+    if (!success) {
+        free(buffer);
+        return false;
+    }
+
+    // The result is moved to the front of the buffer, which then becomes the array of `poly`.
+    memmove(buffer, current, count * sizeof(*buffer));
+
+    arith_u32* coefficients = realloc(buffer, count * sizeof(*coefficients));
+    if (coefficients == NULL)
+        internal_poly_replace_u32(poly, buffer, 4 * count, count);
+    else
+        internal_poly_replace_u32(poly, coefficients, count, count);
+
+    return true;
+}
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "algebra/poly/poly_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_poly_log_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                                      arith_poly_u32* out) {
+    if (a->length == 0 || a->coefficients[0] != 1 || count > ntt->montgomery.modulus)
+        return false;
+
+    if (count == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    arith_u32* coefficients = malloc(count * sizeof(*coefficients));
+    if (coefficients == NULL)
+        return false;
+
+    if (!internal_poly_log_series_u32(ntt, a->coefficients, a->length, count, coefficients)) {
+        free(coefficients);
+        return false;
+    }
+
+    internal_poly_replace_u32(out, coefficients, count, count);
+
+    return true;
+}
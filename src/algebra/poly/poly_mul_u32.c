@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "algebra/poly/poly_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_poly_mul_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const arith_poly_u32* b,
+                               arith_poly_u32* out) {
+    // The product goes into a new array, so that `out` may be an operand and is unchanged on failure.
+    if (a->length == 0 || b->length == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    const size_t length = a->length + b->length - 1;
+
+    arith_u32* product = malloc(length * sizeof(*product));
+    if (product == NULL)
+        return false;
+
+    if (!internal_poly_mul_u32(ntt, a->coefficients, a->length, b->coefficients, b->length, product)) {
+        free(product);
+        return false;
+    }
+
+    internal_poly_replace_u32(out, product, length, length);
+
+    return true;
+}
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "algebra/poly/poly_internal.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bit_operations.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+// Stores the product of `a` and `b` in `out` by schoolbook multiplication.
+static void internal_poly_schoolbook_u32(const arith_u32 modulus, const arith_u32* a, const size_t a_count,
+                                         const arith_u32* b, const size_t b_count, arith_u32* out) {
+    // A product of two coefficients is below `p^2 < 2^60`. The products are added in groups of 8, after each of which
+    // the sum is brought back below `8p^2` by subtracting `8p^2`, so it stays below `16p^2 < 2^64`. The sums are
+    // reduced only once at the end.
+    const arith_u64 bound = 8 * (arith_u64)modulus * modulus;
+
+    for (size_t k = 0; k < a_count + b_count - 1; ++k) {
+        const size_t first = (k >= b_count) ? k - b_count + 1 : 0;
+        const size_t last  = (k < a_count) ? k : a_count - 1;
+
+        arith_u64 sum = 0;
+        size_t i      = first;
+        for (; i + 8 <= last + 1; i += 8) {
+            arith_u64 group = 0;
+            for (size_t j = i; j < i + 8; ++j)
+                group += (arith_u64)a[j] * b[k - j];
+
+            sum += group;
+            sum  = (sum >= bound) ? sum - bound : sum;
+        }
+
+        for (; i <= last; ++i)
+            sum += (arith_u64)a[i] * b[k - i];
+
+        out[k] = (arith_u32)(sum % modulus);
+    }
+}
+
+// Stores the `2 * count - 1` coefficients of the product of `a` and `b`, which have `count` coefficients each, in `out`
+// by Karatsuba multiplication. `scratch` must have room for `4 * count + 64` values.
+static void internal_poly_karatsuba_u32(const arith_u32 modulus, const arith_u32* a, const arith_u32* b,
+                                        const size_t count, arith_u32* out, arith_u32* scratch) {
+    // With `a = a_0 + x^m a_1` and `b = b_0 + x^m b_1`, the product is
+    // `a_0 b_0 + x^m ((a_0 + a_1)(b_0 + b_1) - a_0 b_0 - a_1 b_1) + x^(2m) a_1 b_1`, which takes three half-length
+    // products instead of four. The outer two are stored in place in `out`, and the middle one in `scratch`. The halves
+    // need `4 * high` values of `scratch`, with `high <= (count + 1) / 2`, which adds up to less than
+    // `4 * count + 64`.
+    if (count <= POLY_SCHOOLBOOK_THRESHOLD) {
+        internal_poly_schoolbook_u32(modulus, a, count, b, count, out);
+        return;
+    }
+
+    const size_t low  = count / 2;
+    const size_t high = count - low;
+
+    internal_poly_karatsuba_u32(modulus, a, b, low, out, scratch);
+    out[2 * low - 1] = 0;
+    internal_poly_karatsuba_u32(modulus, a + low, b + low, high, out + 2 * low, scratch);
+
+    arith_u32* sum_a  = scratch;
+    arith_u32* sum_b  = scratch + high;
+    arith_u32* middle = scratch + 2 * high;
+    for (size_t i = 0; i < high; ++i) {
+        const arith_u32 x = a[low + i] + ((i < low) ? a[i] : 0);
+        const arith_u32 y = b[low + i] + ((i < low) ? b[i] : 0);
+        sum_a[i]          = (x >= modulus) ? x - modulus : x;
+        sum_b[i]          = (y >= modulus) ? y - modulus : y;
+    }
+
+    internal_poly_karatsuba_u32(modulus, sum_a, sum_b, high, middle, scratch + 4 * high);
+
+    // The subtracted products and the middle one are in `[0, p)`, so `2p` keeps the difference positive.
+    for (size_t i = 0; i < 2 * high - 1; ++i) {
+        arith_u32 x = middle[i] + 2 * modulus - out[2 * low + i] - ((i < 2 * low - 1) ? out[i] : 0);
+        x           = (x >= modulus) ? x - modulus : x;
+        middle[i]   = (x >= modulus) ? x - modulus : x;
+    }
+
+    for (size_t i = 0; i < 2 * high - 1; ++i) {
+        const arith_u32 x = out[low + i] + middle[i];
+        out[low + i]      = (x >= modulus) ? x - modulus : x;
+    }
+}
+
+// Stores the product of `a` and `b` in `out` by Karatsuba multiplication, with `a_count >= b_count`.
+static bool internal_poly_mul_karatsuba_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                            const arith_u32* b, const size_t b_count, arith_u32* out) {
+    // A longer `a` is cut into pieces of `b_count` coefficients, whose products with `b` are added up. A shorter last
+    // piece is multiplied by `b` in the same way, with the roles swapped.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_u32* buffer = malloc((6 * b_count + 64) * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* product = buffer;
+    arith_u32* scratch = buffer + 2 * b_count;
+
+    memset(out, 0, (a_count + b_count - 1) * sizeof(*out));
+
+    bool success = true;
+    for (size_t offset = 0; offset < a_count && success; offset += b_count) {
+        const size_t piece_count = (a_count - offset < b_count) ? a_count - offset : b_count;
+
+        if (piece_count == b_count)
+            internal_poly_karatsuba_u32(modulus, a + offset, b, b_count, product, scratch);
+        else
+            success = internal_poly_mul_u32(ntt, b, b_count, a + offset, piece_count, product);
+
+        for (size_t i = 0; i < piece_count + b_count - 1; ++i) {
+            const arith_u32 x = out[offset + i] + product[i];
+            out[offset + i]   = (x >= modulus) ? x - modulus : x;
+        }
+    }
+
+    free(buffer);
+
+    return success;
+}
+
+
+extern bool internal_poly_mul_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                  const arith_u32* b, const size_t b_count, arith_u32* out) {
+    if (a_count < b_count)
+        return internal_poly_mul_u32(ntt, b, b_count, a, a_count, out);
+
+    if (b_count <= POLY_SCHOOLBOOK_THRESHOLD) {
+        internal_poly_schoolbook_u32(ntt->montgomery.modulus, a, a_count, b, b_count, out);
+        return true;
+    }
+
+    const unsigned log_length = internal_bsr_u64(a_count + b_count - 2) + 1;
+    if (log_length > ntt->max_log_length)
+        return internal_poly_mul_karatsuba_u32(ntt, a, a_count, b, b_count, out);
+
+    return arith_ntt_convolve_u32(ntt, a, a_count, b, b_count, out);
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "algebra/poly/poly_internal.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern void internal_poly_integer_inverses_u32(const arith_u32 modulus, arith_u32* inverses, const size_t count) {
+    // With `p = q i + r`, `0 = q i + r (mod p)` gives `i^-1 = -q r^-1 (mod p)`, and `r < i`. The inverses repeat with
+    // period `p`.
+    for (size_t i = 0; i < count && i < 2; ++i)
+        inverses[i] = (arith_u32)i;
+
+    for (size_t i = 2; i < count; ++i) {
+        if (i >= modulus) {
+            inverses[i] = inverses[i - modulus];
+            continue;
+        }
+
+        const arith_u32 quotient = modulus / (arith_u32)i;
+        inverses[i]              = internal_mod_mul_u32(modulus - quotient, inverses[modulus % (arith_u32)i], modulus);
+    }
+}
+
+
+extern bool internal_poly_log_series_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                         const size_t count, arith_u32* out) {
+    // `log(a)` is the integral of `a' / a`, which takes an inverse and a product.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    if (count == 0)
+        return true;
+
+    // Only `a' mod x^(count - 1)` contributes, and `a'` may be shorter than that. A constant `a = 1` has logarithm `0`.
+    const size_t derivative_count = (a_count < count) ? a_count - 1 : count - 1;
+    if (derivative_count == 0) {
+        memset(out, 0, count * sizeof(*out));
+        return true;
+    }
+
+    arith_u32* buffer = malloc(4 * count * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* inverse    = buffer;
+    arith_u32* derivative = buffer + count;
+    arith_u32* product    = buffer + 2 * count;
+
+    for (size_t i = 0; i < derivative_count; ++i)
+        derivative[i] = internal_mod_mul_u32((arith_u32)((i + 1) % modulus), a[i + 1], modulus);
+
+    const bool success = internal_poly_inverse_series_u32(ntt, a, a_count, count - 1, inverse)
+                      && internal_poly_mul_u32(ntt, derivative, derivative_count, inverse, count - 1, product);
+    if (success) {
+        // The inverses of the integers take the place of the inverse series.
+        internal_poly_integer_inverses_u32(modulus, inverse, count);
+
+        out[0] = 0;
+        for (size_t i = 1; i < count; ++i)
+            out[i] = internal_mod_mul_u32(product[i - 1], inverse[i], modulus);
+    }
+
+    free(buffer);
+
+    return success;
+}
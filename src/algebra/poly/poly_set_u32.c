@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "algebra/poly/poly_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_poly_set_u32(const arith_ntt_u32* ntt, arith_poly_u32* poly, const arith_u32* coefficients,
+                               const size_t count) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    // The existing array is reused if it is large enough, which it need not be to hold the trailing zeros.
+    size_t length = count;
+    while (length > 0 && coefficients[length - 1] % modulus == 0)
+        --length;
+
+    if (length > poly->capacity) {
+        arith_u32* reduced = malloc(length * sizeof(*reduced));
+        if (reduced == NULL)
+            return false;
+
+        for (size_t i = 0; i < length; ++i)
+            reduced[i] = coefficients[i] % modulus;
+        internal_poly_replace_u32(poly, reduced, length, length);
+
+        return true;
+    }
+
+    for (size_t i = 0; i < length; ++i)
+        poly->coefficients[i] = coefficients[i] % modulus;
+    poly->length = length;
+
+    return true;
+}
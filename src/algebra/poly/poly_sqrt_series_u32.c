@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/algebra/poly.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algebra/poly/poly_internal.h"
+#include "bit_operations.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/sqrt_mod.h"
+
+
+
+// Returns the coefficient of `x^i` of the power series with the `count` coefficients `coefficients`.
+static arith_u32 internal_poly_coefficient_u32(const arith_u32* coefficients, const size_t count, const size_t i) {
+    return (i < count) ? coefficients[i] : 0;
+}
+
+// Extends the first `m` coefficients of `s = sqrt(a)` to `2m` with a Newton step, using NTTs of lengths `m = 2^log_m`
+// and `2m`, given `h = s^-1 (mod x^(m / 2))`, which is extended to `s^-1 (mod x^m)`. `work` must have room for `4m`
+// values.
+static void internal_poly_sqrt_step_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                        arith_u32* s, arith_u32* h, const size_t m, const unsigned log_m,
+                                        arith_u32* work) {
+    // The step is `s <- s + (a - s^2) / (2s) (mod x^(2m))`. Since `s^2 = a (mod x^m)`, only `h` modulo `x^m` is needed,
+    // and the cyclic square of length `m` suffices: its lower coefficients are those of `a`, so what wrapped around
+    // onto them is the upper half of `s^2`. The transform of `s` of length `m` serves both for `h` and for `s^2`.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const arith_u32 half    = (modulus + 1) / 2;
+
+    arith_u32* transformed_s = work;
+    arith_u32* cyclic        = work + m;
+
+    internal_poly_transform_u32(ntt, s, m, log_m, transformed_s);
+    internal_poly_inverse_step_u32(ntt, transformed_s, h, m / 2, log_m, work + m);
+
+    arith_ntt_pointwise_mul_u32(ntt, transformed_s, transformed_s, cyclic, m);
+    arith_ntt_inverse_u32(ntt, cyclic, log_m);
+
+    // `d = (a - s^2) / x^m`, where the coefficient `m + i` of `s^2` is `cyclic[i] - a_i`, and `0` for `i = m - 1`.
+    for (size_t i = 0; i < m; ++i) {
+        const arith_u32 x = internal_poly_coefficient_u32(a, a_count, m + i);
+        const arith_u32 y = internal_poly_coefficient_u32(a, a_count, i);
+        const arith_u32 z = (i == m - 1) ? 0 : ((cyclic[i] >= y) ? cyclic[i] - y : cyclic[i] + modulus - y);
+        cyclic[i]         = (x >= z) ? x - z : x + modulus - z;
+    }
+
+    internal_poly_transform_u32(ntt, cyclic, m, log_m + 1, work + 2 * m);
+    internal_poly_transform_u32(ntt, h, m, log_m + 1, work);
+    arith_ntt_pointwise_mul_u32(ntt, work, work + 2 * m, work, 2 * m);
+    arith_ntt_inverse_u32(ntt, work, log_m + 1);
+
+    for (size_t i = 0; i < m; ++i)
+        s[m + i] = internal_mod_mul_u32(work[i], half, modulus);
+}
+
+// Does the same as internal_poly_sqrt_step_u32() with ordinary products and an inverse, for when the NTT tables are
+// too short. `h` is not needed. `work` must have room for `6m` values. Returns `false` if memory could not be
+// allocated.
+static bool internal_poly_sqrt_step_generic_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                                arith_u32* s, const size_t m, arith_u32* work) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const arith_u32 half    = (modulus + 1) / 2;
+
+    arith_u32* square  = work;
+    arith_u32* inverse = work + 2 * m;
+    arith_u32* d       = work + 3 * m;
+    arith_u32* product = work + 4 * m;
+    if (!internal_poly_mul_u32(ntt, s, m, s, m, square)
+        || !internal_poly_inverse_series_u32(ntt, s, m, m, inverse))
+        return false;
+
+    square[2 * m - 1] = 0;
+    for (size_t i = 0; i < m; ++i) {
+        const arith_u32 x = internal_poly_coefficient_u32(a, a_count, m + i);
+        d[i]              = (x >= square[m + i]) ? x - square[m + i] : x + modulus - square[m + i];
+    }
+
+    if (!internal_poly_mul_u32(ntt, d, m, inverse, m, product))
+        return false;
+
+    for (size_t i = 0; i < m; ++i)
+        s[m + i] = internal_mod_mul_u32(product[i], half, modulus);
+
+    return true;
+}
+
+// Stores the first `count` coefficients of the square root of `a` with constant coefficient `root` in `out`, which
+// must not overlap `a`. `root` must be a nonzero square root of `a[0]`, and `count` positive. Returns `false` if memory
+// could not be allocated.
+static bool internal_poly_sqrt_series_u32(const arith_ntt_u32* ntt, const arith_u32* a, const size_t a_count,
+                                          const arith_u32 root, const size_t count, arith_u32* out) {
+    // The first terms follow from `sum_k s_k s_(n - k) = a_n`, and each Newton step doubles the number of correct
+    // terms.
+    const arith_u32 modulus  = ntt->montgomery.modulus;
+    const arith_u64 bound    = 8 * (arith_u64)modulus * modulus;
+    const size_t first_count = (count < POLY_SERIES_THRESHOLD) ? count : POLY_SERIES_THRESHOLD;
+    const arith_u32 inverse  = internal_mod_inverse_u32(internal_mod_mul_u32(2, root, modulus), modulus);
+
+    size_t length = first_count;
+    while (length < count)
+        length *= 2;
+
+    arith_u32* buffer = malloc(5 * length * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* s    = buffer;
+    arith_u32* h    = buffer + length;
+    arith_u32* work = buffer + 2 * length;
+
+    s[0] = root;
+    for (size_t n = 1; n < first_count; ++n) {
+        arith_u64 sum = 0;
+        for (size_t k = 1; k < n; ++k) {
+            sum += (arith_u64)s[k] * s[n - k];
+            sum  = (sum >= bound) ? sum - bound : sum;
+        }
+
+        const arith_u32 x = internal_poly_coefficient_u32(a, a_count, n);
+        const arith_u32 y = (arith_u32)(sum % modulus);
+        s[n]              = internal_mod_mul_u32((x >= y) ? x - y : x + modulus - y, inverse, modulus);
+    }
+
+    bool success = (count <= first_count)
+                || internal_poly_inverse_series_u32(ntt, s, first_count, first_count / 2, h);
+    for (size_t m = first_count; m < count && success; m *= 2) {
+        const unsigned log_m = internal_bsr_u64(m);
+        if (log_m + 1 <= ntt->max_log_length)
+            internal_poly_sqrt_step_u32(ntt, a, a_count, s, h, m, log_m, work);
+        else
+            success = internal_poly_sqrt_step_generic_u32(ntt, a, a_count, s, m, work);
+    }
+
+    if (success)
+        memcpy(out, s, count * sizeof(*out));
+    free(buffer);
+
+    return success;
+}
+
+
+extern bool arith_poly_sqrt_series_u32(const arith_ntt_u32* ntt, const arith_poly_u32* a, const size_t count,
+                                       arith_poly_u32* out) {
+    // A series `x^(2k) b` with `b(0)` nonzero has the square roots `x^k sqrt(b)`, and there are none if the lowest
+    // power of `x` is odd. Of the two roots of `b(0)`, the smaller one is taken, which arith_sqrt_mod_u64() returns.
+    if (a->length == 0 || count == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    size_t shift = 0;
+    while (a->coefficients[shift] == 0)
+        ++shift;
+
+    arith_u64 root;
+    if ((shift & 1) == 1 || !arith_sqrt_mod_u64(a->coefficients[shift], ntt->montgomery.modulus, &root))
+        return false;
+
+    if (shift / 2 >= count) {
+        out->length = 0;
+        return true;
+    }
+
+    arith_u32* coefficients = malloc(count * sizeof(*coefficients));
+    if (coefficients == NULL)
+        return false;
+
+    memset(coefficients, 0, shift / 2 * sizeof(*coefficients));
+    if (!internal_poly_sqrt_series_u32(ntt, a->coefficients + shift, a->length - shift, (arith_u32)root,
+                                       count - shift / 2, coefficients + shift / 2)) {
+        free(coefficients);
+        return false;
+    }
+
+    internal_poly_replace_u32(out, coefficients, count, count);
+
+    return true;
+}
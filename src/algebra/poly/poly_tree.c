@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "algebra/poly/poly_internal.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bit_operations.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+// Returns the number of points of the node `j` of level `level` of `tree`.
+static size_t internal_poly_tree_node_count_u32(const internal_poly_tree_u32* tree, const unsigned level,
+                                                const size_t j) {
+    const size_t first = j << level;
+    const size_t span  = (size_t)1 << level;
+
+    return (tree->count - first < span) ? tree->count - first : span;
+}
+
+// Returns the coefficients of the node `j` of level `level` of `tree`.
+static arith_u32* internal_poly_tree_node_u32(const internal_poly_tree_u32* tree, const unsigned level,
+                                              const size_t j) {
+    return tree->levels[level] + j * (((size_t)1 << level) + 1);
+}
+
+
+extern bool internal_poly_tree_init_u32(const arith_ntt_u32* ntt, internal_poly_tree_u32* tree, const arith_u32* points,
+                                        const size_t count) {
+    // Each node is the product of its two children, or a copy of its only child at the end of a level. All levels are
+    // kept in one allocation of about `count * (height + 2)` values.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    tree->count  = count;
+    tree->height = (count == 1) ? 0 : internal_bsr_u64(count - 1) + 1;
+
+    size_t total = 0;
+    for (unsigned level = 0; level <= tree->height; ++level) {
+        const size_t node_count = ((count - 1) >> level) + 1;
+        total                  += node_count * (((size_t)1 << level) + 1);
+    }
+
+    arith_u32* buffer = malloc(total * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    for (unsigned level = 0; level <= tree->height; ++level) {
+        tree->levels[level]  = buffer;
+        buffer              += (((count - 1) >> level) + 1) * (((size_t)1 << level) + 1);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u32 point      = points[i] % modulus;
+        tree->levels[0][2 * i]     = (point == 0) ? 0 : modulus - point;
+        tree->levels[0][2 * i + 1] = 1;
+    }
+
+    for (unsigned level = 1; level <= tree->height; ++level) {
+        for (size_t j = 0; j <= (count - 1) >> level; ++j) {
+            const size_t left_count = internal_poly_tree_node_count_u32(tree, level - 1, 2 * j);
+            const size_t node_count = internal_poly_tree_node_count_u32(tree, level, j);
+            const arith_u32* left   = internal_poly_tree_node_u32(tree, level - 1, 2 * j);
+            arith_u32* node         = internal_poly_tree_node_u32(tree, level, j);
+
+            if (left_count == node_count) {
+                memcpy(node, left, (node_count + 1) * sizeof(*node));
+                continue;
+            }
+
+            const arith_u32* right = internal_poly_tree_node_u32(tree, level - 1, 2 * j + 1);
+            if (!internal_poly_mul_u32(ntt, left, left_count + 1, right, node_count - left_count + 1, node)) {
+                internal_poly_tree_free_u32(tree);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+extern void internal_poly_tree_free_u32(internal_poly_tree_u32* tree) {
+    free(tree->levels[0]);
+}
+
+
+extern bool internal_poly_tree_evaluate_u32(const arith_ntt_u32* ntt, const internal_poly_tree_u32* tree,
+                                            const arith_u32* coefficients, const size_t length, arith_u32* values) {
+    // The value at `x_i` is the remainder of the division by `x - x_i`, and a remainder modulo a node can be taken from
+    // the remainder modulo its parent instead. Going down from the root, the remainders of level `k` have at most
+    // `2^k` coefficients, so a level takes time `O(M(n))`. Near the leaves, the remainders are short enough to be
+    // evaluated directly.
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const size_t count      = tree->count;
+
+    // The remainders of a level are stored at the offsets of the first points of their nodes.
+    arith_u32* buffer = malloc(2 * count * sizeof(*buffer));
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* current = buffer;
+    arith_u32* next    = buffer + count;
+
+    bool success = true;
+    if (length > count) {
+        success = internal_poly_divrem_u32(ntt, coefficients, length, tree->levels[tree->height], count + 1, NULL,
+                                           current);
+    } else {
+        memcpy(current, coefficients, length * sizeof(*current));
+        memset(current + length, 0, (count - length) * sizeof(*current));
+    }
+
+    unsigned level = tree->height;
+    for (; success && level > 0 && ((size_t)1 << level) > POLY_EVALUATE_THRESHOLD; --level) {
+        for (size_t j = 0; success && j <= (count - 1) >> level; ++j) {
+            const size_t first       = j << level;
+            const size_t left_count  = internal_poly_tree_node_count_u32(tree, level - 1, 2 * j);
+            const size_t node_count  = internal_poly_tree_node_count_u32(tree, level, j);
+            const size_t right_count = node_count - left_count;
+
+            if (right_count == 0) {
+                memcpy(next + first, current + first, node_count * sizeof(*next));
+                continue;
+            }
+
+            success = internal_poly_divrem_u32(ntt, current + first, node_count,
+                                               internal_poly_tree_node_u32(tree, level - 1, 2 * j),
+                                               left_count + 1, NULL, next + first)
+                   && internal_poly_divrem_u32(ntt, current + first, node_count,
+                                               internal_poly_tree_node_u32(tree, level - 1, 2 * j + 1),
+                                               right_count + 1, NULL, next + first + left_count);
+        }
+
+        arith_u32* swap = current;
+        current         = next;
+        next            = swap;
+    }
+
+    // Horner's rule on the remainder of the node of each point.
+    for (size_t i = 0; success && i < count; ++i) {
+        const size_t first      = (i >> level) << level;
+        const size_t node_count = internal_poly_tree_node_count_u32(tree, level, i >> level);
+        const arith_u32 point   = (tree->levels[0][2 * i] == 0) ? 0 : modulus - tree->levels[0][2 * i];
+
+        arith_u64 value = 0;
+        for (size_t k = node_count; k-- > 0;)
+            value = (value * point + current[first + k]) % modulus;
+        values[i] = (arith_u32)value;
+    }
+
+    free(buffer);
+
+    return success;
+}
@@ -10,9 +10,9 @@
 #include "cpu_features.h"
 #include "inline.h"
 
-#if ARITHMOS_CPU_HAS_BMI1
+#if ARITHMOS_CPU_HAS_BMI1 || ARITHMOS_CPU_HAS_AVX2 || ARITHMOS_CPU_HAS_AVX512F
 #    include <immintrin.h>
-#endif  // ARITHMOS_CPU_HAS_BMI1
+#endif  // #if ARITHMOS_CPU_HAS_BMI1 || ARITHMOS_CPU_HAS_AVX2 || ARITHMOS_CPU_HAS_AVX512F
 
 #include "arithmos/core/types.h"
 
@@ -90,6 +90,44 @@ static INLINE unsigned internal_bsf_u64(const arith_u64 x) {
 #endif  // #if ARITHMOS_CPU_HAS_BMI1
 }
 
+// Returns the index of the last set bit of `x`, starting at the least significant bit position. If `x` is `0`,
+// the result is undefined.
+static INLINE unsigned internal_bsr_u32(const arith_u32 x) {
+#if __has_builtin(__builtin_clz)
+
+    static_assert(sizeof(unsigned) >= sizeof(arith_u32), "size mismatch");
+
+    return 31 - (unsigned)__builtin_clz(x);
+
+#else
+
+    unsigned index = 0;
+    for (arith_u32 y = x >> 1; y != 0; y >>= 1)
+        ++index;
+
+    return index;
+
+#endif  // #if __has_builtin(__builtin_clz)
+}
+
+// Returns the index of the last set bit of `x`, starting at the least significant bit position. If `x` is `0`,
+// the result is undefined.
+static INLINE unsigned internal_bsr_u64(const arith_u64 x) {
+#if __has_builtin(__builtin_clzll)
+
+    static_assert(sizeof(unsigned long long) >= sizeof(arith_u64), "size mismatch");
+
+    return 63 - (unsigned)__builtin_clzll(x);
+
+#else
+
+    const arith_u32 high = (arith_u32)(x >> 32);
+
+    return (high != 0) ? 32 + internal_bsr_u32(high) : internal_bsr_u32((arith_u32)x);
+
+#endif  // #if __has_builtin(__builtin_clzll)
+}
+
 
 // Returns the number of trailing `0`-bits in `x`, starting at the least significant bit position. If `x` is `0`,
 // the result is `32`.
@@ -126,5 +164,60 @@ static INLINE unsigned internal_ctz_u64(const arith_u64 x) {
 }
 
 
+#if ARITHMOS_CPU_HAS_AVX2
+
+// Returns the number of trailing `0`-bits in each 32-bit lane of `x`. For lanes that are `0`, the result is negative,
+// which variable shift instructions treat as an out of range shift count.
+static INLINE __m256i internal_ctz_u32x8(const __m256i x) {
+    // AVX2 has no trailing zero count, so we isolate the lowest set bit 2^i and convert it to a float, whose biased
+    // exponent is i + 127. The signed conversion turns 2^31 into -2^31, which has the same exponent once the sign bit
+    // is masked off. A lane that is 0 converts to +0.0, giving -127.
+
+    const __m256i lowest   = _mm256_and_si256(x, _mm256_sub_epi32(_mm256_setzero_si256(), x));
+    const __m256i bits     = _mm256_castps_si256(_mm256_cvtepi32_ps(lowest));
+    const __m256i exponent = _mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xFF));
+
+    return _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+}
+
+// Returns the number of trailing `0`-bits in each 64-bit lane of `x`. For lanes that are `0`, the result is larger
+// than `63`, which variable shift instructions treat as an out of range shift count.
+static INLINE __m256i internal_ctz_u64x4(const __m256i x) {
+    // The lowest set bit lies in exactly one 32-bit half, so we apply the trick of internal_ctz_u32x8() to both
+    // halves, add 32 to the high half, and keep the maximum. The half that is 0 gives a negative count and loses.
+
+    const __m256i lowest   = _mm256_and_si256(x, _mm256_sub_epi64(_mm256_setzero_si256(), x));
+    const __m256i bits     = _mm256_castps_si256(_mm256_cvtepi32_ps(lowest));
+    const __m256i exponent = _mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xFF));
+    const __m256i bias     = _mm256_set_epi32(32 - 127, -127, 32 - 127, -127, 32 - 127, -127, 32 - 127, -127);
+    const __m256i halves   = _mm256_add_epi32(exponent, bias);
+    const __m256i count    = _mm256_max_epi32(halves, _mm256_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    return _mm256_srli_epi64(count, 32);
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX2
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+// Returns the number of trailing `0`-bits in each 32-bit lane of `x`. For lanes that are `0`, the result is negative,
+// which variable shift instructions treat as an out of range shift count.
+static INLINE __m512i internal_ctz_u32x16(const __m512i x) {
+    const __m512i lowest = _mm512_and_si512(x, _mm512_sub_epi32(_mm512_setzero_si512(), x));
+
+    return _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(lowest));
+}
+
+// Returns the number of trailing `0`-bits in each 64-bit lane of `x`. For lanes that are `0`, the result is negative,
+// which variable shift instructions treat as an out of range shift count.
+static INLINE __m512i internal_ctz_u64x8(const __m512i x) {
+    const __m512i lowest = _mm512_and_si512(x, _mm512_sub_epi64(_mm512_setzero_si512(), x));
+
+    return _mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(lowest));
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+
 
 #endif  // #ifndef ARITHMOS_BIT_OPERATIONS_H_
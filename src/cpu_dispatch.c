@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "cpu_dispatch.h"
+
+#include <cpuid.h>
+#include <stdbool.h>
+
+
+
+// Set in the cached features once the CPU has been queried, so that a CPU without any of the features is only queried
+// once as well.
+#define ARITHMOS_CPU_FEATURES_DETECTED (1U << 31)
+
+
+// Returns the state components that the operating system saves on context switches, i.e. `XCR0`.
+ARITHMOS_RESOLVER static unsigned long long internal_xgetbv(void) {
+    unsigned low;
+    unsigned high;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+
+    return ((unsigned long long)high << 32) | low;
+}
+
+ARITHMOS_RESOLVER static unsigned internal_detect_cpu_features(void) {
+    unsigned features = ARITHMOS_CPU_FEATURES_DETECTED;
+    unsigned eax, ebx, ecx, edx;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+        return features;
+
+    // AVX and AVX-512 instructions may only be used if the operating system saves the YMM (bits 1 and 2 of XCR0) and
+    // additionally the ZMM registers (bits 5 to 7) on context switches.
+    const bool has_osxsave        = ((ecx >> 27) & 1) == 1;
+    const bool has_avx            = ((ecx >> 28) & 1) == 1;
+    const unsigned long long xcr0 = has_osxsave ? internal_xgetbv() : 0;
+    const bool ymm_enabled        = has_avx && (xcr0 & 0x06) == 0x06;
+    const bool zmm_enabled        = ymm_enabled && (xcr0 & 0xE0) == 0xE0;
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) {
+        if (((ebx >> 3) & 1) == 1)
+            features |= ARITHMOS_CPU_FEATURE_BMI1;
+        if (((ebx >> 8) & 1) == 1)
+            features |= ARITHMOS_CPU_FEATURE_BMI2;
+        if (((ebx >> 19) & 1) == 1)
+            features |= ARITHMOS_CPU_FEATURE_ADX;
+        if (ymm_enabled && ((ebx >> 5) & 1) == 1)
+            features |= ARITHMOS_CPU_FEATURE_AVX2;
+
+        if (zmm_enabled) {
+            if (((ebx >> 16) & 1) == 1)
+                features |= ARITHMOS_CPU_FEATURE_AVX512F;
+            if (((ebx >> 17) & 1) == 1)
+                features |= ARITHMOS_CPU_FEATURE_AVX512DQ;
+            if (((ebx >> 21) & 1) == 1)
+                features |= ARITHMOS_CPU_FEATURE_AVX512IFMA;
+            if (((ebx >> 28) & 1) == 1)
+                features |= ARITHMOS_CPU_FEATURE_AVX512CD;
+            if (((ebx >> 30) & 1) == 1)
+                features |= ARITHMOS_CPU_FEATURE_AVX512BW;
+            if (((ebx >> 31) & 1) == 1)
+                features |= ARITHMOS_CPU_FEATURE_AVX512VL;
+        }
+    }
+
+    if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) != 0 && ((ecx >> 5) & 1) == 1)
+        features |= ARITHMOS_CPU_FEATURE_LZCNT;
+
+    return features;
+}
+
+
+extern unsigned internal_cpu_features(void) {
+    // The resolvers run at load time, possibly one at a time from several threads if symbols are bound lazily. Since
+    // every thread computes the same value, relaxed atomics suffice.
+    static unsigned cached_features = 0;
+
+    unsigned features = __atomic_load_n(&cached_features, __ATOMIC_RELAXED);
+    if (features == 0) {
+        features = internal_detect_cpu_features();
+        __atomic_store_n(&cached_features, features, __ATOMIC_RELAXED);
+    }
+
+    return features & ~ARITHMOS_CPU_FEATURES_DETECTED;
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_CPU_DISPATCH_H_
+#define ARITHMOS_CPU_DISPATCH_H_
+
+
+
+// Kernels that profit from newer instruction sets are compiled once for every CPU level below, and the best variant
+// for the running CPU is selected once at load time by an ifunc resolver. This lets a single portable binary use the
+// fast paths wherever they are available.
+//
+// Within a variant, the compile-time ARITHMOS_CPU_HAS_* macros of cpu_features.h describe the level it is compiled for,
+// so a kernel is written exactly as if it were compiled for a single CPU. It only has to define its entry point with
+// ARITHMOS_DISPATCHED(), which appends the suffix of the level (ARITHMOS_DISPATCH_SUFFIX) to its name. The unsuffixed
+// public symbol is then defined with ARITHMOS_DEFINE_DISPATCHER() in the *_dispatch.c file of the kernel's area, and
+// the kernel's source file is added to the build with arithmos_dispatched_sources() instead of target_sources().
+//
+// If ARITHMOS_DISPATCH is 0 (e.g. for builds with -march=native), every kernel is compiled once for the target of the
+// build and ARITHMOS_DISPATCHED() leaves its name as is.
+
+
+#ifndef ARITHMOS_DISPATCH
+#    define ARITHMOS_DISPATCH 0
+#endif  // #ifndef ARITHMOS_DISPATCH
+
+#ifndef ARITHMOS_DISPATCH_SUFFIX
+#    define ARITHMOS_DISPATCH_SUFFIX _generic
+#endif  // #ifndef ARITHMOS_DISPATCH_SUFFIX
+
+
+#define ARITHMOS_CONCATENATE_(a, b) a##b
+#define ARITHMOS_CONCATENATE(a, b)  ARITHMOS_CONCATENATE_(a, b)
+
+#if ARITHMOS_DISPATCH
+#    define ARITHMOS_DISPATCHED(name) ARITHMOS_CONCATENATE(name, ARITHMOS_DISPATCH_SUFFIX)
+#else
+#    define ARITHMOS_DISPATCHED(name) name
+#endif  // #if ARITHMOS_DISPATCH
+
+
+
+#if ARITHMOS_DISPATCH
+
+
+// CPU features reported by internal_cpu_features().
+#define ARITHMOS_CPU_FEATURE_BMI1       (1U << 0)
+#define ARITHMOS_CPU_FEATURE_BMI2       (1U << 1)
+#define ARITHMOS_CPU_FEATURE_LZCNT      (1U << 2)
+#define ARITHMOS_CPU_FEATURE_ADX        (1U << 3)
+#define ARITHMOS_CPU_FEATURE_AVX2       (1U << 4)
+#define ARITHMOS_CPU_FEATURE_AVX512F    (1U << 5)
+#define ARITHMOS_CPU_FEATURE_AVX512CD   (1U << 6)
+#define ARITHMOS_CPU_FEATURE_AVX512BW   (1U << 7)
+#define ARITHMOS_CPU_FEATURE_AVX512DQ   (1U << 8)
+#define ARITHMOS_CPU_FEATURE_AVX512VL   (1U << 9)
+#define ARITHMOS_CPU_FEATURE_AVX512IFMA (1U << 10)
+
+// The CPU levels that kernels are compiled for, besides the baseline x86-64 (`_generic`). They must match the compile
+// flags of the corresponding object libraries in src/CMakeLists.txt. `_avx2` roughly corresponds to x86-64-v3 (Haswell,
+// Zen) and `_avx512` to x86-64-v4 (Skylake-X). `_avx512ifma` (Ice Lake, Zen 4) adds 52-bit integer multiply-add.
+#define ARITHMOS_CPU_LEVEL_AVX2                                                                              \
+    (ARITHMOS_CPU_FEATURE_BMI1 | ARITHMOS_CPU_FEATURE_BMI2 | ARITHMOS_CPU_FEATURE_LZCNT                     \
+     | ARITHMOS_CPU_FEATURE_AVX2)
+#define ARITHMOS_CPU_LEVEL_AVX512                                                                            \
+    (ARITHMOS_CPU_LEVEL_AVX2 | ARITHMOS_CPU_FEATURE_ADX | ARITHMOS_CPU_FEATURE_AVX512F                      \
+     | ARITHMOS_CPU_FEATURE_AVX512CD | ARITHMOS_CPU_FEATURE_AVX512BW | ARITHMOS_CPU_FEATURE_AVX512DQ        \
+     | ARITHMOS_CPU_FEATURE_AVX512VL)
+#define ARITHMOS_CPU_LEVEL_AVX512IFMA (ARITHMOS_CPU_LEVEL_AVX512 | ARITHMOS_CPU_FEATURE_AVX512IFMA)
+
+
+// Ifunc resolvers may run before the stack protector and sanitizers of the program are initialized, so neither may
+// instrument them.
+#if __has_attribute(no_stack_protector)
+#    define ARITHMOS_RESOLVER __attribute__((no_stack_protector, no_sanitize_address))
+#else
+#    define ARITHMOS_RESOLVER __attribute__((no_sanitize_address))
+#endif  // #if __has_attribute(no_stack_protector)
+
+
+// Returns the ARITHMOS_CPU_FEATURE_* flags of the running CPU that are also enabled by the operating system. The CPU
+// is queried on the first call only.
+ARITHMOS_RESOLVER __attribute__((visibility("hidden"))) unsigned internal_cpu_features(void);
+
+
+// Defines the public function `name`, which is resolved at load time to the variant of `name` for the best CPU level
+// that the running CPU supports. `parameters` is the parenthesized parameter list of `name`.
+#define ARITHMOS_DEFINE_DISPATCHER(return_type, name, parameters)                                            \
+    return_type name##_generic parameters;                                                                   \
+    return_type name##_avx2 parameters;                                                                      \
+    return_type name##_avx512 parameters;                                                                    \
+    return_type name##_avx512ifma parameters;                                                                \
+                                                                                                             \
+    ARITHMOS_RESOLVER static return_type(*resolve_##name(void)) parameters {                                 \
+        const unsigned features = internal_cpu_features();                                                   \
+                                                                                                             \
+        if ((features & ARITHMOS_CPU_LEVEL_AVX512IFMA) == ARITHMOS_CPU_LEVEL_AVX512IFMA)                     \
+            return name##_avx512ifma;                                                                        \
+        if ((features & ARITHMOS_CPU_LEVEL_AVX512) == ARITHMOS_CPU_LEVEL_AVX512)                             \
+            return name##_avx512;                                                                            \
+        if ((features & ARITHMOS_CPU_LEVEL_AVX2) == ARITHMOS_CPU_LEVEL_AVX2)                                 \
+            return name##_avx2;                                                                              \
+                                                                                                             \
+        return name##_generic;                                                                               \
+    }                                                                                                        \
+                                                                                                             \
+    return_type name parameters __attribute__((ifunc("resolve_" #name)))
+
+
+#endif  // #if ARITHMOS_DISPATCH
+
+
+
+#endif  // #ifndef ARITHMOS_CPU_DISPATCH_H_
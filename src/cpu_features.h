@@ -18,6 +18,30 @@
 #    define ARITHMOS_CPU_HAS_BMI2 0
 #endif  // #ifdef __BMI2__
 
+#ifdef __AVX2__
+#    define ARITHMOS_CPU_HAS_AVX2 1
+#else
+#    define ARITHMOS_CPU_HAS_AVX2 0
+#endif  // #ifdef __AVX2__
+
+#ifdef __AVX512F__
+#    define ARITHMOS_CPU_HAS_AVX512F 1
+#else
+#    define ARITHMOS_CPU_HAS_AVX512F 0
+#endif  // #ifdef __AVX512F__
+
+#ifdef __AVX512CD__
+#    define ARITHMOS_CPU_HAS_AVX512CD 1
+#else
+#    define ARITHMOS_CPU_HAS_AVX512CD 0
+#endif  // #ifdef __AVX512CD__
+
+#ifdef __AVX512IFMA__
+#    define ARITHMOS_CPU_HAS_AVX512IFMA 1
+#else
+#    define ARITHMOS_CPU_HAS_AVX512IFMA 0
+#endif  // #ifdef __AVX512IFMA__
+
 
 
 #endif  // #ifndef ARITHMOS_CPU_FEATURES_H_
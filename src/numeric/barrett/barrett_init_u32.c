@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/barrett.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+extern void arith_barrett_init_u32(arith_barrett_u32* barrett, const arith_u32 modulus) {
+    barrett->modulus    = modulus;
+    barrett->reciprocal = ARITH_U64_MAX / modulus;
+}
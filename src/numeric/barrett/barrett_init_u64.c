@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/barrett.h"
+
+#include "bit_operations.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+extern void arith_barrett_init_u64(arith_barrett_u64* barrett, const arith_u64 modulus) {
+    // See internal_barrett_reduce_2_by_1_u64() for how these constants are used. The reciprocal is computed as
+    // floor(((2^64 - 1 - d) * 2^64 + 2^64 - 1) / d), which equals floor((2^128 - 1) / d) - 2^64 and fits in 64 bits
+    // since d >= 2^63.
+
+    barrett->modulus    = modulus;
+    barrett->shift      = 63 - internal_bsr_u64(modulus);
+    barrett->divisor    = modulus << barrett->shift;
+    barrett->reciprocal = (arith_u64)((((arith_u128)~barrett->divisor << 64) | ARITH_U64_MAX) / barrett->divisor);
+}
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/barrett.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 arith_barrett_mod_mul_u64(const arith_barrett_u64* barrett, const arith_u64 multiplier,
+                                           const arith_u64 multiplicand) {
+    return internal_barrett_mod_mul_u64(barrett, multiplier, multiplicand);
+}
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/barrett.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u32 arith_barrett_reduce_u32(const arith_barrett_u32* barrett, const arith_u64 x) {
+    return internal_barrett_reduce_u32(barrett, x);
+}
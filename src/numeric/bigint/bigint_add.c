@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "numeric/bigint/bigint_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_add(arith_bigint_arena* arena, const arith_bigint* a, const arith_bigint* b,
+                             arith_bigint* out) {
+    const arith_bigint* longer  = (a->length >= b->length) ? a : b;
+    const arith_bigint* shorter = (a->length >= b->length) ? b : a;
+    const size_t count          = longer->length + 1;
+
+    arith_u64* limbs = internal_bigint_output(arena, out, count, NULL, NULL);
+    if (limbs == NULL)
+        return false;
+
+    limbs[count - 1] = internal_bigint_add(longer->limbs, longer->length, shorter->limbs, shorter->length, limbs);
+    internal_bigint_store(out, limbs, count);
+
+    return true;
+}
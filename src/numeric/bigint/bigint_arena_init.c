@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stddef.h>
+
+#include "arithmos/core/types.h"
+
+
+
+extern void arith_bigint_arena_init(arith_bigint_arena* arena, arith_u64* memory, const size_t capacity) {
+    arena->memory   = memory;
+    arena->capacity = capacity;
+    arena->used     = 0;
+}
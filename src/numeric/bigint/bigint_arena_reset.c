@@ -0,0 +1,10 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+
+
+extern void arith_bigint_arena_reset(arith_bigint_arena* arena) {
+    arena->used = 0;
+}
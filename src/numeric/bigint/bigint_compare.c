@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include "numeric/bigint/bigint_internal.h"
+
+
+
+extern int arith_bigint_compare(const arith_bigint* a, const arith_bigint* b) {
+    if (a->length != b->length)
+        return (a->length < b->length) ? -1 : 1;
+
+    return internal_bigint_compare(a->limbs, b->limbs, a->length);
+}
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+
+#include "cpu_dispatch.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_bigint_mul,
+                           (const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_bigint* a,
+                            const arith_bigint* b, arith_bigint* out));
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stddef.h>
+
+
+
+extern void arith_bigint_init(arith_bigint* x) {
+    x->limbs    = NULL;
+    x->length   = 0;
+    x->capacity = 0;
+}
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_BIGINT_INTERNAL_H_
+#define ARITHMOS_NUMERIC_BIGINT_INTERNAL_H_
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#if defined(__x86_64__)
+#    include <immintrin.h>
+#endif  // #if defined(__x86_64__)
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/bigint.h"
+
+
+
+// The routines below work on plain arrays of limbs, least significant first and with a length that is passed along,
+// so that the public functions can share them. Unlike `arith_bigint`, the arrays may end in zero limbs.
+
+
+// If the operands have fewer limbs than this, they are multiplied by schoolbook multiplication.
+#define BIGINT_KARATSUBA_THRESHOLD 32
+
+// If the operands have at least this many limbs, they are multiplied by Toom-3 instead of Karatsuba multiplication.
+#define BIGINT_TOOM3_THRESHOLD 128
+
+// If the shorter operand has at least this many limbs, the operands are multiplied with NTTs if the tables allow. They
+// beat Toom-3 multiplication from here on (about 110 us against 220 us for two operands of 512 limbs).
+#define BIGINT_NTT_THRESHOLD 256
+
+
+// Returns the lower limb of `a + b + *carry`, and stores its carry in `carry`.
+static INLINE arith_u64 internal_add_carry_u64(const arith_u64 a, const arith_u64 b, unsigned char* carry) {
+#if defined(__x86_64__)
+
+    unsigned long long sum;
+    *carry = _addcarry_u64(*carry, a, b, &sum);
+
+    return sum;
+
+#else
+
+    const arith_u64 partial = a + b;
+    const arith_u64 sum     = partial + *carry;
+    *carry                  = (unsigned char)((partial < a) | (sum < partial));
+
+    return sum;
+
+#endif  // #if defined(__x86_64__)
+}
+
+// Returns the lower limb of `a - b - *borrow`, and stores its borrow in `borrow`.
+static INLINE arith_u64 internal_sub_borrow_u64(const arith_u64 a, const arith_u64 b, unsigned char* borrow) {
+#if defined(__x86_64__)
+
+    unsigned long long difference;
+    *borrow = _subborrow_u64(*borrow, a, b, &difference);
+
+    return difference;
+
+#else
+
+    const arith_u64 partial    = a - b;
+    const arith_u64 difference = partial - *borrow;
+    *borrow                    = (unsigned char)((a < b) | (partial < *borrow));
+
+    return difference;
+
+#endif  // #if defined(__x86_64__)
+}
+
+
+// Returns the number of the `count` limbs of `limbs` that are left without the leading zeros.
+static INLINE size_t internal_bigint_trim(const arith_u64* limbs, size_t count) {
+    while (count > 0 && limbs[count - 1] == 0)
+        --count;
+
+    return count;
+}
+
+// Returns a negative value, `0` or a positive value if `a` is smaller than, equal to or larger than `b`, both with
+// `count` limbs.
+static INLINE int internal_bigint_compare(const arith_u64* a, const arith_u64* b, size_t count) {
+    while (count-- > 0) {
+        if (a[count] != b[count])
+            return (a[count] < b[count]) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+// Stores the `count` lower limbs of `a + b` in `out` and returns the carry. `out` may be `a` or `b`.
+static INLINE unsigned char internal_bigint_add_n(const arith_u64* a, const arith_u64* b, const size_t count,
+                                                  arith_u64* out) {
+    unsigned char carry = 0;
+    for (size_t i = 0; i < count; ++i)
+        out[i] = internal_add_carry_u64(a[i], b[i], &carry);
+
+    return carry;
+}
+
+// Stores the `count` lower limbs of `a - b` in `out` and returns the borrow. `out` may be `a` or `b`.
+static INLINE unsigned char internal_bigint_sub_n(const arith_u64* a, const arith_u64* b, const size_t count,
+                                                  arith_u64* out) {
+    unsigned char borrow = 0;
+    for (size_t i = 0; i < count; ++i)
+        out[i] = internal_sub_borrow_u64(a[i], b[i], &borrow);
+
+    return borrow;
+}
+
+// Stores the `a_count` lower limbs of `a + b` in `out` and returns the carry, with `a_count >= b_count`. `out` may be
+// `a` or `b`.
+static INLINE unsigned char internal_bigint_add(const arith_u64* a, const size_t a_count, const arith_u64* b,
+                                                const size_t b_count, arith_u64* out) {
+    unsigned char carry = internal_bigint_add_n(a, b, b_count, out);
+    for (size_t i = b_count; i < a_count; ++i)
+        out[i] = internal_add_carry_u64(a[i], 0, &carry);
+
+    return carry;
+}
+
+// Stores the `a_count` lower limbs of `a - b` in `out` and returns the borrow, with `a_count >= b_count`. `out` may be
+// `a` or `b`.
+static INLINE unsigned char internal_bigint_sub(const arith_u64* a, const size_t a_count, const arith_u64* b,
+                                                const size_t b_count, arith_u64* out) {
+    unsigned char borrow = internal_bigint_sub_n(a, b, b_count, out);
+    for (size_t i = b_count; i < a_count; ++i)
+        out[i] = internal_sub_borrow_u64(a[i], 0, &borrow);
+
+    return borrow;
+}
+
+// Stores the `count` limbs of `a * multiplier` in `out` and returns the limb above them. `out` may be `a`.
+static INLINE arith_u64 internal_bigint_mul_1(const arith_u64* a, const size_t count, const arith_u64 multiplier,
+                                              arith_u64* out) {
+    arith_u64 carry = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u128 product = internal_multiply_u64(a[i], multiplier) + carry;
+        out[i]                   = (arith_u64)product;
+        carry                    = (arith_u64)(product >> 64);
+    }
+
+    return carry;
+}
+
+// Adds `a * multiplier` to the `count` limbs of `out` and returns the limb above them. `out` must not overlap `a`.
+static INLINE arith_u64 internal_bigint_addmul_1(const arith_u64* a, const size_t count, const arith_u64 multiplier,
+                                                 arith_u64* out) {
+    // The sum of the product of two limbs and two more limbs still fits into two limbs.
+    arith_u64 carry = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u128 product = internal_multiply_u64(a[i], multiplier) + out[i] + carry;
+        out[i]                   = (arith_u64)product;
+        carry                    = (arith_u64)(product >> 64);
+    }
+
+    return carry;
+}
+
+
+// Returns room for `count` limbs from `arena`, or `NULL` if it is exhausted.
+static INLINE arith_u64* internal_bigint_allocate(arith_bigint_arena* arena, const size_t count) {
+    if (count > arena->capacity - arena->used)
+        return NULL;
+
+    arith_u64* limbs  = arena->memory + arena->used;
+    arena->used      += count;
+
+    return limbs;
+}
+
+// Returns an array of `count` limbs for the result of an operation that is to be stored in `x`: the limbs of `x` if
+// they have room and are not those of `a` or `b`, which may be `NULL`, and new ones from `arena` otherwise. Returns
+// `NULL` if `arena` is exhausted.
+static INLINE arith_u64* internal_bigint_output(arith_bigint_arena* arena, const arith_bigint* x, const size_t count,
+                                                const arith_bigint* a, const arith_bigint* b) {
+    const bool shared = (a != NULL && x->limbs == a->limbs) || (b != NULL && x->limbs == b->limbs);
+    if (x->capacity >= count && (!shared || x->limbs == NULL))
+        return x->limbs;
+
+    return internal_bigint_allocate(arena, count);
+}
+
+// Sets `x` to the integer with the `count` limbs `limbs`, which was returned by internal_bigint_output() for `x` and
+// `count`.
+static INLINE void internal_bigint_store(arith_bigint* x, arith_u64* limbs, const size_t count) {
+    if (limbs != x->limbs) {
+        x->limbs    = limbs;
+        x->capacity = count;
+    }
+
+    x->length = internal_bigint_trim(limbs, count);
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_BIGINT_INTERNAL_H_
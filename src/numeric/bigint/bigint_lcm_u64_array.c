@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "numeric/bigint/bigint_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_lcm_u64_array(arith_bigint_arena* arena, const arith_u64* values, const size_t count,
+                                       arith_bigint* out) {
+    // `lcm(l, n) = l * (n / gcd(l mod n, n))`, and the least common multiple of `i` values has at most `i` limbs.
+    for (size_t i = 0; i < count; ++i) {
+        if (values[i] == 0) {
+            out->length = 0;
+            return true;
+        }
+    }
+
+    // The least common multiple of no values is `1`, as for arith_lcm_u64_array().
+    const size_t capacity = (count == 0) ? 1 : count;
+
+    arith_u64* limbs = internal_bigint_output(arena, out, capacity, NULL, NULL);
+    if (limbs == NULL)
+        return false;
+
+    arith_bigint lcm = {limbs, 1, capacity};
+    limbs[0]         = (count == 0) ? 1 : values[0];
+
+    for (size_t i = 1; i < count; ++i) {
+        const arith_u64 remainder = arith_bigint_mod_u64(&lcm, values[i]);
+        const arith_u64 factor    = (remainder == 0) ? 1 : values[i] / internal_gcd_u64(remainder, values[i]);
+        if (factor > 1) {
+            limbs[lcm.length]  = internal_bigint_mul_1(limbs, lcm.length, factor, limbs);
+            lcm.length        += (limbs[lcm.length] != 0);
+        }
+    }
+
+    internal_bigint_store(out, limbs, lcm.length);
+
+    return true;
+}
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stddef.h>
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 arith_bigint_mod_u64(const arith_bigint* a, const arith_u64 modulus) {
+    // Horner's rule from the leading limb down, with a remainder below `modulus` in the upper half of each dividend.
+    arith_u64 remainder = 0;
+    for (size_t i = a->length; i-- > 0;)
+        remainder = (arith_u64)((((arith_u128)remainder << 64) | a->limbs[i]) % modulus);
+
+    return remainder;
+}
@@ -0,0 +1,399 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "numeric/bigint/bigint_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+static bool internal_bigint_mul_n(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64* a,
+                                  const arith_u64* b, size_t count, arith_u64* out);
+
+
+// Stores the `a_count + b_count` limbs of `a * b` in `out`, which must not overlap the operands. `a_count` and
+// `b_count` must be positive.
+static void internal_bigint_schoolbook(const arith_u64* a, const size_t a_count, const arith_u64* b,
+                                       const size_t b_count, arith_u64* out) {
+    out[a_count] = internal_bigint_mul_1(a, a_count, b[0], out);
+    for (size_t j = 1; j < b_count; ++j)
+        out[a_count + j] = internal_bigint_addmul_1(a, a_count, b[j], out + j);
+}
+
+// Stores `|x - y|` in the `x_count` limbs of `out` and returns whether `x < y`, where `y_count <= x_count <= y_count +
+// 1`.
+static bool internal_bigint_difference(const arith_u64* x, const size_t x_count, const arith_u64* y,
+                                       const size_t y_count, arith_u64* out) {
+    const bool less = (x_count == y_count || x[y_count] == 0) && internal_bigint_compare(x, y, y_count) < 0;
+    if (less) {
+        internal_bigint_sub_n(y, x, y_count, out);
+        if (x_count > y_count)
+            out[y_count] = 0;
+    } else {
+        internal_bigint_sub(x, x_count, y, y_count, out);
+    }
+
+    return less;
+}
+
+// Stores the `2 * count` limbs of `a * b` in `out` by Karatsuba multiplication.
+static bool internal_bigint_karatsuba(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64* a,
+                                      const arith_u64* b, const size_t count, arith_u64* out) {
+    // With `a = a0 + a1 B^k` and `b = b0 + b1 B^k`, the middle coefficient `a0 b1 + a1 b0` of the product is
+    // `a0 b0 + a1 b1 - (a1 - a0) (b1 - b0)`. The differences are taken in absolute value, so that the three products
+    // are of unsigned halves. A square takes three squares.
+    const size_t k      = count / 2;
+    const size_t h      = count - k;
+    const bool square   = (a == b);
+    const size_t mark   = arena->used;
+    arith_u64* buffer   = internal_bigint_allocate(arena, 6 * h + 1);
+    if (buffer == NULL)
+        return false;
+
+    arith_u64* a_difference = buffer;
+    arith_u64* b_difference = square ? a_difference : buffer + h;
+    arith_u64* product      = buffer + 2 * h;
+    arith_u64* middle       = buffer + 4 * h;
+
+    const bool a_negative = internal_bigint_difference(a + k, h, a, k, a_difference);
+    const bool b_negative = square ? a_negative : internal_bigint_difference(b + k, h, b, k, b_difference);
+
+    const bool success = internal_bigint_mul_n(ntt, arena, a, b, k, out)
+                      && internal_bigint_mul_n(ntt, arena, a + k, b + k, h, out + 2 * k)
+                      && internal_bigint_mul_n(ntt, arena, a_difference, b_difference, h, product);
+    if (success) {
+        middle[2 * h] = internal_bigint_add(out + 2 * k, 2 * h, out, 2 * k, middle);
+        if (a_negative == b_negative)
+            middle[2 * h] -= internal_bigint_sub_n(middle, product, 2 * h, middle);
+        else
+            middle[2 * h] += internal_bigint_add_n(middle, product, 2 * h, middle);
+
+        internal_bigint_add(out + k, 2 * count - k, middle, 2 * h + 1, out + k);
+    }
+
+    arena->used = mark;
+
+    return success;
+}
+
+// Replaces the `count` limbs of `x` by those of `-x (mod B^count)`.
+static void internal_bigint_negate(arith_u64* x, const size_t count) {
+    unsigned char borrow = 0;
+    for (size_t i = 0; i < count; ++i)
+        x[i] = internal_sub_borrow_u64(0, x[i], &borrow);
+}
+
+// Divides `x` by `2`, where `x` has `count` limbs in two's complement and is even.
+static void internal_bigint_halve(arith_u64* x, const size_t count) {
+    for (size_t i = 0; i + 1 < count; ++i)
+        x[i] = (x[i] >> 1) | (x[i + 1] << 63);
+
+    x[count - 1] = (x[count - 1] >> 1) | (x[count - 1] & ((arith_u64)1 << 63));
+}
+
+// Divides `x` by `3`, where `x` has `count` limbs in two's complement and is a multiple of `3`.
+static void internal_bigint_divide_by_3(arith_u64* x, const size_t count) {
+    // From the lowest limb up, each limb of the quotient is the limb of the remaining dividend times `3^-1 (mod B)`,
+    // and `3` times it overflows the limb by `0`, `1` or `2`, which is carried as a borrow into the next limb. This
+    // computes `x 3^-1 (mod B^count)`, which is the quotient also if it is negative.
+    const arith_u64 inverse = 0xAAAAAAAAAAAAAAAB;
+
+    arith_u64 borrow = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u64 limb     = x[i];
+        const arith_u64 quotient = (limb - borrow) * inverse;
+        x[i]                     = quotient;
+        borrow = (arith_u64)(limb < borrow) + (quotient >= 0x5555555555555556) + (quotient >= 0xAAAAAAAAAAAAAAAB);
+    }
+}
+
+// Stores the values at `1`, `-1` and `-2` of `a0 + a1 X + a2 X^2`, where `a0` and `a1` are the first `k` limbs of `a`
+// and `a2` the `s` after them, in the `k + 1` limbs of `values`, `values + k + 1` and `values + 2 (k + 1)`. The last
+// two are stored in absolute value, with their signs in `negative`.
+static void internal_bigint_toom3_evaluate(const arith_u64* a, const size_t k, const size_t s, arith_u64* values,
+                                           bool negative[2]) {
+    // `a(-2) = 2 (a(-1) + a2) - a0`. Until the end, `a(-1)` and `a(-2)` are kept in two's complement.
+    const size_t w   = k + 1;
+    arith_u64* one   = values;
+    arith_u64* minus = values + w;
+    arith_u64* two   = values + 2 * w;
+
+    minus[k]  = internal_bigint_add(a, k, a + 2 * k, s, minus);
+    one[k]    = minus[k] + internal_bigint_add_n(minus, a + k, k, one);
+    minus[k] -= internal_bigint_sub_n(minus, a + k, k, minus);
+
+    internal_bigint_add(minus, w, a + 2 * k, s, two);
+    for (size_t i = w - 1; i > 0; --i)
+        two[i] = (two[i] << 1) | (two[i - 1] >> 63);
+    two[0] <<= 1;
+    internal_bigint_sub(two, w, a, k, two);
+
+    negative[0] = (minus[k] >> 63) != 0;
+    negative[1] = (two[k] >> 63) != 0;
+    if (negative[0])
+        internal_bigint_negate(minus, w);
+    if (negative[1])
+        internal_bigint_negate(two, w);
+}
+
+// Stores the `2 * count` limbs of `a * b` in `out` by Toom-3 multiplication.
+static bool internal_bigint_toom3(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64* a,
+                                  const arith_u64* b, const size_t count, arith_u64* out) {
+    // The operands are split into three parts of `k` limbs, the last one shorter, as polynomials in `X = B^k`. Their
+    // product is recovered from its values at `0`, `1`, `-1`, `-2` and infinity with Bodrato's interpolation sequence,
+    // in two's complement of `2k + 2` limbs. A square takes five squares.
+    const size_t k    = (count + 2) / 3;
+    const size_t s    = count - 2 * k;
+    const size_t w    = k + 1;
+    const size_t v    = 2 * w;
+    const bool square = (a == b);
+    const size_t mark = arena->used;
+    arith_u64* buffer = internal_bigint_allocate(arena, 6 * w + 3 * v);
+    if (buffer == NULL)
+        return false;
+
+    arith_u64* a_values = buffer;
+    arith_u64* b_values = square ? a_values : buffer + 3 * w;
+    arith_u64* r1       = buffer + 6 * w;
+    arith_u64* r_minus  = r1 + v;
+    arith_u64* r_two    = r_minus + v;
+    arith_u64* r0       = out;
+    arith_u64* r_inf    = out + 4 * k;
+
+    bool a_negative[2], b_negative[2];
+    internal_bigint_toom3_evaluate(a, k, s, a_values, a_negative);
+    if (square) {
+        b_negative[0] = a_negative[0];
+        b_negative[1] = a_negative[1];
+    } else {
+        internal_bigint_toom3_evaluate(b, k, s, b_values, b_negative);
+    }
+
+    const bool success = internal_bigint_mul_n(ntt, arena, a, b, k, r0)
+                      && internal_bigint_mul_n(ntt, arena, a + 2 * k, b + 2 * k, s, r_inf)
+                      && internal_bigint_mul_n(ntt, arena, a_values, b_values, w, r1)
+                      && internal_bigint_mul_n(ntt, arena, a_values + w, b_values + w, w, r_minus)
+                      && internal_bigint_mul_n(ntt, arena, a_values + 2 * w, b_values + 2 * w, w, r_two);
+    if (success) {
+        if (a_negative[0] != b_negative[0])
+            internal_bigint_negate(r_minus, v);
+        if (a_negative[1] != b_negative[1])
+            internal_bigint_negate(r_two, v);
+
+        // r3 = (r(-2) - r(1)) / 3, r1 = (r(1) - r(-1)) / 2, r2 = r(-1) - r(0), r3 = (r2 - r3) / 2 + 2 r(inf),
+        // r2 = r2 + r1 - r(inf), r1 = r1 - r3.
+        internal_bigint_sub_n(r_two, r1, v, r_two);
+        internal_bigint_divide_by_3(r_two, v);
+        internal_bigint_sub_n(r1, r_minus, v, r1);
+        internal_bigint_halve(r1, v);
+        internal_bigint_sub(r_minus, v, r0, 2 * k, r_minus);
+        internal_bigint_sub_n(r_minus, r_two, v, r_two);
+        internal_bigint_halve(r_two, v);
+        internal_bigint_add(r_two, v, r_inf, 2 * s, r_two);
+        internal_bigint_add(r_two, v, r_inf, 2 * s, r_two);
+        internal_bigint_add_n(r_minus, r1, v, r_minus);
+        internal_bigint_sub(r_minus, v, r_inf, 2 * s, r_minus);
+        internal_bigint_sub_n(r1, r_two, v, r1);
+
+        // The coefficients are nonnegative and their sum fits into `2 count` limbs, so whatever of them lies beyond is
+        // zero.
+        memset(out + 2 * k, 0, 2 * k * sizeof(*out));
+        internal_bigint_add(out + k, 2 * count - k, r1, v, out + k);
+        internal_bigint_add(out + 2 * k, 2 * count - 2 * k, r_minus, v, out + 2 * k);
+        internal_bigint_add(out + 3 * k, 2 * count - 3 * k, r_two, (v < 2 * count - 3 * k) ? v : 2 * count - 3 * k,
+                            out + 3 * k);
+    }
+
+    arena->used = mark;
+
+    return success;
+}
+
+// Stores the `count` limbs of `a` as `2 * count` pieces of 32 bits reduced modulo `modulus` in `pieces`, followed by
+// zeros up to `length`.
+static void internal_bigint_split(const arith_u64* a, const size_t count, const arith_u32 modulus, const size_t length,
+                                  arith_u32* pieces) {
+    for (size_t i = 0; i < count; ++i) {
+        pieces[2 * i]     = (arith_u32)a[i] % modulus;
+        pieces[2 * i + 1] = (arith_u32)(a[i] >> 32) % modulus;
+    }
+
+    memset(pieces + 2 * count, 0, (length - 2 * count) * sizeof(*pieces));
+}
+
+// Stores the `a_count + b_count` limbs of `a * b` in `out` with NTTs of length `2^log_length`, which must hold the
+// product of the 32-bit pieces of the operands.
+static bool internal_bigint_mul_ntt(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64* a,
+                                    const size_t a_count, const arith_u64* b, const size_t b_count, arith_u64* out,
+                                    const unsigned log_length) {
+    // The coefficients of the product of the pieces are below `2^22 * 2^64`, as the transforms have at most `2^23`
+    // values, and hence below the product of the three primes. They are recovered from their residues with Garner's
+    // algorithm, and their sum with the carries gives the limbs of the product.
+    const size_t length = (size_t)1 << log_length;
+    const size_t pieces = 2 * (a_count + b_count);
+    const bool square   = (a == b && a_count == b_count);
+    const size_t mark   = arena->used;
+    arith_u64* buffer   = internal_bigint_allocate(arena, (square ? 3 : 4) * length / 2);
+    if (buffer == NULL)
+        return false;
+
+    arith_u32* residues      = (arith_u32*)buffer;
+    arith_u32* transformed_b = residues + 3 * length;
+
+    for (size_t j = 0; j < 3; ++j) {
+        const arith_ntt_u32* table = &ntt->ntts[j];
+        const arith_u32 modulus    = table->montgomery.modulus;
+        arith_u32* values          = residues + j * length;
+
+        internal_bigint_split(a, a_count, modulus, length, values);
+        arith_ntt_forward_u32(table, values, log_length);
+        if (square) {
+            arith_ntt_pointwise_mul_u32(table, values, values, values, length);
+        } else {
+            internal_bigint_split(b, b_count, modulus, length, transformed_b);
+            arith_ntt_forward_u32(table, transformed_b, log_length);
+            arith_ntt_pointwise_mul_u32(table, values, transformed_b, values, length);
+        }
+        arith_ntt_inverse_u32(table, values, log_length);
+    }
+
+    const arith_u32 p0         = ntt->ntts[0].montgomery.modulus;
+    const arith_u32 p1         = ntt->ntts[1].montgomery.modulus;
+    const arith_u32 p2         = ntt->ntts[2].montgomery.modulus;
+    const arith_u64 p01        = (arith_u64)p0 * p1;
+    const arith_u32 inverse_01 = internal_mod_inverse_u32(p0 % p1, p1);
+    const arith_u32 inverse_2  = internal_mod_inverse_u32((arith_u32)(p01 % p2), p2);
+
+    arith_u128 accumulator = 0;
+    for (size_t i = 0; i < pieces; ++i) {
+        if (i + 1 < pieces) {
+            const arith_u32 r0 = residues[i];
+            const arith_u32 r1 = residues[length + i];
+            const arith_u32 r2 = residues[2 * length + i];
+
+            const arith_u32 x1 = r0 % p1;
+            const arith_u32 v1 = internal_mod_mul_u32((r1 >= x1) ? r1 - x1 : r1 + p1 - x1, inverse_01, p1);
+            const arith_u64 x  = r0 + (arith_u64)v1 * p0;
+            const arith_u32 x2 = (arith_u32)(x % p2);
+            const arith_u32 v2 = internal_mod_mul_u32((r2 >= x2) ? r2 - x2 : r2 + p2 - x2, inverse_2, p2);
+
+            accumulator += x + (arith_u128)v2 * p01;
+        }
+
+        if ((i & 1) == 0)
+            out[i / 2] = (arith_u32)accumulator;
+        else
+            out[i / 2] |= (arith_u64)(arith_u32)accumulator << 32;
+        accumulator >>= 32;
+    }
+
+    arena->used = mark;
+
+    return true;
+}
+
+// Returns the base-2 logarithm of the length of the NTTs for a product of `count` limbs, or `0` if `ntt` is `NULL` or
+// its tables are too short.
+static unsigned internal_bigint_ntt_log_length(const arith_bigint_ntt* ntt, const size_t count) {
+    if (ntt == NULL)
+        return 0;
+
+    const unsigned log_length = internal_bsr_u64(2 * count - 2) + 1;
+
+    return (log_length <= ntt->ntts[0].max_log_length) ? log_length : 0;
+}
+
+// Stores the `2 * count` limbs of `a * b` in `out`, which must not overlap the operands.
+static bool internal_bigint_mul_n(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64* a,
+                                  const arith_u64* b, const size_t count, arith_u64* out) {
+    if (count < BIGINT_KARATSUBA_THRESHOLD) {
+        internal_bigint_schoolbook(a, count, b, count, out);
+        return true;
+    }
+
+    const unsigned log_length = (count >= BIGINT_NTT_THRESHOLD) ? internal_bigint_ntt_log_length(ntt, 2 * count) : 0;
+    if (log_length > 0)
+        return internal_bigint_mul_ntt(ntt, arena, a, count, b, count, out, log_length);
+
+    if (count < BIGINT_TOOM3_THRESHOLD)
+        return internal_bigint_karatsuba(ntt, arena, a, b, count, out);
+
+    return internal_bigint_toom3(ntt, arena, a, b, count, out);
+}
+
+// Stores the `a_count + b_count` limbs of `a * b` in `out`, which must not overlap the operands, with
+// `a_count >= b_count >= 1`.
+static bool internal_bigint_mul(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64* a,
+                                const size_t a_count, const arith_u64* b, const size_t b_count, arith_u64* out) {
+    // The balanced algorithms need operands of the same length, so a longer `a` is split into parts of the length of
+    // `b`. The last part is shorter and is multiplied by `b` in turn.
+    if (b_count < BIGINT_KARATSUBA_THRESHOLD) {
+        internal_bigint_schoolbook(a, a_count, b, b_count, out);
+        return true;
+    }
+
+    const unsigned log_length
+        = (b_count >= BIGINT_NTT_THRESHOLD) ? internal_bigint_ntt_log_length(ntt, a_count + b_count) : 0;
+    if (log_length > 0)
+        return internal_bigint_mul_ntt(ntt, arena, a, a_count, b, b_count, out, log_length);
+
+    if (!internal_bigint_mul_n(ntt, arena, a, b, b_count, out))
+        return false;
+    if (a_count == b_count)
+        return true;
+
+    const size_t mark = arena->used;
+    arith_u64* part   = internal_bigint_allocate(arena, 2 * b_count);
+    bool success      = (part != NULL);
+
+    for (size_t offset = b_count; offset < a_count && success; offset += b_count) {
+        const size_t count = (a_count - offset < b_count) ? a_count - offset : b_count;
+        success            = (count == b_count) ? internal_bigint_mul_n(ntt, arena, a + offset, b, count, part)
+                                                : internal_bigint_mul(ntt, arena, b, b_count, a + offset, count, part);
+        if (success)
+            internal_bigint_add(part, b_count + count, out + offset, b_count, out + offset);
+    }
+
+    arena->used = mark;
+
+    return success;
+}
+
+
+extern bool ARITHMOS_DISPATCHED(arith_bigint_mul)(const arith_bigint_ntt* ntt, arith_bigint_arena* arena,
+                                                  const arith_bigint* a, const arith_bigint* b, arith_bigint* out) {
+    if (a->length == 0 || b->length == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    const arith_bigint* longer  = (a->length >= b->length) ? a : b;
+    const arith_bigint* shorter = (a->length >= b->length) ? b : a;
+    const size_t count          = a->length + b->length;
+    const size_t mark           = arena->used;
+
+    arith_u64* limbs = internal_bigint_output(arena, out, count, a, b);
+    if (limbs == NULL)
+        return false;
+
+    const size_t scratch_mark = arena->used;
+    if (!internal_bigint_mul(ntt, arena, longer->limbs, longer->length, shorter->limbs, shorter->length, limbs)) {
+        arena->used = mark;
+        return false;
+    }
+
+    arena->used = scratch_mark;
+    internal_bigint_store(out, limbs, count);
+
+    return true;
+}
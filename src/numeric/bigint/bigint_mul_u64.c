@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "numeric/bigint/bigint_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_mul_u64(arith_bigint_arena* arena, const arith_bigint* a, const arith_u64 multiplier,
+                                 arith_bigint* out) {
+    if (a->length == 0 || multiplier == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    const size_t count = a->length + 1;
+
+    arith_u64* limbs = internal_bigint_output(arena, out, count, NULL, NULL);
+    if (limbs == NULL)
+        return false;
+
+    limbs[count - 1] = internal_bigint_mul_1(a->limbs, a->length, multiplier, limbs);
+    internal_bigint_store(out, limbs, count);
+
+    return true;
+}
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stddef.h>
+
+#include "arithmos/algebra/ntt.h"
+
+
+
+extern void arith_bigint_ntt_free(arith_bigint_ntt* ntt) {
+    for (size_t j = 0; j < 3; ++j)
+        arith_ntt_free_u32(&ntt->ntts[j]);
+}
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_ntt_init(arith_bigint_ntt* ntt, const unsigned max_log_length) {
+    // `2^23` is the largest power of two dividing `998244353 - 1`.
+    static const arith_u32 primes[3] = {998244353, 469762049, 167772161};
+
+    if (max_log_length > 23)
+        return false;
+
+    for (size_t j = 0; j < 3; ++j) {
+        if (!arith_ntt_init_u32(&ntt->ntts[j], primes[j], max_log_length)) {
+            while (j-- > 0)
+                arith_ntt_free_u32(&ntt->ntts[j]);
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "bit_operations.h"
+#include "numeric/bigint/bigint_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_power_u64(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64 base,
+                                   const arith_u64 exponent, arith_bigint* out) {
+    // Left-to-right binary exponentiation, in two arrays that take turns holding the power. Their room for the result
+    // and one more limb covers the square of any power on the way, whose length is at most twice that of the power.
+    if (exponent == 0 || base <= 1)
+        return arith_bigint_set_u64(arena, out, (exponent == 0) ? 1 : base);
+
+    const arith_u128 bits = (arith_u128)exponent * (internal_bsr_u64(base) + 1);
+    if (bits / 64 >= arena->capacity)
+        return false;
+
+    const size_t count = (size_t)(bits / 64) + 2;
+    const size_t mark  = arena->used;
+
+    arith_u64* limbs = internal_bigint_output(arena, out, count, NULL, NULL);
+    if (limbs == NULL)
+        return false;
+
+    const size_t scratch_mark = arena->used;
+    arith_u64* scratch        = internal_bigint_allocate(arena, count);
+    if (scratch == NULL) {
+        arena->used = mark;
+        return false;
+    }
+
+    arith_bigint power = {limbs, 1, count};
+    arith_bigint other = {scratch, 0, count};
+    limbs[0]           = base;
+
+    for (unsigned bit = internal_bsr_u64(exponent); bit-- > 0;) {
+        if (!arith_bigint_mul(ntt, arena, &power, &power, &other)) {
+            arena->used = mark;
+            return false;
+        }
+
+        const arith_bigint swap = power;
+        power                   = other;
+        other                   = swap;
+
+        if ((exponent >> bit) & 1) {
+            power.limbs[power.length]  = internal_bigint_mul_1(power.limbs, power.length, base, power.limbs);
+            power.length              += (power.limbs[power.length] != 0);
+        }
+    }
+
+    if (power.limbs != limbs)
+        memcpy(limbs, power.limbs, power.length * sizeof(*limbs));
+
+    arena->used = scratch_mark;
+    internal_bigint_store(out, limbs, power.length);
+
+    return true;
+}
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "numeric/bigint/bigint_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_set_u64(arith_bigint_arena* arena, arith_bigint* x, const arith_u64 value) {
+    if (value == 0) {
+        x->length = 0;
+        return true;
+    }
+
+    arith_u64* limbs = internal_bigint_output(arena, x, 1, NULL, NULL);
+    if (limbs == NULL)
+        return false;
+
+    limbs[0] = value;
+    internal_bigint_store(x, limbs, 1);
+
+    return true;
+}
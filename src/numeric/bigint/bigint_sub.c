@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/bigint.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "numeric/bigint/bigint_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_bigint_sub(arith_bigint_arena* arena, const arith_bigint* a, const arith_bigint* b,
+                             arith_bigint* out) {
+    if (arith_bigint_compare(a, b) < 0)
+        return false;
+
+    if (a->length == 0) {
+        out->length = 0;
+        return true;
+    }
+
+    arith_u64* limbs = internal_bigint_output(arena, out, a->length, NULL, NULL);
+    if (limbs == NULL)
+        return false;
+
+    internal_bigint_sub(a->limbs, a->length, b->limbs, b->length, limbs);
+    internal_bigint_store(out, limbs, a->length);
+
+    return true;
+}
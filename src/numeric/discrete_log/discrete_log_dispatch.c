@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/discrete_log.h"
+
+#include <stdbool.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_log_base_discrete_log_u64,
+                           (const arith_log_base_u64* base, const arith_u64 h, arith_u64* x));
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/discrete_log.h"
+
+#include <stdbool.h>
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_discrete_log_u64(const arith_u64 g, const arith_u64 h, const arith_u64 p, arith_u64* x) {
+    arith_log_base_u64 base;
+    if (!arith_log_base_init_u64(&base, g, p))
+        return false;
+
+    const bool found = arith_log_base_discrete_log_u64(&base, h, x);
+    arith_log_base_free_u64(&base);
+
+    return found;
+}
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/discrete_log.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "inline.h"
+#include "numeric/discrete_log/discrete_log_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+// Returns the next pseudorandom number of the xorshift64* generator with state `state`.
+static INLINE arith_u64 internal_log_random_u64(arith_u64* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 0x2545F4914F6CDD1D;
+}
+
+// Computes the logarithm of the Montgomery form `t` to the base `generator` of `subgroup`, by baby-step giant-step with
+// its table. Returns `q` if `t` is not a power of the generator.
+static INLINE arith_u64 internal_log_bsgs_u64(const arith_montgomery_u64* montgomery,
+                                              const arith_log_subgroup_u64* subgroup, const arith_u64 t) {
+    // The giant steps t * generator^(-m * i) are looked up among the baby steps generator^j, and a match gives the
+    // logarithm i * m + j. The first match is the smallest logarithm, since the baby steps are distinct. For a modulus
+    // above 2^32 the tags of different elements may be equal, so a match is checked with an exponentiation, which
+    // takes little compared to the O(sqrt(q)) giant steps.
+    const arith_u64* table = subgroup->table;
+    const arith_u64 q      = subgroup->prime;
+    const arith_u64 m      = subgroup->baby_steps;
+    const arith_u64 mask   = ((arith_u64)1 << subgroup->table_bits) - 1;
+    const unsigned shift   = 64 - subgroup->table_bits;
+    const bool exact       = montgomery->modulus <= (arith_u64)ARITH_U32_MAX + 1;
+
+    arith_u64 key = t;
+    for (arith_u64 i = 0; i < q; i += DISCRETE_LOG_GIANT_STEP_BLOCK * m) {
+        arith_u64 hashes[DISCRETE_LOG_GIANT_STEP_BLOCK];
+        for (unsigned k = 0; k < DISCRETE_LOG_GIANT_STEP_BLOCK; ++k) {
+            hashes[k] = internal_discrete_log_hash_u64(key);
+            key       = internal_montgomery_mul_u64(montgomery, key, subgroup->giant_step);
+            internal_discrete_log_prefetch(table + (hashes[k] >> shift));
+        }
+
+        for (unsigned k = 0; k < DISCRETE_LOG_GIANT_STEP_BLOCK; ++k) {
+            const arith_u64 hash = hashes[k];
+
+            for (arith_u64 slot = hash >> shift; table[slot] != 0; slot = (slot + 1) & mask) {
+                if ((table[slot] >> 32) != (hash & ARITH_U32_MAX))
+                    continue;
+
+                const arith_u64 d = i + k * m + (table[slot] & ARITH_U32_MAX) - 1;
+                if (exact || internal_montgomery_power_u64(montgomery, subgroup->generator, d) == t)
+                    return d;
+            }
+        }
+    }
+
+    return q;
+}
+
+// Computes the logarithm of the Montgomery form `t` to the base `generator` of `subgroup`, by Pollard's rho. `t` must
+// be a power of the generator.
+static INLINE arith_u64 internal_log_rho_u64(const arith_montgomery_u64* montgomery,
+                                             const arith_log_subgroup_u64* subgroup, const arith_u64 t) {
+    // The walk x <- x * M_s, with M_s = generator^alpha_s * t^beta_s for s given by the top bits of the hash of x,
+    // keeps x = generator^a * t^b. Brent's cycle detection compares x with the element saved at the last power of two
+    // steps, and once they are equal, generator^a * t^b = generator^a' * t^b' gives the logarithm (a - a') / (b' - b)
+    // (mod q), unless b = b', which is unlikely but then takes another walk. The exponents are reduced modulo q by
+    // additions only.
+    const arith_u64 q         = subgroup->prime;
+    const arith_u64 generator = subgroup->generator;
+    const unsigned shift      = 64 - DISCRETE_LOG_RHO_BITS;
+
+    arith_u64 state = 0x9E3779B97F4A7C15 ^ t;
+    while (true) {
+        arith_u64 multipliers[1 << DISCRETE_LOG_RHO_BITS];
+        arith_u64 alpha[1 << DISCRETE_LOG_RHO_BITS];
+        arith_u64 beta[1 << DISCRETE_LOG_RHO_BITS];
+        for (unsigned s = 0; s < (1U << DISCRETE_LOG_RHO_BITS); ++s) {
+            alpha[s]       = internal_log_random_u64(&state) % q;
+            beta[s]        = internal_log_random_u64(&state) % q;
+            multipliers[s] = internal_montgomery_mul_u64(montgomery,
+                                                         internal_montgomery_power_u64(montgomery, generator, alpha[s]),
+                                                         internal_montgomery_power_u64(montgomery, t, beta[s]));
+        }
+
+        arith_u64 a = internal_log_random_u64(&state) % q;
+        arith_u64 b = 0;
+        arith_u64 x = internal_montgomery_power_u64(montgomery, generator, a);
+
+        arith_u64 saved_a = a;
+        arith_u64 saved_b = b;
+        arith_u64 saved_x = x;
+        arith_u64 length  = 0;
+        arith_u64 period  = 1;
+        while (true) {
+            const unsigned s = (unsigned)(internal_discrete_log_hash_u64(x) >> shift);
+
+            x = internal_montgomery_mul_u64(montgomery, x, multipliers[s]);
+            a = internal_mod_add_u64(a, alpha[s], q);
+            b = internal_mod_add_u64(b, beta[s], q);
+            if (x == saved_x)
+                break;
+
+            if (++length == period) {
+                saved_a  = a;
+                saved_b  = b;
+                saved_x  = x;
+                length   = 0;
+                period  *= 2;
+            }
+        }
+
+        if (b != saved_b) {
+            const arith_u64 numerator   = internal_mod_add_u64(a, q - saved_a, q);
+            const arith_u64 denominator = internal_mod_add_u64(saved_b, q - b, q);
+
+            return internal_mod_mul_u64(numerator, internal_mod_inverse_odd_u64(denominator, q), q);
+        }
+    }
+}
+
+
+extern bool ARITHMOS_DISPATCHED(arith_log_base_discrete_log_u64)(const arith_log_base_u64* base, const arith_u64 h,
+                                                                 arith_u64* x) {
+    const arith_montgomery_u64* montgomery = &base->montgomery;
+    const arith_u64 one                    = montgomery->one;
+    const arith_u64 order                  = base->order;
+
+    // The group of units modulo p is cyclic, so the powers of g form its only subgroup of order n, and h is a power of
+    // g if and only if h^n = 1. So from here on, every logarithm exists.
+    const arith_u64 mont_h = internal_montgomery_to_mont_u64(montgomery, h);
+    if (mont_h == 0 || internal_montgomery_power_u64(montgomery, mont_h, order) != one)
+        return false;
+
+    arith_u64 result = 0;
+    for (unsigned i = 0; i < base->subgroup_count; ++i) {
+        const arith_log_subgroup_u64* subgroup = &base->subgroups[i];
+        const arith_u64 q                      = subgroup->prime;
+
+        // Pohlig-Hellman: the logarithm of h modulo q^e is that of h^(n / q^e) to the base g^(n / q^e), of order q^e.
+        // Its digits base q are found from the lowest one up. If y is the logarithm modulo q^k, then
+        // (h^(n / q^e) * g^(-y * n / q^e))^(q^(e - 1 - k)) is the power of the generator of order q by digit k.
+        arith_u64 target    = internal_montgomery_power_u64(montgomery, mont_h, subgroup->cofactor);
+        arith_u64 logarithm = 0;
+        arith_u64 place     = 1;
+        for (unsigned k = 0; k < subgroup->exponent; ++k, place *= q) {
+            arith_u64 t = target;
+            for (unsigned j = k + 1; j < subgroup->exponent; ++j)
+                t = internal_montgomery_power_u64(montgomery, t, q);
+
+            if (t == one)
+                continue;
+
+            const arith_u64 digit = (subgroup->table != NULL) ? internal_log_bsgs_u64(montgomery, subgroup, t)
+                                                              : internal_log_rho_u64(montgomery, subgroup, t);
+            if (digit == q)
+                return false;
+
+            const arith_u64 inverse = internal_montgomery_power_u64(montgomery, subgroup->inverse_base, digit * place);
+
+            logarithm += digit * place;
+            target     = internal_montgomery_mul_u64(montgomery, target, inverse);
+        }
+
+        // The Chinese remainder theorem takes one division per prime factor of n, which is negligible.
+        const arith_u64 term = internal_mod_mul_u64(logarithm, subgroup->crt_coefficient, order);
+        result               = internal_mod_add_u64(result, term, order);
+    }
+
+    *x = result;
+    return true;
+}
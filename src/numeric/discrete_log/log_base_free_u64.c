@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/discrete_log.h"
+
+#include <stdlib.h>
+
+
+
+extern void arith_log_base_free_u64(arith_log_base_u64* base) {
+    for (unsigned i = 0; i < base->subgroup_count; ++i) {
+        free(base->subgroups[i].table);
+
+        base->subgroups[i].table = NULL;
+    }
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/discrete_log.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "bit_operations.h"
+#include "numeric/discrete_log/discrete_log_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+// Fills the baby-step table of `subgroup` with the powers `generator^j` for `j < m`, for `m = ceil(sqrt(q))`. Returns
+// `false` if memory could not be allocated.
+static bool internal_log_subgroup_table_u64(const arith_montgomery_u64* montgomery, arith_log_subgroup_u64* subgroup) {
+    // The table is open addressing with linear probing, at a load factor of at most one half. A slot is 8 bytes, the
+    // tag and the index, so a probe sequence mostly stays within one cache line. The baby steps are distinct, since
+    // m <= q.
+    const arith_u64 q     = subgroup->prime;
+    const arith_u64 m     = internal_isqrt_u64(q - 1) + 1;
+    const unsigned bits   = internal_bsr_u64(2 * m - 1) + 1;
+    const arith_u64 mask  = ((arith_u64)1 << bits) - 1;
+    const unsigned shift  = 64 - bits;
+    const arith_u64 gamma = subgroup->generator;
+
+    arith_u64* table = calloc((size_t)1 << bits, sizeof(*table));
+    if (table == NULL)
+        return false;
+
+    arith_u64 key = montgomery->one;
+    for (arith_u64 j = 0; j < m; ++j) {
+        const arith_u64 hash = internal_discrete_log_hash_u64(key);
+
+        arith_u64 slot = hash >> shift;
+        while (table[slot] != 0)
+            slot = (slot + 1) & mask;
+        table[slot] = internal_discrete_log_slot_u64(hash, j);
+
+        key = internal_montgomery_mul_u64(montgomery, key, gamma);
+    }
+
+    subgroup->table_bits = bits;
+    subgroup->baby_steps = m;
+    subgroup->giant_step = internal_montgomery_power_u64(montgomery, gamma, q - m);
+    subgroup->table      = table;
+
+    return true;
+}
+
+
+extern bool arith_log_base_init_u64(arith_log_base_u64* base, const arith_u64 g, const arith_u64 p) {
+    if ((p & 1) == 0 || !arith_is_prime_u64(p) || g % p == 0)
+        return false;
+
+    arith_montgomery_init_u64(&base->montgomery, p);
+    const arith_montgomery_u64* montgomery = &base->montgomery;
+    const arith_u64 one                    = montgomery->one;
+
+    base->base           = internal_montgomery_to_mont_u64(montgomery, g);
+    base->subgroup_count = 0;
+
+    // The order of g divides p - 1. It is found by dividing out every prime factor q as long as g^(n / q) = 1.
+    arith_u64 primes[15];
+    unsigned exponents[15];
+    const unsigned count = arith_factor_u64(p - 1, primes, exponents);
+
+    arith_u64 order = p - 1;
+    for (unsigned i = 0; i < count; ++i) {
+        while (exponents[i] > 0 && internal_montgomery_power_u64(montgomery, base->base, order / primes[i]) == one) {
+            order /= primes[i];
+            --exponents[i];
+        }
+    }
+    base->order = order;
+
+    for (unsigned i = 0; i < count; ++i) {
+        if (exponents[i] == 0)
+            continue;
+
+        const arith_u64 q     = primes[i];
+        arith_u64 prime_power = 1;
+        for (unsigned j = 0; j < exponents[i]; ++j)
+            prime_power *= q;
+
+        arith_log_subgroup_u64* subgroup = &base->subgroups[base->subgroup_count];
+
+        // The subgroup of order q^e is generated by g^(n / q^e), and the coefficient c = n / q^e * ((n / q^e)^-1
+        // (mod q^e)) combines the logarithms modulo the prime powers by the Chinese remainder theorem. It is smaller
+        // than n, as the inverse is smaller than q^e.
+        const arith_u64 cofactor   = order / prime_power;
+        const arith_u64 power_base = internal_montgomery_power_u64(montgomery, base->base, cofactor);
+
+        subgroup->prime           = q;
+        subgroup->exponent        = exponents[i];
+        subgroup->table_bits      = 0;
+        subgroup->cofactor        = cofactor;
+        subgroup->generator       = internal_montgomery_power_u64(montgomery, power_base, prime_power / q);
+        subgroup->inverse_base    = internal_montgomery_power_u64(montgomery, power_base, prime_power - 1);
+        subgroup->giant_step      = one;
+        subgroup->baby_steps      = 0;
+        subgroup->crt_coefficient = cofactor * internal_mod_inverse_u64(cofactor % prime_power, prime_power);
+        subgroup->table           = NULL;
+
+        if (q <= DISCRETE_LOG_MAX_TABLE_PRIME && !internal_log_subgroup_table_u64(montgomery, subgroup)) {
+            arith_log_base_free_u64(base);
+            return false;
+        }
+
+        ++base->subgroup_count;
+    }
+
+    return true;
+}
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/fixed_base.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_fixed_base_power_u64,
+                           (const arith_fixed_base_u64* fixed_base, const arith_u64 exponent));
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_fixed_base_power_u64_batch,
+                           (const arith_fixed_base_u64* fixed_base, const arith_u64* exponent, arith_u64* out,
+                            const size_t count));
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/fixed_base.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+
+extern void arith_fixed_base_free_u64(arith_fixed_base_u64* fixed_base) {
+    free(fixed_base->table);
+
+    fixed_base->table = NULL;
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/fixed_base.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "numeric/fixed_base/fixed_base_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+extern bool arith_fixed_base_init_u64(arith_fixed_base_u64* fixed_base, const arith_u64 base, const arith_u64 modulus,
+                                      const unsigned width) {
+    if ((modulus & 1) == 0 || width == 0 || width > FIXED_BASE_MAX_WIDTH)
+        return false;
+
+    const unsigned positions = (64 + width - 1) / width;
+    const size_t digits      = (size_t)1 << width;
+
+    arith_u64* table = malloc(positions * digits * sizeof(*table));
+    if (table == NULL)
+        return false;
+
+    arith_montgomery_init_u64(&fixed_base->montgomery, modulus);
+    const arith_montgomery_u64* montgomery = &fixed_base->montgomery;
+
+    fixed_base->width     = width;
+    fixed_base->positions = positions;
+    fixed_base->table     = table;
+
+    // Row `j` holds the powers of `base^(2^(width * j))`, and its last entry times that power is the power for the next
+    // row, so filling the table takes one multiplication per entry.
+    arith_u64 power = internal_montgomery_to_mont_u64(montgomery, base);
+    for (unsigned j = 0; j < positions; ++j) {
+        arith_u64* row = table + j * digits;
+
+        row[0] = montgomery->one;
+        for (size_t d = 1; d < digits; ++d)
+            row[d] = internal_montgomery_mul_u64(montgomery, row[d - 1], power);
+
+        power = internal_montgomery_mul_u64(montgomery, row[digits - 1], power);
+    }
+
+    return true;
+}
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_FIXED_BASE_INTERNAL_H_
+#define ARITHMOS_NUMERIC_FIXED_BASE_INTERNAL_H_
+
+
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/fixed_base.h"
+
+
+
+// The largest number of bits per digit, for which the table takes 2 MiB.
+#define FIXED_BASE_MAX_WIDTH 16
+
+
+// Computes `base^exponent` in Montgomery form for the base of `fixed_base`.
+static INLINE arith_u64 internal_fixed_base_power_u64(const arith_fixed_base_u64* fixed_base, arith_u64 exponent) {
+    // The product of the table entries of the digits of the exponent. The entries of the even and the odd positions are
+    // multiplied into separate products, which halves the length of the chain of dependent multiplications. The table
+    // entry of a zero digit is `1`, so no digit needs a branch.
+    const arith_montgomery_u64* montgomery = &fixed_base->montgomery;
+
+    const unsigned width = fixed_base->width;
+    const arith_u64 mask = ((arith_u64)1 << width) - 1;
+    const arith_u64* row = fixed_base->table;
+
+    arith_u64 even = montgomery->one;
+    arith_u64 odd  = montgomery->one;
+    while (exponent != 0) {
+        even       = internal_montgomery_mul_u64(montgomery, even, row[exponent & mask]);
+        exponent >>= width;
+        row       += mask + 1;
+        if (exponent == 0)
+            break;
+
+        odd        = internal_montgomery_mul_u64(montgomery, odd, row[exponent & mask]);
+        exponent >>= width;
+        row       += mask + 1;
+    }
+
+    return internal_montgomery_mul_u64(montgomery, even, odd);
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_FIXED_BASE_INTERNAL_H_
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/fixed_base.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/fixed_base/fixed_base_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 ARITHMOS_DISPATCHED(arith_fixed_base_power_u64)(const arith_fixed_base_u64* fixed_base,
+                                                                 const arith_u64 exponent) {
+    return internal_montgomery_from_mont_u64(&fixed_base->montgomery,
+                                             internal_fixed_base_power_u64(fixed_base, exponent));
+}
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/fixed_base.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/fixed_base/fixed_base_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern void ARITHMOS_DISPATCHED(arith_fixed_base_power_u64_batch)(const arith_fixed_base_u64* fixed_base,
+                                                                  const arith_u64* exponent, arith_u64* out,
+                                                                  const size_t count) {
+    // The exponentiations are independent, so the loop keeps several of them in flight. Each reads one table entry per
+    // digit, which stays in cache for the tables of moderate width that this is meant for.
+    for (size_t i = 0; i < count; ++i)
+        out[i] = internal_montgomery_from_mont_u64(&fixed_base->montgomery,
+                                                   internal_fixed_base_power_u64(fixed_base, exponent[i]));
+}
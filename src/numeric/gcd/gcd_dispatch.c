@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(arith_i32, arith_gcd_i32, (const arith_i32 m, const arith_i32 n));
+ARITHMOS_DEFINE_DISPATCHER(arith_i64, arith_gcd_i64, (const arith_i64 m, const arith_i64 n));
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_gcd_u32, (arith_u32 m, arith_u32 n));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_gcd_u64, (arith_u64 m, arith_u64 n));
+
+ARITHMOS_DEFINE_DISPATCHER(arith_i32, arith_xgcd_i32,
+                           (const arith_i32 m, const arith_i32 n, arith_i32* x, arith_i32* y));
+ARITHMOS_DEFINE_DISPATCHER(arith_i64, arith_xgcd_i64,
+                           (const arith_i64 m, const arith_i64 n, arith_i64* x, arith_i64* y));
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_xgcd_u32, (arith_u32 m, arith_u32 n, arith_i32* x, arith_i32* y));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_xgcd_u64, (arith_u64 m, arith_u64 n, arith_i64* x, arith_i64* y));
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_gcd_u32_batch,
+                           (const arith_u32* m, const arith_u32* n, arith_u32* out, const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(void, arith_gcd_u64_batch,
+                           (const arith_u64* m, const arith_u64* n, arith_u64* out, const size_t count));
+
+ARITHMOS_DEFINE_DISPATCHER(arith_i32, arith_gcd_i32_array, (const arith_i32* values, const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(arith_i64, arith_gcd_i64_array, (const arith_i64* values, const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_gcd_u32_array, (const arith_u32* values, const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_gcd_u64_array, (const arith_u64* values, const size_t count));
+
+ARITHMOS_DEFINE_DISPATCHER(int, arith_jacobi_u64, (const arith_u64 a, const arith_u64 n));
+ARITHMOS_DEFINE_DISPATCHER(int, arith_jacobi_i64, (const arith_i64 a, const arith_i64 n));
+ARITHMOS_DEFINE_DISPATCHER(int, arith_kronecker_i64, (const arith_i64 a, const arith_i64 n));
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_jacobi_u64_batch,
+                           (const arith_u64* a, const arith_u64* n, int* out, const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(void, arith_jacobi_i64_batch,
+                           (const arith_i64* a, const arith_i64* n, int* out, const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(void, arith_kronecker_i64_batch,
+                           (const arith_i64* a, const arith_i64* n, int* out, const size_t count));
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+// The number of values that are reduced as a tree at once. It must be a power of 2.
+#define GCD_ARRAY_BLOCK 64
+
+
+
+extern arith_i32 ARITHMOS_DISPATCHED(arith_gcd_i32_array)(const arith_i32* values, const size_t count) {
+    // See gcd_u64_array.c for implementation details. The absolute values of a block are copied first, so that the
+    // whole tree is reduced in place.
+
+    arith_u32 block[GCD_ARRAY_BLOCK];
+    arith_u32 gcd = 0;
+    size_t i      = 0;
+
+    for (; gcd != 1 && count - i >= GCD_ARRAY_BLOCK; i += GCD_ARRAY_BLOCK) {
+        for (size_t j = 0; j < GCD_ARRAY_BLOCK; ++j)
+            block[j] = internal_unsigned_abs_i32(values[i + j]);
+        for (size_t width = GCD_ARRAY_BLOCK / 2; width > 0; width /= 2)
+            arith_gcd_u32_batch(block, block + width, block, width);
+
+        gcd = arith_gcd_u32(gcd, block[0]);
+    }
+
+    for (; gcd != 1 && i < count; ++i)
+        gcd = arith_gcd_u32(gcd, internal_unsigned_abs_i32(values[i]));
+
+    return (arith_i32)gcd;
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_GCD_INTERNAL_H_
+#define ARITHMOS_NUMERIC_GCD_INTERNAL_H_
+
+
+#include <stdbool.h>
+
+#include "bit_operations.h"
+#include "expect.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+// Computes `(-1)^s * (a / n)`, where `(a / n)` is the Jacobi symbol and `s` is bit 1 of `sign`. `n` must be odd.
+static INLINE int internal_jacobi_u64(arith_u64 a, arith_u64 n, arith_u64 sign) {
+    // The Jacobi symbol is computed like the binary GCD of gcd_u64.c. For odd n, one can verify that
+    //
+    //     (0 / n) = 1 if n = 1, and 0 otherwise                                           (1)
+    //     (2a / n) = (-1)^((n^2 - 1) / 8) * (a / n)                                        (2)
+    //     (a / n) = (a - n / n)                                                            (3)
+    //     (a / n) = (-1)^((a - 1) / 2 * (n - 1) / 2) * (n / a),   if a is odd as well.    (4)
+    //
+    // The sign of (2) is -1 if and only if n = 3, 5 (mod 8), that is if bit 1 of n ^ (n >> 1) is set, and that of (4)
+    // is -1 if and only if a = n = 3 (mod 4), that is if bit 1 of a & n is set. So we collect the signs in bit 1 of
+    // `sign` with exclusive ors. After removing the factors 2 of a with (2), both a and n are odd, and we apply (3),
+    // preceded by (4) if a < n, and (2) again, until a = n, which is the gcd of a and n. Then the symbol is 0 unless
+    // the gcd is 1, by (3) and (1).
+    //
+    // The time complexity of this implementation is O(log(max(a, n))), without any divisions.
+
+    if (a == 0)
+        return (n == 1) ? 1 - (int)(sign & 2) : 0;
+
+    // Only bit 1 of `sign` matters, so the sign of (2) is applied as `(k << 1) & (n ^ (n >> 1))` for the exponent k of
+    // 2, rather than with a branch on the parity of k.
+    unsigned k = internal_ctz_u64(a);
+    a >>= k;
+    sign ^= ((arith_u64)k << 1) & (n ^ (n >> 1));
+
+    while (true) {
+        // As in gcd_u64.c, both a - n and n - a are computed, so that the swap takes conditional moves rather than a
+        // branch, which would be mispredicted about half of the time.
+
+        const arith_u64 a_cpy = a;
+        const arith_u64 diff  = a - n;
+
+        if (internal_unlikely(diff == 0))
+            return (n == 1) ? 1 - (int)(sign & 2) : 0;
+
+        const arith_u64 swap = -(arith_u64)(a_cpy < n);
+        sign                ^= a_cpy & n & swap;
+        a                    = (diff ^ swap) - swap;
+        n                    = (a_cpy < n) ? a_cpy : n;
+
+        k = internal_ctz_u64(a);
+        a >>= k;
+        sign ^= ((arith_u64)k << 1) & (n ^ (n >> 1));
+    }
+}
+
+// Computes the Kronecker symbol `(a / n)`.
+static INLINE int internal_kronecker_i64(const arith_i64 a, const arith_i64 n) {
+    // The Kronecker symbol extends the Jacobi symbol multiplicatively to all n, with
+    //
+    //     (a / 0) = 1 if a = -1, 1, and 0 otherwise,
+    //     (a / -1) = -1 if a < 0, and 1 otherwise,
+    //     (a / 2) = 0 if a is even, 1 if a = 1, 7 (mod 8), and -1 if a = 3, 5 (mod 8).
+    //
+    // The last one only depends on |a| (mod 8), like (2) in internal_jacobi_u64(). After removing the factors -1 and 2
+    // of n, what is left is a Jacobi symbol, and (-a / n) is handled as in jacobi_i64.c.
+
+    if (n == 0)
+        return (a == 1 || a == -1) ? 1 : 0;
+
+    const arith_u64 ua = internal_unsigned_abs_i64(a);
+    arith_u64 un       = internal_unsigned_abs_i64(n);
+    arith_u64 sign     = (a < 0 && n < 0) ? 2 : 0;
+
+    if ((un & 1) == 0) {
+        if ((ua & 1) == 0)
+            return 0;
+
+        const unsigned k = internal_ctz_u64(un);
+        un >>= k;
+        if ((k & 1) == 1)
+            sign ^= ua ^ (ua >> 1);
+    }
+
+    if (a < 0)
+        sign ^= un;
+
+    return internal_jacobi_u64(ua, un, sign);
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_GCD_INTERNAL_H_
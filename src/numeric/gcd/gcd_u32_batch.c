@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+
+#include "arithmos/core/types.h"
+
+
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+// Computes the greatest common devisor of each pair of 32-bit lanes of `m` and `n`.
+static INLINE __m512i internal_gcd_u32x16(__m512i m, __m512i n) {
+    // See gcd_u64_batch.c for implementation details.
+
+    const __m512i m_or_n     = _mm512_or_si512(m, n);
+    const __mmask16 has_zero = _mm512_testn_epi32_mask(m, m) | _mm512_testn_epi32_mask(n, n);
+    m                        = _mm512_mask_mov_epi32(m, has_zero, m_or_n);
+    n                        = _mm512_mask_mov_epi32(n, has_zero, m_or_n);
+
+    const __m512i k = internal_ctz_u32x16(m_or_n);
+    m               = _mm512_srlv_epi32(m, internal_ctz_u32x16(m));
+    n               = _mm512_srlv_epi32(n, internal_ctz_u32x16(n));
+
+    __mmask16 active = _mm512_test_epi32_mask(n, n);
+    while (active != 0) {
+        const __m512i minimum    = _mm512_min_epu32(m, n);
+        const __m512i difference = _mm512_sub_epi32(_mm512_max_epu32(m, n), minimum);
+
+        m      = _mm512_mask_mov_epi32(m, active, minimum);
+        n      = _mm512_maskz_srlv_epi32(active, difference, internal_ctz_u32x16(difference));
+        active = _mm512_test_epi32_mask(n, n);
+    }
+
+    return _mm512_sllv_epi32(m, k);
+}
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+// Computes the greatest common devisor of each pair of 32-bit lanes of `m` and `n`.
+static INLINE __m256i internal_gcd_u32x8(__m256i m, __m256i n) {
+    // See gcd_u64_batch.c for implementation details.
+
+    const __m256i zero     = _mm256_setzero_si256();
+    const __m256i m_or_n   = _mm256_or_si256(m, n);
+    const __m256i has_zero = _mm256_or_si256(_mm256_cmpeq_epi32(m, zero), _mm256_cmpeq_epi32(n, zero));
+    m                      = _mm256_blendv_epi8(m, m_or_n, has_zero);
+    n                      = _mm256_blendv_epi8(n, m_or_n, has_zero);
+
+    const __m256i k = internal_ctz_u32x8(m_or_n);
+    m               = _mm256_srlv_epi32(m, internal_ctz_u32x8(m));
+    n               = _mm256_srlv_epi32(n, internal_ctz_u32x8(n));
+
+    while (!_mm256_testz_si256(n, n)) {
+        const __m256i inactive   = _mm256_cmpeq_epi32(n, zero);
+        const __m256i minimum    = _mm256_min_epu32(m, n);
+        const __m256i difference = _mm256_sub_epi32(_mm256_max_epu32(m, n), minimum);
+
+        m = _mm256_blendv_epi8(minimum, m, inactive);
+        n = _mm256_andnot_si256(inactive, _mm256_srlv_epi32(difference, internal_ctz_u32x8(difference)));
+    }
+
+    return _mm256_sllv_epi32(m, k);
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+
+extern void ARITHMOS_DISPATCHED(arith_gcd_u32_batch)(const arith_u32* m, const arith_u32* n, arith_u32* out,
+                                                     const size_t count) {
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+    for (; i + 16 <= count; i += 16) {
+        const __m512i gcd = internal_gcd_u32x16(_mm512_loadu_si512(m + i), _mm512_loadu_si512(n + i));
+        _mm512_storeu_si512(out + i, gcd);
+    }
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256i gcd = internal_gcd_u32x8(_mm256_loadu_si256((const __m256i*)(m + i)),
+                                               _mm256_loadu_si256((const __m256i*)(n + i)));
+        _mm256_storeu_si256((__m256i*)(out + i), gcd);
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+    // The remaining pairs do not fill a vector, so they go through the scalar implementation.
+    for (; i < count; ++i)
+        out[i] = arith_gcd_u32(m[i], n[i]);
+}
@@ -3,16 +3,14 @@
 
 #include "arithmos/numeric/gcd.h"
 
-#include <stdbool.h>
-
-#include "bit_operations.h"
-#include "expect.h"
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
 
 #include "arithmos/core/types.h"
 
 
 
-extern arith_u64 arith_gcd_u64(arith_u64 m, arith_u64 n) {
+extern arith_u64 ARITHMOS_DISPATCHED(arith_gcd_u64)(arith_u64 m, arith_u64 n) {
     // The GCD is computed using the binary GCD algorithm. One can verify that
     //
     //     gcd(m, n) = m,                  if n = 0                    (1)
@@ -24,6 +22,11 @@ extern arith_u64 arith_gcd_u64(arith_u64 m, arith_u64 n) {
     // we apply (3), both m and n are odd so (4) can be applied. Therefore, by repeating (3) and (4), we eventually
     // reach a situation like (1), where we can return.
     //
+    // The loop is internal_gcd_u64(), which is shared with the lcm and array functions and needs both operands to be
+    // nonzero. It uses a trick, where it computes both m - n and n - m. This way, if m > n at the start of the loop,
+    // we simply need two conditional move instructions instead of creating a new branch, which drastically reduces
+    // branch predicition misses.
+    //
     // The time complexity of this implementation is O(log(min(m, n))).
 
 
@@ -33,29 +36,5 @@ extern arith_u64 arith_gcd_u64(arith_u64 m, arith_u64 n) {
     if (n == 0)
         return m;
 
-    const unsigned i = internal_ctz_u64(m);
-    m >>= i;
-    const unsigned j = internal_ctz_u64(n);
-    n >>= j;
-    const unsigned k = (i < j) ? i : j;
-
-    while (true) {
-        // We use a trick here, where we compute both m - n (stored in diff) and n - m (stored in n). This way, if
-        // m > n at the start of the loop, we simply need two conditional move instructions instead of creating a new
-        // branch, which drastically reduces branch predicition misses.
-
-        const arith_u64 n_cpy = n;
-        const arith_u64 diff  = m - n;
-        n                     = -diff;
-
-        if (internal_unlikely(n == 0))
-            return m << k;
-
-        if (m > n_cpy) {
-            m = n_cpy;
-            n = diff;
-        }
-
-        n >>= internal_ctz_u64(n);
-    }
+    return internal_gcd_u64(m, n);
 }
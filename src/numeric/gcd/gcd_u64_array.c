@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+// The number of values that are reduced as a tree at once. It must be a power of 2.
+#define GCD_ARRAY_BLOCK 64
+
+
+
+extern arith_u64 ARITHMOS_DISPATCHED(arith_gcd_u64_array)(const arith_u64* values, const size_t count) {
+    // Folding the values into a running gcd makes every gcd depend on the previous one, so that they cannot overlap.
+    // Instead, every block of GCD_ARRAY_BLOCK values is reduced as a balanced tree of pairwise gcds. The pairs of one
+    // level are independent, so arith_gcd_u64_batch() computes them several at once with SIMD instructions. The gcds
+    // of the blocks are then folded into the running gcd, and once that is 1, the remaining values cannot change it.
+
+    arith_u64 block[GCD_ARRAY_BLOCK / 2];
+    arith_u64 gcd = 0;
+    size_t i      = 0;
+
+    for (; gcd != 1 && count - i >= GCD_ARRAY_BLOCK; i += GCD_ARRAY_BLOCK) {
+        arith_gcd_u64_batch(values + i, values + i + GCD_ARRAY_BLOCK / 2, block, GCD_ARRAY_BLOCK / 2);
+        for (size_t width = GCD_ARRAY_BLOCK / 4; width > 0; width /= 2)
+            arith_gcd_u64_batch(block, block + width, block, width);
+
+        gcd = arith_gcd_u64(gcd, block[0]);
+    }
+
+    for (; gcd != 1 && i < count; ++i)
+        gcd = arith_gcd_u64(gcd, values[i]);
+
+    return gcd;
+}
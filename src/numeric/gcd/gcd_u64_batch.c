@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+// Computes the greatest common devisor of each pair of 64-bit lanes of `m` and `n`.
+static INLINE __m512i internal_gcd_u64x8(__m512i m, __m512i n) {
+    // Every lane runs the binary GCD loop of gcd_u64.c, with the branchless swap written as a minimum and a
+    // difference:
+    //
+    //     (m, n) <- (min(m, n), (max(m, n) - min(m, n)) >> ctz(...)).
+    //
+    // A lane is done once its n reaches 0. From then on it is masked out, so that its m is kept while the other lanes
+    // continue, and the loop ends when all lanes are done.
+    //
+    // Rather than branching on a zero operand per lane, we replace both operands of such a lane by m | n, which is
+    // the nonzero operand (or 0). Its gcd with itself is itself, and the common power of 2 is ctz(m | n) in every
+    // case. If both operands are 0, all shift counts are out of range, which makes the result 0.
+
+    const __m512i m_or_n    = _mm512_or_si512(m, n);
+    const __mmask8 has_zero = _mm512_testn_epi64_mask(m, m) | _mm512_testn_epi64_mask(n, n);
+    m                       = _mm512_mask_mov_epi64(m, has_zero, m_or_n);
+    n                       = _mm512_mask_mov_epi64(n, has_zero, m_or_n);
+
+    const __m512i k = internal_ctz_u64x8(m_or_n);
+    m               = _mm512_srlv_epi64(m, internal_ctz_u64x8(m));
+    n               = _mm512_srlv_epi64(n, internal_ctz_u64x8(n));
+
+    __mmask8 active = _mm512_test_epi64_mask(n, n);
+    while (active != 0) {
+        const __m512i minimum    = _mm512_min_epu64(m, n);
+        const __m512i difference = _mm512_sub_epi64(_mm512_max_epu64(m, n), minimum);
+
+        m      = _mm512_mask_mov_epi64(m, active, minimum);
+        n      = _mm512_maskz_srlv_epi64(active, difference, internal_ctz_u64x8(difference));
+        active = _mm512_test_epi64_mask(n, n);
+    }
+
+    return _mm512_sllv_epi64(m, k);
+}
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+// Computes the greatest common devisor of each pair of 64-bit lanes of `m` and `n`.
+static INLINE __m256i internal_gcd_u64x4(__m256i m, __m256i n) {
+    // See the AVX-512 version above. AVX2 lacks unsigned 64-bit minimum and maximum, so we compare with the sign bits
+    // flipped and blend.
+
+    const __m256i zero     = _mm256_setzero_si256();
+    const __m256i sign_bit = _mm256_set1_epi64x(ARITH_I64_MIN);
+    const __m256i m_or_n   = _mm256_or_si256(m, n);
+    const __m256i has_zero = _mm256_or_si256(_mm256_cmpeq_epi64(m, zero), _mm256_cmpeq_epi64(n, zero));
+    m                      = _mm256_blendv_epi8(m, m_or_n, has_zero);
+    n                      = _mm256_blendv_epi8(n, m_or_n, has_zero);
+
+    const __m256i k = internal_ctz_u64x4(m_or_n);
+    m               = _mm256_srlv_epi64(m, internal_ctz_u64x4(m));
+    n               = _mm256_srlv_epi64(n, internal_ctz_u64x4(n));
+
+    while (!_mm256_testz_si256(n, n)) {
+        const __m256i inactive   = _mm256_cmpeq_epi64(n, zero);
+        const __m256i m_greater  = _mm256_cmpgt_epi64(_mm256_xor_si256(m, sign_bit), _mm256_xor_si256(n, sign_bit));
+        const __m256i minimum    = _mm256_blendv_epi8(m, n, m_greater);
+        const __m256i maximum    = _mm256_blendv_epi8(n, m, m_greater);
+        const __m256i difference = _mm256_sub_epi64(maximum, minimum);
+
+        m = _mm256_blendv_epi8(minimum, m, inactive);
+        n = _mm256_andnot_si256(inactive, _mm256_srlv_epi64(difference, internal_ctz_u64x4(difference)));
+    }
+
+    return _mm256_sllv_epi64(m, k);
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+
+extern void ARITHMOS_DISPATCHED(arith_gcd_u64_batch)(const arith_u64* m, const arith_u64* n, arith_u64* out,
+                                                     const size_t count) {
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+    for (; i + 8 <= count; i += 8) {
+        const __m512i gcd = internal_gcd_u64x8(_mm512_loadu_si512(m + i), _mm512_loadu_si512(n + i));
+        _mm512_storeu_si512(out + i, gcd);
+    }
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+    for (; i + 4 <= count; i += 4) {
+        const __m256i gcd = internal_gcd_u64x4(_mm256_loadu_si256((const __m256i*)(m + i)),
+                                               _mm256_loadu_si256((const __m256i*)(n + i)));
+        _mm256_storeu_si256((__m256i*)(out + i), gcd);
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+    // The remaining pairs do not fill a vector, so they go through the scalar implementation.
+    for (; i < count; ++i)
+        out[i] = arith_gcd_u64(m[i], n[i]);
+}
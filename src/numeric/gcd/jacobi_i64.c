@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/gcd/gcd_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern int ARITHMOS_DISPATCHED(arith_jacobi_i64)(const arith_i64 a, const arith_i64 n) {
+    // (-a / n) = (-1)^((n - 1) / 2) * (a / n), whose sign is -1 if and only if bit 1 of n is set. See gcd_internal.h
+    // for the rest.
+
+    const arith_u64 sign = (a < 0) ? (arith_u64)n : 0;
+
+    return internal_jacobi_u64(internal_unsigned_abs_i64(a), (arith_u64)n, sign);
+}
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/gcd/gcd_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern void ARITHMOS_DISPATCHED(arith_jacobi_i64_batch)(const arith_i64* a, const arith_i64* n, int* out,
+                                                        const size_t count) {
+    // See jacobi_i64.c. The scalar implementation is inlined, so that consecutive symbols overlap.
+
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u64 sign = (a[i] < 0) ? (arith_u64)n[i] : 0;
+        out[i]               = internal_jacobi_u64(internal_unsigned_abs_i64(a[i]), (arith_u64)n[i], sign);
+    }
+}
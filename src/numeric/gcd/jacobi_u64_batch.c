@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+#include "numeric/gcd/gcd_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+// Computes the Jacobi symbol of each pair of 64-bit lanes of `a` and `n`, as 32-bit lanes.
+static INLINE __m256i internal_jacobi_u64x8(__m512i a, __m512i n) {
+    // Every lane runs the loop of internal_jacobi_u64(), with the swap written as a minimum and a difference as in
+    // gcd_u64_batch.c, and the signs collected in bit 1 of the lanes of `sign`. A lane is done once its a equals its
+    // n. From then on it is masked out, and the loop ends when all lanes are done.
+    //
+    // Rather than branching on a = 0 per lane, we replace a by n in such a lane, which makes it done at once, with
+    // the symbol (n / n) = (0 / n).
+
+    const __m512i one = _mm512_set1_epi64(1);
+    a                 = _mm512_mask_mov_epi64(a, _mm512_testn_epi64_mask(a, a), n);
+
+    __m512i k    = internal_ctz_u64x8(a);
+    a            = _mm512_srlv_epi64(a, k);
+    __m512i sign = _mm512_maskz_xor_epi64(_mm512_test_epi64_mask(k, one), n, _mm512_srli_epi64(n, 1));
+
+    __mmask8 active = _mm512_cmpneq_epu64_mask(a, n);
+    while (active != 0) {
+        const __mmask8 swap      = _mm512_mask_cmplt_epu64_mask(active, a, n);
+        const __m512i minimum    = _mm512_min_epu64(a, n);
+        const __m512i difference = _mm512_sub_epi64(_mm512_max_epu64(a, n), minimum);
+
+        sign = _mm512_mask_xor_epi64(sign, swap, sign, _mm512_and_si512(a, n));
+        n    = _mm512_mask_mov_epi64(n, active, minimum);
+        k    = internal_ctz_u64x8(difference);
+        a    = _mm512_mask_srlv_epi64(a, active, difference, k);
+        sign = _mm512_mask_xor_epi64(sign, _mm512_mask_test_epi64_mask(active, k, one), sign,
+                                     _mm512_xor_si512(n, _mm512_srli_epi64(n, 1)));
+
+        active = _mm512_cmpneq_epu64_mask(a, n);
+    }
+
+    const __m512i symbol = _mm512_maskz_sub_epi64(_mm512_cmpeq_epi64_mask(n, one), one,
+                                                  _mm512_and_si512(sign, _mm512_set1_epi64(2)));
+
+    return _mm512_cvtepi64_epi32(symbol);
+}
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+// Computes the Jacobi symbol of each pair of 64-bit lanes of `a` and `n`, as 32-bit lanes.
+static INLINE __m128i internal_jacobi_u64x4(__m256i a, __m256i n) {
+    // See the AVX-512 version above. AVX2 lacks unsigned 64-bit comparisons, so we compare with the sign bits flipped.
+    // In a lane that is done, a = n is both the minimum and the maximum, so n stays as it is, and only a and the sign
+    // need to be kept.
+
+    const __m256i zero     = _mm256_setzero_si256();
+    const __m256i one      = _mm256_set1_epi64x(1);
+    const __m256i sign_bit = _mm256_set1_epi64x(ARITH_I64_MIN);
+    a                      = _mm256_blendv_epi8(a, n, _mm256_cmpeq_epi64(a, zero));
+
+    __m256i k    = internal_ctz_u64x4(a);
+    a            = _mm256_srlv_epi64(a, k);
+    __m256i sign = _mm256_and_si256(_mm256_cmpeq_epi64(_mm256_and_si256(k, one), one),
+                                    _mm256_xor_si256(n, _mm256_srli_epi64(n, 1)));
+
+    __m256i inactive = _mm256_cmpeq_epi64(a, n);
+    while (_mm256_movemask_epi8(inactive) != -1) {
+        const __m256i a_less     = _mm256_cmpgt_epi64(_mm256_xor_si256(n, sign_bit), _mm256_xor_si256(a, sign_bit));
+        const __m256i minimum    = _mm256_blendv_epi8(n, a, a_less);
+        const __m256i maximum    = _mm256_blendv_epi8(a, n, a_less);
+        const __m256i difference = _mm256_sub_epi64(maximum, minimum);
+
+        sign = _mm256_xor_si256(sign, _mm256_and_si256(a_less, _mm256_and_si256(a, n)));
+        n    = minimum;
+        k    = internal_ctz_u64x4(difference);
+        a    = _mm256_blendv_epi8(_mm256_srlv_epi64(difference, k), a, inactive);
+
+        const __m256i odd_k = _mm256_andnot_si256(inactive, _mm256_cmpeq_epi64(_mm256_and_si256(k, one), one));
+        sign = _mm256_xor_si256(sign, _mm256_and_si256(odd_k, _mm256_xor_si256(n, _mm256_srli_epi64(n, 1))));
+
+        inactive = _mm256_cmpeq_epi64(a, n);
+    }
+
+    const __m256i symbol = _mm256_and_si256(_mm256_cmpeq_epi64(n, one),
+                                            _mm256_sub_epi64(one, _mm256_and_si256(sign, _mm256_set1_epi64x(2))));
+
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(symbol, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)));
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+
+extern void ARITHMOS_DISPATCHED(arith_jacobi_u64_batch)(const arith_u64* a, const arith_u64* n, int* out,
+                                                        const size_t count) {
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256i symbol = internal_jacobi_u64x8(_mm512_loadu_si512(a + i), _mm512_loadu_si512(n + i));
+        _mm256_storeu_si256((__m256i*)(out + i), symbol);
+    }
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128i symbol = internal_jacobi_u64x4(_mm256_loadu_si256((const __m256i*)(a + i)),
+                                                     _mm256_loadu_si256((const __m256i*)(n + i)));
+        _mm_storeu_si128((__m128i*)(out + i), symbol);
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512CD
+
+    // The remaining pairs do not fill a vector, so they go through the scalar implementation.
+    for (; i < count; ++i)
+        out[i] = internal_jacobi_u64(a[i], n[i], 0);
+}
@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/gcd/gcd_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern int ARITHMOS_DISPATCHED(arith_kronecker_i64)(const arith_i64 a, const arith_i64 n) {
+    // See gcd_internal.h for implementation details.
+
+    return internal_kronecker_i64(a, n);
+}
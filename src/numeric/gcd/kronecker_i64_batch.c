@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/gcd/gcd_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern void ARITHMOS_DISPATCHED(arith_kronecker_i64_batch)(const arith_i64* a, const arith_i64* n, int* out,
+                                                           const size_t count) {
+    // The scalar implementation is inlined, so that consecutive symbols overlap.
+
+    for (size_t i = 0; i < count; ++i)
+        out[i] = internal_kronecker_i64(a[i], n[i]);
+}
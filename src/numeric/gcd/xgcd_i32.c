@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_i32 ARITHMOS_DISPATCHED(arith_xgcd_i32)(const arith_i32 m, const arith_i32 n, arith_i32* x, arith_i32* y) {
+    // We have |m| * x' + |n| * y' = g, so negating x' or y' along with m or n gives the coefficients.
+    arith_u32 ux;
+    arith_u32 uy;
+    const arith_u32 gcd = internal_xgcd_u32(internal_unsigned_abs_i32(m), internal_unsigned_abs_i32(n), &ux, &uy);
+
+    *x = (arith_i32)((m < 0) ? -ux : ux);
+    *y = (arith_i32)((n < 0) ? -uy : uy);
+    return (arith_i32)gcd;
+}
@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_i64 ARITHMOS_DISPATCHED(arith_xgcd_i64)(const arith_i64 m, const arith_i64 n, arith_i64* x, arith_i64* y) {
+    // We have |m| * x' + |n| * y' = g, so negating x' or y' along with m or n gives the coefficients.
+    arith_u64 ux;
+    arith_u64 uy;
+    const arith_u64 gcd = internal_xgcd_u64(internal_unsigned_abs_i64(m), internal_unsigned_abs_i64(n), &ux, &uy);
+
+    *x = (arith_i64)((m < 0) ? -ux : ux);
+    *y = (arith_i64)((n < 0) ? -uy : uy);
+    return (arith_i64)gcd;
+}
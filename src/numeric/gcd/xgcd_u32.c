@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u32 ARITHMOS_DISPATCHED(arith_xgcd_u32)(arith_u32 m, arith_u32 n, arith_i32* x, arith_i32* y) {
+    arith_u32 ux;
+    arith_u32 uy;
+    const arith_u32 gcd = internal_xgcd_u32(m, n, &ux, &uy);
+
+    *x = (arith_i32)ux;
+    *y = (arith_i32)uy;
+    return gcd;
+}
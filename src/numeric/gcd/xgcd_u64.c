@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/gcd.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 ARITHMOS_DISPATCHED(arith_xgcd_u64)(arith_u64 m, arith_u64 n, arith_i64* x, arith_i64* y) {
+    arith_u64 ux;
+    arith_u64 uy;
+    const arith_u64 gcd = internal_xgcd_u64(m, n, &ux, &uy);
+
+    *x = (arith_i64)ux;
+    *y = (arith_i64)uy;
+    return gcd;
+}
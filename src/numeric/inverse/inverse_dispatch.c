@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/inverse.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_mod_inverse_u32, (const arith_u32 a, const arith_u32 modulus));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_mod_inverse_u64, (const arith_u64 a, const arith_u64 modulus));
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_mod_inverse_u64_batch,
+                           (const arith_u64* a, const arith_u64 modulus, arith_u64* out, const size_t count));
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/inverse.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u32 ARITHMOS_DISPATCHED(arith_mod_inverse_u32)(const arith_u32 a, const arith_u32 modulus) {
+    return internal_mod_inverse_u32(a, modulus);
+}
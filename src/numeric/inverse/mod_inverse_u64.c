@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/inverse.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 ARITHMOS_DISPATCHED(arith_mod_inverse_u64)(const arith_u64 a, const arith_u64 modulus) {
+    return internal_mod_inverse_u64(a, modulus);
+}
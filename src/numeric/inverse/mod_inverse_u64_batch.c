@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/inverse.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+extern void ARITHMOS_DISPATCHED(arith_mod_inverse_u64_batch)(const arith_u64* a, const arith_u64 modulus,
+                                                             arith_u64* out, const size_t count) {
+    // This is Montgomery's trick. With the prefix products P_i = a_0 * ... * a_i and P_-1 = 1, a single inversion
+    // gives P_(count-1)^-1, and going backwards, a_i^-1 = P_i^-1 * P_(i-1) and P_(i-1)^-1 = P_i^-1 * a_i. `out[i]`
+    // holds P_(i-1) until it is replaced by a_i^-1.
+    //
+    // For an odd modulus, all products are Montgomery products of unconverted values, which is fine since
+    // P_(i-1) * a_i < n * R. Starting from P_-1 = R (mod n), P_i carries the factor R^-i and P_i^-1 the factor R^i,
+    // and these cancel in a_i^-1 = P_i^-1 * P_(i-1) * R^-1. Hence no value is converted to or from Montgomery form.
+    // For an even modulus, the products are ordinary modular products.
+
+    if (count == 0)
+        return;
+
+    arith_u64 inverse = 0;
+    if ((modulus & 1) == 1 && modulus != 1) {
+        const arith_montgomery_u64 montgomery = {
+            .modulus   = modulus,
+            .inverse   = internal_inverse_mod_2_64_u64(modulus),
+            .one       = (0 - modulus) % modulus,
+            .r_squared = 0,
+        };
+
+        arith_u64 product = montgomery.one;
+        for (size_t i = 0; i < count; ++i) {
+            out[i]  = product;
+            product = internal_montgomery_mul_u64(&montgomery, product, a[i]);
+        }
+
+        inverse = internal_mod_inverse_odd_u64(product, modulus);
+        for (size_t i = count; inverse != 0 && i-- > 0;) {
+            out[i]  = internal_montgomery_mul_u64(&montgomery, inverse, out[i]);
+            inverse = internal_montgomery_mul_u64(&montgomery, inverse, a[i]);
+        }
+    } else if (modulus != 1) {
+        arith_u64 product = 1;
+        for (size_t i = 0; i < count; ++i) {
+            out[i]  = product;
+            product = internal_mod_mul_u64(product, a[i], modulus);
+        }
+
+        inverse = internal_mod_inverse_u64(product, modulus);
+        for (size_t i = count; inverse != 0 && i-- > 0;) {
+            out[i]  = internal_mod_mul_u64(inverse, out[i], modulus);
+            inverse = internal_mod_mul_u64(inverse, a[i], modulus);
+        }
+    }
+
+    // If some element is not invertible, neither is the product, and every element is inverted on its own.
+    if (inverse == 0) {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = internal_mod_inverse_u64(a[i], modulus);
+    }
+}
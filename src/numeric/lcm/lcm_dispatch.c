@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/lcm.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(arith_i32, arith_lcm_i32, (const arith_i32 m, const arith_i32 n));
+ARITHMOS_DEFINE_DISPATCHER(arith_i64, arith_lcm_i64, (const arith_i64 m, const arith_i64 n));
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_lcm_u32, (arith_u32 m, const arith_u32 n));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_lcm_u64, (arith_u64 m, const arith_u64 n));
+
+ARITHMOS_DEFINE_DISPATCHER(arith_i32, arith_lcm_i32_array,
+                           (const arith_i32* values, const size_t count, bool* overflow));
+ARITHMOS_DEFINE_DISPATCHER(arith_i64, arith_lcm_i64_array,
+                           (const arith_i64* values, const size_t count, bool* overflow));
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_lcm_u32_array,
+                           (const arith_u32* values, const size_t count, bool* overflow));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_lcm_u64_array,
+                           (const arith_u64* values, const size_t count, bool* overflow));
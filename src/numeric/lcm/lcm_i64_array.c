@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/lcm.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+extern arith_i64 ARITHMOS_DISPATCHED(arith_lcm_i64_array)(const arith_i64* values, const size_t count, bool* overflow) {
+    // See lcm_u64_array.c for implementation details.
+
+    arith_u64 lcm   = 1;
+    bool overflowed = false;
+
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u64 value = internal_unsigned_abs_i64(values[i]);
+        if (value == 0) {
+            lcm        = 0;
+            overflowed = false;
+            break;
+        }
+
+        if (!overflowed) {
+            const arith_u128 product = internal_multiply_u64(lcm, value / internal_gcd_u64(lcm, value));
+            overflowed               = product > ARITH_I64_MAX;
+            lcm                      = (arith_u64)product;
+        }
+    }
+
+    if (overflow != NULL)
+        *overflow = overflowed;
+
+    return overflowed ? 0 : (arith_i64)lcm;
+}
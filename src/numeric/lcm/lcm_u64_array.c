@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/lcm.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 ARITHMOS_DISPATCHED(arith_lcm_u64_array)(const arith_u64* values, const size_t count, bool* overflow) {
+    // The values are folded into a running lcm with lcm(l, v) = l * (v / gcd(l, v)), where the gcd is computed with
+    // the binary GCD loop of internal_gcd_u64(), as in arith_lcm_u64(). A product that does not fit in 64 bits means
+    // that the lcm is not representable, since every later lcm is a multiple of it. However, the remaining values are
+    // still scanned for a 0, which makes the lcm 0.
+
+    arith_u64 lcm   = 1;
+    bool overflowed = false;
+
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u64 value = values[i];
+        if (value == 0) {
+            lcm        = 0;
+            overflowed = false;
+            break;
+        }
+
+        if (!overflowed) {
+            const arith_u128 product = internal_multiply_u64(lcm, value / internal_gcd_u64(lcm, value));
+            overflowed               = product > ARITH_U64_MAX;
+            lcm                      = (arith_u64)product;
+        }
+    }
+
+    if (overflow != NULL)
+        *overflow = overflowed;
+
+    return overflowed ? 0 : lcm;
+}
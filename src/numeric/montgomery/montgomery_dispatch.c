@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_montgomery_power_mod_u32,
+                           (const arith_montgomery_u32* montgomery, const arith_u32 base, arith_u32 exponent));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_montgomery_power_mod_u64,
+                           (const arith_montgomery_u64* montgomery, const arith_u64 base, arith_u64 exponent));
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 arith_montgomery_from_mont_u64(const arith_montgomery_u64* montgomery, const arith_u64 x) {
+    return internal_montgomery_from_mont_u64(montgomery, x);
+}
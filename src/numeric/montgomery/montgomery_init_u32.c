@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern void arith_montgomery_init_u32(arith_montgomery_u32* montgomery, const arith_u32 modulus) {
+    // See montgomery_init_u64.c for implementation details.
+
+    montgomery->modulus   = modulus;
+    montgomery->inverse   = internal_inverse_mod_2_32_u32(modulus);
+    montgomery->one       = (arith_u32)(((arith_u64)1 << 32) % modulus);
+    montgomery->r_squared = (arith_u32)((arith_u64)montgomery->one * montgomery->one % modulus);
+}
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern void arith_montgomery_init_u64(arith_montgomery_u64* montgomery, const arith_u64 modulus) {
+    // Montgomery arithmetic represents x (mod n) by x * R (mod n). The product of two such representatives is reduced
+    // by multiplying with R^-1, which only takes multiplications and shifts when R is a power of 2 (see
+    // internal_montgomery_reduce_u64()). All divisions are done here, once per modulus:
+    //
+    //     R (mod n) = (R - n) (mod n),       which is -n (mod n) in unsigned 64-bit arithmetic,
+    //     R^2 (mod n) = (R (mod n))^2 (mod n).
+    //
+
+    montgomery->modulus   = modulus;
+    montgomery->inverse   = internal_inverse_mod_2_64_u64(modulus);
+    montgomery->one       = -modulus % modulus;
+    montgomery->r_squared = (arith_u64)((arith_u128)montgomery->one * montgomery->one % modulus);
+}
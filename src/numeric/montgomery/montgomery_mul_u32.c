@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u32 arith_montgomery_mul_u32(const arith_montgomery_u32* montgomery, const arith_u32 multiplier,
+                                          const arith_u32 multiplicand) {
+    return internal_montgomery_mul_u32(montgomery, multiplier, multiplicand);
+}
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u32 ARITHMOS_DISPATCHED(arith_montgomery_power_mod_u32)(const arith_montgomery_u32* montgomery,
+                                                                     const arith_u32 base, const arith_u32 exponent) {
+    // See montgomery_power_mod_u64.c for implementation details.
+    const arith_u32 mont_base = internal_montgomery_to_mont_u32(montgomery, base);
+    const arith_u32 result    = internal_montgomery_power_u32(montgomery, mont_base, exponent);
+
+    return internal_montgomery_from_mont_u32(montgomery, result);
+}
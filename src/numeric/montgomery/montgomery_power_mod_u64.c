@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/montgomery.h"
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 ARITHMOS_DISPATCHED(arith_montgomery_power_mod_u64)(const arith_montgomery_u64* montgomery,
+                                                                     const arith_u64 base, const arith_u64 exponent) {
+    // Both base and result are kept in Montgomery form, and the result is converted back only once at the end.
+    const arith_u64 mont_base = internal_montgomery_to_mont_u64(montgomery, base);
+    const arith_u64 result    = internal_montgomery_power_u64(montgomery, mont_base, exponent);
+
+    return internal_montgomery_from_mont_u64(montgomery, result);
+}
@@ -5,14 +5,22 @@
 #define ARITHMOS_NUMERIC_INTERNAL_H_
 
 
+#include <math.h>
+#include <stdbool.h>
+
+#include "bit_operations.h"
 #include "cpu_features.h"
+#include "expect.h"
 #include "inline.h"
 
 #if ARITHMOS_CPU_HAS_BMI2
 #    include <immintrin.h>
 #endif  // #if ARITHMOS_CPU_HAS_BMI2
 
+#include "arithmos/core/limits.h"
 #include "arithmos/core/types.h"
+#include "arithmos/numeric/barrett.h"
+#include "arithmos/numeric/montgomery.h"
 
 
 
@@ -87,5 +95,654 @@ static INLINE arith_u64 internal_mod_mul_u64(const arith_u64 multiplier, const a
 }
 
 
+// Computes the inverse of `x` modulo `2^32`. If `x` is even, the behaviour is undefined.
+static INLINE arith_u32 internal_inverse_mod_2_32_u32(const arith_u32 x) {
+    // Newton's iteration y <- y * (2 - x * y) doubles the number of correct low bits. Since x * x = 1 (mod 8) for
+    // odd x, the initial guess y = x is correct to 3 bits, so 4 iterations give 48 >= 32 bits.
+    arith_u32 inverse = x;
+    inverse *= 2 - x * inverse;
+    inverse *= 2 - x * inverse;
+    inverse *= 2 - x * inverse;
+    inverse *= 2 - x * inverse;
+
+    return inverse;
+}
+
+// Computes the inverse of `x` modulo `2^64`. If `x` is even, the behaviour is undefined.
+static INLINE arith_u64 internal_inverse_mod_2_64_u64(const arith_u64 x) {
+    // See internal_inverse_mod_2_32_u32(). The initial guess 3x ^ 2 is correct to 5 bits, so 4 iterations give
+    // 80 >= 64 bits.
+    arith_u64 inverse = (3 * x) ^ 2;
+    inverse *= 2 - x * inverse;
+    inverse *= 2 - x * inverse;
+    inverse *= 2 - x * inverse;
+    inverse *= 2 - x * inverse;
+
+    return inverse;
+}
+
+
+// Computes `gcd(m, n)`. If `m` or `n` is `0`, the behaviour is undefined.
+static INLINE arith_u32 internal_gcd_u32(arith_u32 m, arith_u32 n) {
+    // See internal_gcd_u64() for implementation details.
+    const unsigned i = internal_ctz_u32(m);
+    m >>= i;
+    const unsigned j = internal_ctz_u32(n);
+    n >>= j;
+    const unsigned k = (i < j) ? i : j;
+
+    while (true) {
+        const arith_u32 n_cpy = n;
+        const arith_u32 diff  = m - n;
+        n                     = -diff;
+
+        if (internal_unlikely(n == 0))
+            return m << k;
+
+        if (m > n_cpy) {
+            m = n_cpy;
+            n = diff;
+        }
+
+        n >>= internal_ctz_u32(n);
+    }
+}
+
+// Computes `gcd(m, n)`. If `m` or `n` is `0`, the behaviour is undefined.
+static INLINE arith_u64 internal_gcd_u64(arith_u64 m, arith_u64 n) {
+    // This is the binary GCD loop of arith_gcd_u64(), without the checks for zero operands.
+    const unsigned i = internal_ctz_u64(m);
+    m >>= i;
+    const unsigned j = internal_ctz_u64(n);
+    n >>= j;
+    const unsigned k = (i < j) ? i : j;
+
+    while (true) {
+        const arith_u64 n_cpy = n;
+        const arith_u64 diff  = m - n;
+        n                     = -diff;
+
+        if (internal_unlikely(n == 0))
+            return m << k;
+
+        if (m > n_cpy) {
+            m = n_cpy;
+            n = diff;
+        }
+
+        n >>= internal_ctz_u64(n);
+    }
+}
+
+// Computes `gcd(m, n)` together with coefficients `x` and `y` such that `m * x + n * y = gcd(m, n)`. These are the
+// coefficients of the extended Euclidean algorithm, and are stored in two's complement.
+static INLINE arith_u32 internal_xgcd_u32(arith_u32 m, arith_u32 n, arith_u32* x, arith_u32* y) {
+    // The coefficients satisfy m * x0 + n * y0 = m and m * x1 + n * y1 = n at every step. If m < n, the first
+    // quotient is 0, which swaps m and n.
+    arith_u32 x0 = 1;
+    arith_u32 x1 = 0;
+    arith_u32 y0 = 0;
+    arith_u32 y1 = 1;
+
+    while (n != 0) {
+        const arith_u32 quotient  = m / n;
+        const arith_u32 remainder = m % n;
+        m                         = n;
+        n                         = remainder;
+
+        const arith_u32 x_next = x0 - quotient * x1;
+        const arith_u32 y_next = y0 - quotient * y1;
+        x0                     = x1;
+        x1                     = x_next;
+        y0                     = y1;
+        y1                     = y_next;
+    }
+
+    *x = x0;
+    *y = y0;
+    return m;
+}
+
+// Computes `gcd(m, n)` together with coefficients `x` and `y` such that `m * x + n * y = gcd(m, n)`. These are the
+// coefficients of the extended Euclidean algorithm, and are stored in two's complement.
+static INLINE arith_u64 internal_xgcd_u64(arith_u64 m, arith_u64 n, arith_u64* x, arith_u64* y) {
+    // We use Lehmer's algorithm, so that hardly any 64-bit divisions are needed. While n does not fit in 32 bits, the
+    // Euclidean algorithm is run on the leading 32 bits m' and n' of m and n, where m = 2^s * m' + e and
+    // n = 2^s * n' + f with e, f < 2^s. Its remainders are r'_i = (-1)^i * (u_i * m' - v_i * n') with nonnegative
+    // cofactors u_i and v_i, so the remainders of m and n with the same quotients are
+    //
+    //     r_i = 2^s * r'_i + (-1)^i * (u_i * e - v_i * f),    where |u_i * e - v_i * f| < 2^s * max(u_i, v_i).
+    //
+    // By induction, the quotients are those of m and n as long as 0 <= r_i < r_(i-1), which is the case if
+    //
+    //     r'_i >= max(u_i, v_i)    and    r'_(i-1) - r'_i >= max(u_(i-1) + u_i, v_(i-1) + v_i).
+    //
+    // This is (a slightly stronger version of) Jebelean's condition. Since m' >= n', we have v_i >= u_i for i >= 1, so
+    // only the v_i need to be compared. The accepted steps are then applied to m, n and the coefficients at once.
+    // Typically, every Lehmer step covers about 8 quotients. Once n fits in 32 bits, the remaining quotients are
+    // computed with 32-bit divisions as well.
+    arith_u64 x0 = 1;
+    arith_u64 x1 = 0;
+    arith_u64 y0 = 0;
+    arith_u64 y1 = 1;
+
+    if (m < n) {
+        const arith_u64 m_cpy = m;
+        m                     = n;
+        n                     = m_cpy;
+        x0                    = 0;
+        x1                    = 1;
+        y0                    = 1;
+        y1                    = 0;
+    }
+
+    while (n > ARITH_U32_MAX) {
+        const unsigned shift = internal_bsr_u64(m) - 31;
+        arith_u32 m_high     = (arith_u32)(m >> shift);
+        arith_u32 n_high     = (arith_u32)(n >> shift);
+
+        arith_u64 u0 = 1;
+        arith_u64 v0 = 0;
+        arith_u64 u1 = 0;
+        arith_u64 v1 = 1;
+        bool odd     = false;
+
+        while (n_high != 0) {
+            const arith_u32 quotient  = m_high / n_high;
+            const arith_u32 remainder = m_high % n_high;
+            const arith_u64 u2        = u0 + quotient * u1;
+            const arith_u64 v2        = v0 + quotient * v1;
+
+            if (remainder < v2 || n_high - remainder < v1 + v2)
+                break;
+
+            m_high = n_high;
+            n_high = remainder;
+            u0     = u1;
+            u1     = u2;
+            v0     = v1;
+            v1     = v2;
+            odd    = !odd;
+        }
+
+        if (u1 == 0) {
+            // Not even the first quotient is certain, which is rare, so we do an ordinary division step.
+            const arith_u64 quotient  = m / n;
+            const arith_u64 remainder = m % n;
+            m                         = n;
+            n                         = remainder;
+
+            const arith_u64 x_next = x0 - quotient * x1;
+            const arith_u64 y_next = y0 - quotient * y1;
+            x0                     = x1;
+            x1                     = x_next;
+            y0                     = y1;
+            y1                     = y_next;
+            continue;
+        }
+
+        // The wrapping arithmetic is exact, since all results fit in 64 bits (in two's complement for x and y).
+        const arith_u64 sign   = odd ? ARITH_U64_MAX : 0;
+        const arith_u64 m_next = ((u0 * m - v0 * n) ^ sign) - sign;
+        const arith_u64 n_next = ((v1 * n - u1 * m) ^ sign) - sign;
+        const arith_u64 x0_cpy = x0;
+        const arith_u64 y0_cpy = y0;
+        m                      = m_next;
+        n                      = n_next;
+        x0                     = ((u0 * x0 - v0 * x1) ^ sign) - sign;
+        x1                     = ((v1 * x1 - u1 * x0_cpy) ^ sign) - sign;
+        y0                     = ((u0 * y0 - v0 * y1) ^ sign) - sign;
+        y1                     = ((v1 * y1 - u1 * y0_cpy) ^ sign) - sign;
+    }
+
+    while (n != 0) {
+        const arith_u64 quotient  = (m > ARITH_U32_MAX) ? m / n : (arith_u32)m / (arith_u32)n;
+        const arith_u64 remainder = m - quotient * n;
+        m                         = n;
+        n                         = remainder;
+
+        const arith_u64 x_next = x0 - quotient * x1;
+        const arith_u64 y_next = y0 - quotient * y1;
+        x0                     = x1;
+        x1                     = x_next;
+        y0                     = y1;
+        y1                     = y_next;
+    }
+
+    *x = x0;
+    *y = y0;
+    return m;
+}
+
+// Computes `x * 2^-shift (mod modulus)`, where `neg_inverse = -modulus^-1 (mod 2^32)`. If `modulus` is even, `x` is
+// not smaller than `modulus` or `shift > 31`, the behaviour is undefined.
+static INLINE arith_u32 internal_mod_div_pow2_u32(const arith_u32 x, const unsigned shift, const arith_u32 modulus,
+                                                  const arith_u32 neg_inverse) {
+    // See internal_mod_div_pow2_u64() for implementation details.
+    const arith_u32 quotient = (x * neg_inverse) & (((arith_u32)1 << shift) - 1);
+
+    return (arith_u32)(((arith_u64)quotient * modulus + x) >> shift);
+}
+
+// Computes `x * 2^-shift (mod modulus)`, where `neg_inverse = -modulus^-1 (mod 2^64)`. If `modulus` is even, `x` is
+// not smaller than `modulus` or `shift > 63`, the behaviour is undefined.
+static INLINE arith_u64 internal_mod_div_pow2_u64(const arith_u64 x, const unsigned shift, const arith_u64 modulus,
+                                                  const arith_u64 neg_inverse) {
+    // This is a Montgomery reduction with R = 2^shift: with q = -x * n^-1 (mod R), x + q * n is divisible by R and
+    // congruent to x modulo n. Since x < n and q < R, the quotient (x + q * n) / R is smaller than n.
+    const arith_u64 quotient = (x * neg_inverse) & (((arith_u64)1 << shift) - 1);
+
+    return (arith_u64)(((arith_u128)quotient * modulus + x) >> shift);
+}
+
+// Computes `a^-1 (mod modulus)`, or returns `0` if `gcd(a, modulus) != 1`. If `modulus` is even or `1`, the behaviour
+// is undefined.
+static INLINE arith_u32 internal_mod_inverse_odd_u32(const arith_u32 a, const arith_u32 modulus) {
+    // See internal_mod_inverse_odd_u64() for implementation details.
+    if (a == 0)
+        return 0;
+
+    unsigned shift  = internal_ctz_u32(a);
+    arith_u32 u     = a >> shift;
+    arith_u32 v     = modulus;
+    arith_u32 x1    = 1;
+    arith_u32 x2    = 0;
+    arith_u32 flips = 0;
+
+    while (true) {
+        const arith_u32 v_cpy  = v;
+        const arith_u32 diff   = u - v;
+        const arith_u32 x2_cpy = x2;
+        v                      = -diff;
+
+        if (internal_unlikely(v == 0))
+            break;
+
+        if (u > v_cpy) {
+            u     = v_cpy;
+            v     = diff;
+            x2    = x1;
+            x1    = x2_cpy;
+            flips = ~flips;
+        }
+
+        const unsigned v_shift = internal_ctz_u32(v);
+        v >>= v_shift;
+        x2 += x1;
+        x1 <<= v_shift;
+        shift += v_shift;
+    }
+
+    if (u != 1)
+        return 0;
+
+    const arith_u32 neg_inverse = -internal_inverse_mod_2_32_u32(modulus);
+
+    arith_u32 inverse = (x1 & ~flips) | (x2 & flips);
+    for (; shift > 31; shift -= 31)
+        inverse = internal_mod_div_pow2_u32(inverse, 31, modulus, neg_inverse);
+
+    return internal_mod_div_pow2_u32(inverse, shift, modulus, neg_inverse);
+}
+
+// Computes `a^-1 (mod modulus)`, or returns `0` if `gcd(a, modulus) != 1`. If `modulus` is even or `1`, the behaviour
+// is undefined.
+static INLINE arith_u64 internal_mod_inverse_odd_u64(const arith_u64 a, const arith_u64 modulus) {
+    // This is the binary GCD loop of arith_gcd_u64() on u = a and v = n, which keeps coefficients x1 and x2 with
+    // a * x1 = u * 2^k and a * x2 = -v * 2^k (mod n), where k counts the bits shifted out so far. Subtracting u from v
+    // adds x1 to x2, and shifting v right by t bits shifts x1 left by t bits instead of halving x2 modulo n. Swapping
+    // u and v flips the signs, which is tracked in `flips`. Moreover, u * x2 + v * x1 = n is invariant, so x1 and x2
+    // never exceed n. Once u = v, this is gcd(a, n), and if it is 1 the inverse is +-x1 * 2^-k (mod n), where the sign
+    // is taken care of by using x2 = n - x1 instead. The powers of 2 are divided out with internal_mod_div_pow2_u64()
+    // at the very end, so the loop has no multiplications at all.
+    if (a == 0)
+        return 0;
+
+    unsigned shift  = internal_ctz_u64(a);
+    arith_u64 u     = a >> shift;
+    arith_u64 v     = modulus;
+    arith_u64 x1    = 1;
+    arith_u64 x2    = 0;
+    arith_u64 flips = 0;
+
+    while (true) {
+        // As in arith_gcd_u64(), both u - v and v - u are computed, so that the swap compiles to conditional moves.
+        const arith_u64 v_cpy  = v;
+        const arith_u64 diff   = u - v;
+        const arith_u64 x2_cpy = x2;
+        v                      = -diff;
+
+        if (internal_unlikely(v == 0))
+            break;
+
+        if (u > v_cpy) {
+            u     = v_cpy;
+            v     = diff;
+            x2    = x1;
+            x1    = x2_cpy;
+            flips = ~flips;
+        }
+
+        const unsigned v_shift = internal_ctz_u64(v);
+        v >>= v_shift;
+        x2 += x1;
+        x1 <<= v_shift;
+        shift += v_shift;
+    }
+
+    if (u != 1)
+        return 0;
+
+    const arith_u64 neg_inverse = -internal_inverse_mod_2_64_u64(modulus);
+
+    arith_u64 inverse = (x1 & ~flips) | (x2 & flips);
+    for (; shift > 63; shift -= 63)
+        inverse = internal_mod_div_pow2_u64(inverse, 63, modulus, neg_inverse);
+
+    return internal_mod_div_pow2_u64(inverse, shift, modulus, neg_inverse);
+}
+
+// Computes `a^-1 (mod modulus)`, or returns `0` if `gcd(a, modulus) != 1`. If `modulus` is `0`, the behaviour is
+// undefined.
+static INLINE arith_u32 internal_mod_inverse_u32(const arith_u32 a, const arith_u32 modulus) {
+    // See internal_mod_inverse_u64() for implementation details.
+    if ((modulus & 1) == 1)
+        return (modulus == 1) ? 0 : internal_mod_inverse_odd_u32(a, modulus);
+
+    if ((a & 1) == 0)
+        return 0;
+
+    const unsigned shift        = internal_ctz_u32(modulus);
+    const arith_u32 odd_part    = modulus >> shift;
+    const arith_u32 mask        = ((arith_u32)1 << shift) - 1;
+    const arith_u32 inverse_low = internal_inverse_mod_2_32_u32(a) & mask;
+    if (odd_part == 1)
+        return inverse_low;
+
+    const arith_u32 inverse_odd = internal_mod_inverse_odd_u32(a, odd_part);
+    if (inverse_odd == 0)
+        return 0;
+
+    return inverse_odd + odd_part * (((inverse_low - inverse_odd) * internal_inverse_mod_2_32_u32(odd_part)) & mask);
+}
+
+// Computes `a^-1 (mod modulus)`, or returns `0` if `gcd(a, modulus) != 1`. If `modulus` is `0`, the behaviour is
+// undefined.
+static INLINE arith_u64 internal_mod_inverse_u64(const arith_u64 a, const arith_u64 modulus) {
+    // An even modulus n = 2^k * m with m odd needs an odd a. Its inverses modulo 2^k (by Newton's iteration) and
+    // modulo m (by the binary GCD) are then combined with the Chinese remainder theorem: the inverse is
+    // x_m + m * t, where t = (x_2^k - x_m) * m^-1 (mod 2^k). This is smaller than n and needs no division either.
+    if ((modulus & 1) == 1)
+        return (modulus == 1) ? 0 : internal_mod_inverse_odd_u64(a, modulus);
+
+    if ((a & 1) == 0)
+        return 0;
+
+    const unsigned shift        = internal_ctz_u64(modulus);
+    const arith_u64 odd_part    = modulus >> shift;
+    const arith_u64 mask        = ((arith_u64)1 << shift) - 1;
+    const arith_u64 inverse_low = internal_inverse_mod_2_64_u64(a) & mask;
+    if (odd_part == 1)
+        return inverse_low;
+
+    const arith_u64 inverse_odd = internal_mod_inverse_odd_u64(a, odd_part);
+    if (inverse_odd == 0)
+        return 0;
+
+    return inverse_odd + odd_part * (((inverse_low - inverse_odd) * internal_inverse_mod_2_64_u64(odd_part)) & mask);
+}
+
+// Computes `x * R^-1 (mod modulus)` with `R = 2^32`. If `x >= modulus * R`, the behaviour is undefined.
+static INLINE arith_u32 internal_montgomery_reduce_u32(const arith_montgomery_u32* montgomery, const arith_u64 x) {
+    // We use the subtractive variant of Montgomery reduction. With q = x * n^-1 (mod R), the low halves of x and q * n
+    // are equal, so (x - q * n) / R is exactly the difference of the high halves. It lies in (-n, n), so one
+    // conditional addition of n brings it into [0, n).
+    const arith_u32 quotient = (arith_u32)x * montgomery->inverse;
+    const arith_u32 x_high   = (arith_u32)(x >> 32);
+    const arith_u32 qn_high  = (arith_u32)(((arith_u64)quotient * montgomery->modulus) >> 32);
+    const arith_u32 result   = x_high - qn_high;
+
+    return (x_high < qn_high) ? result + montgomery->modulus : result;
+}
+
+// Computes `x * R^-1 (mod modulus)` with `R = 2^64`. If `x >= modulus * R`, the behaviour is undefined.
+static INLINE arith_u64 internal_montgomery_reduce_u64(const arith_montgomery_u64* montgomery, const arith_u128 x) {
+    // See internal_montgomery_reduce_u32() for implementation details.
+    const arith_u64 quotient = (arith_u64)x * montgomery->inverse;
+    const arith_u64 x_high   = (arith_u64)(x >> 64);
+    const arith_u64 qn_high  = (arith_u64)(internal_multiply_u64(quotient, montgomery->modulus) >> 64);
+    const arith_u64 result   = x_high - qn_high;
+
+    return (x_high < qn_high) ? result + montgomery->modulus : result;
+}
+
+// Computes `multiplier * multiplicand * R^-1 (mod modulus)` with `R = 2^32`. If `multiplier` or `multiplicand` is not
+// smaller than `modulus`, the behaviour is undefined.
+static INLINE arith_u32 internal_montgomery_mul_u32(const arith_montgomery_u32* montgomery, const arith_u32 multiplier,
+                                                    const arith_u32 multiplicand) {
+    return internal_montgomery_reduce_u32(montgomery, (arith_u64)multiplier * multiplicand);
+}
+
+// Computes `multiplier * multiplicand * R^-1 (mod modulus)` with `R = 2^64`. If `multiplier` or `multiplicand` is not
+// smaller than `modulus`, the behaviour is undefined.
+static INLINE arith_u64 internal_montgomery_mul_u64(const arith_montgomery_u64* montgomery, const arith_u64 multiplier,
+                                                    const arith_u64 multiplicand) {
+    return internal_montgomery_reduce_u64(montgomery, internal_multiply_u64(multiplier, multiplicand));
+}
+
+// Computes `x * R (mod modulus)` with `R = 2^32`.
+static INLINE arith_u32 internal_montgomery_to_mont_u32(const arith_montgomery_u32* montgomery, const arith_u32 x) {
+    // Since x < R and R^2 (mod n) < n, the product is smaller than n * R.
+    return internal_montgomery_reduce_u32(montgomery, (arith_u64)x * montgomery->r_squared);
+}
+
+// Computes `x * R (mod modulus)` with `R = 2^64`.
+static INLINE arith_u64 internal_montgomery_to_mont_u64(const arith_montgomery_u64* montgomery, const arith_u64 x) {
+    return internal_montgomery_reduce_u64(montgomery, internal_multiply_u64(x, montgomery->r_squared));
+}
+
+// Computes `x * R^-1 (mod modulus)` with `R = 2^32`.
+static INLINE arith_u32 internal_montgomery_from_mont_u32(const arith_montgomery_u32* montgomery, const arith_u32 x) {
+    return internal_montgomery_reduce_u32(montgomery, x);
+}
+
+// Computes `x * R^-1 (mod modulus)` with `R = 2^64`.
+static INLINE arith_u64 internal_montgomery_from_mont_u64(const arith_montgomery_u64* montgomery, const arith_u64 x) {
+    return internal_montgomery_reduce_u64(montgomery, x);
+}
+
+
+// Computes `mont_base^exponent` in Montgomery form, where `mont_base` is in Montgomery form. If `mont_base` is not
+// smaller than `modulus`, the behaviour is undefined.
+static INLINE arith_u32 internal_montgomery_power_u32(const arith_montgomery_u32* montgomery, arith_u32 mont_base,
+                                                      arith_u32 exponent) {
+    // See internal_montgomery_power_u64() for implementation details.
+    arith_u32 result = ((exponent & 1) == 1) ? mont_base : montgomery->one;
+
+    while (true) {
+        if (exponent <= 1)
+            return result;
+
+        do {
+            mont_base = internal_montgomery_mul_u32(montgomery, mont_base, mont_base);
+            exponent >>= 1;
+        } while ((exponent & 1) == 0);
+
+        result = internal_montgomery_mul_u32(montgomery, result, mont_base);
+    }
+}
+
+// Computes `mont_base^exponent` in Montgomery form, where `mont_base` is in Montgomery form. If `mont_base` is not
+// smaller than `modulus`, the behaviour is undefined.
+static INLINE arith_u64 internal_montgomery_power_u64(const arith_montgomery_u64* montgomery, arith_u64 mont_base,
+                                                      arith_u64 exponent) {
+    // This is the loop of arith_power_mod_u64() with every modular multiplication replaced by a Montgomery product, so
+    // there is no division left in the loop. The modulus 1 needs no special case, since then R (mod n) = 0.
+    arith_u64 result = ((exponent & 1) == 1) ? mont_base : montgomery->one;
+
+    while (true) {
+        if (exponent <= 1)
+            return result;
+
+        do {
+            mont_base = internal_montgomery_mul_u64(montgomery, mont_base, mont_base);
+            exponent >>= 1;
+        } while ((exponent & 1) == 0);
+
+        result = internal_montgomery_mul_u64(montgomery, result, mont_base);
+    }
+}
+
+
+// Computes `x (mod modulus)`.
+static INLINE arith_u32 internal_barrett_reduce_u32(const arith_barrett_u32* barrett, const arith_u64 x) {
+    // With m = floor((2^64 - 1) / n), the estimate q = floor(x * m / 2^64) satisfies x / n - 1 < q <= x / n, so
+    // x - q * n lies in [0, 2n) and needs at most one correction.
+    const arith_u64 quotient  = (arith_u64)(internal_multiply_u64(x, barrett->reciprocal) >> 64);
+    const arith_u64 remainder = x - quotient * barrett->modulus;
+
+    return (arith_u32)((remainder >= barrett->modulus) ? remainder - barrett->modulus : remainder);
+}
+
+// Computes `(high * 2^64 + low) (mod modulus)`. If `high >= modulus`, the behaviour is undefined.
+static INLINE arith_u64 internal_barrett_reduce_2_by_1_u64(const arith_barrett_u64* barrett, const arith_u64 high,
+                                                           const arith_u64 low) {
+    // This is division by an invariant integer as described by Moller and Granlund ("Improved division by invariant
+    // integers", 2011), keeping only the remainder. Shifting both the dividend and the divisor left by the number of
+    // leading zeros of the modulus gives a normalized divisor d, for which the reciprocal v = floor((2^128 - 1) / d)
+    // - 2^64 yields a quotient estimate that is off by at most 2. Since high < n, the shifted high word stays below
+    // d. The shift is split in two so that it is well defined when shift = 0.
+
+    const arith_u64 divisor = barrett->divisor;
+    const arith_u64 u1      = (high << barrett->shift) | ((low >> 1) >> (63 - barrett->shift));
+    const arith_u64 u0      = low << barrett->shift;
+
+    const arith_u128 estimate = internal_multiply_u64(barrett->reciprocal, u1) + (((arith_u128)u1 << 64) | u0);
+    const arith_u64 quotient  = (arith_u64)(estimate >> 64) + 1;
+    arith_u64 remainder       = u0 - quotient * divisor;
+
+    if (remainder > (arith_u64)estimate)
+        remainder += divisor;
+
+    if (internal_unlikely(remainder >= divisor))
+        remainder -= divisor;
+
+    return remainder >> barrett->shift;
+}
+
+// Computes `x (mod modulus)`.
+static INLINE arith_u64 internal_barrett_reduce_u64(const arith_barrett_u64* barrett, const arith_u128 x) {
+    arith_u64 high = (arith_u64)(x >> 64);
+
+    // Products of reduced operands never take this branch.
+    if (internal_unlikely(high >= barrett->modulus))
+        high = internal_barrett_reduce_2_by_1_u64(barrett, 0, high);
+
+    return internal_barrett_reduce_2_by_1_u64(barrett, high, (arith_u64)x);
+}
+
+// Computes `multiplier * multiplicand (mod modulus)`.
+static INLINE arith_u32 internal_barrett_mod_mul_u32(const arith_barrett_u32* barrett, const arith_u32 multiplier,
+                                                     const arith_u32 multiplicand) {
+    return internal_barrett_reduce_u32(barrett, (arith_u64)multiplier * multiplicand);
+}
+
+// Computes `multiplier * multiplicand (mod modulus)`.
+static INLINE arith_u64 internal_barrett_mod_mul_u64(const arith_barrett_u64* barrett, const arith_u64 multiplier,
+                                                     const arith_u64 multiplicand) {
+    return internal_barrett_reduce_u64(barrett, internal_multiply_u64(multiplier, multiplicand));
+}
+
+// Computes `augend + addend (mod modulus)`. If `augend` or `addend` is not smaller than `modulus`, the behaviour is
+// undefined.
+static INLINE arith_u32 internal_barrett_mod_add_u32(const arith_barrett_u32* barrett, const arith_u32 augend,
+                                                     const arith_u32 addend) {
+    // See internal_barrett_mod_add_u64() for implementation details.
+    const arith_u32 sum = augend + addend;
+
+    return (sum < augend || sum >= barrett->modulus) ? sum - barrett->modulus : sum;
+}
+
+// Computes `augend + addend (mod modulus)`. If `augend` or `addend` is not smaller than `modulus`, the behaviour is
+// undefined.
+static INLINE arith_u64 internal_barrett_mod_add_u64(const arith_barrett_u64* barrett, const arith_u64 augend,
+                                                     const arith_u64 addend) {
+    // If the sum wraps around, its true value is sum + 2^64 >= n, and subtracting n in wrapping arithmetic gives the
+    // correct result as well.
+    const arith_u64 sum = augend + addend;
+
+    return (sum < augend || sum >= barrett->modulus) ? sum - barrett->modulus : sum;
+}
+
+// Computes `minuend - subtrahend (mod modulus)`. If `minuend` or `subtrahend` is not smaller than `modulus`, the
+// behaviour is undefined.
+static INLINE arith_u32 internal_barrett_mod_sub_u32(const arith_barrett_u32* barrett, const arith_u32 minuend,
+                                                     const arith_u32 subtrahend) {
+    const arith_u32 difference = minuend - subtrahend;
+
+    return (minuend < subtrahend) ? difference + barrett->modulus : difference;
+}
+
+// Computes `minuend - subtrahend (mod modulus)`. If `minuend` or `subtrahend` is not smaller than `modulus`, the
+// behaviour is undefined.
+static INLINE arith_u64 internal_barrett_mod_sub_u64(const arith_barrett_u64* barrett, const arith_u64 minuend,
+                                                     const arith_u64 subtrahend) {
+    const arith_u64 difference = minuend - subtrahend;
+
+    return (minuend < subtrahend) ? difference + barrett->modulus : difference;
+}
+
+// Computes `augend + addend (mod modulus)`. If `augend` or `addend` is not smaller than `modulus`, the behaviour is
+// undefined.
+static INLINE arith_u64 internal_mod_add_u64(const arith_u64 augend, const arith_u64 addend, const arith_u64 modulus) {
+    // See internal_barrett_mod_add_u64() for implementation details.
+    const arith_u64 sum = augend + addend;
+
+    return (sum < augend || sum >= modulus) ? sum - modulus : sum;
+}
+
+// Computes `minuend - subtrahend (mod modulus)`. If `minuend` or `subtrahend` is not smaller than `modulus`, the
+// behaviour is undefined.
+static INLINE arith_u64 internal_mod_sub_u64(const arith_u64 minuend, const arith_u64 subtrahend,
+                                             const arith_u64 modulus) {
+    const arith_u64 difference = minuend - subtrahend;
+
+    return (minuend < subtrahend) ? difference + modulus : difference;
+}
+
+
+// Computes `floor(sqrt(n))`.
+static INLINE arith_u64 internal_isqrt_u64(const arith_u64 n) {
+    // The square root in double precision is off by at most one after rounding, which the loops correct.
+    const double root_estimate = sqrt((double)n);
+    arith_u64 root             = (arith_u64)root_estimate;
+    if (root > 0xFFFFFFFF)
+        root = 0xFFFFFFFF;
+
+    while (root * root > n)
+        --root;
+    while (root < 0xFFFFFFFF && (root + 1) * (root + 1) <= n)
+        ++root;
+
+    return root;
+}
+
+// Computes `floor(cbrt(n))`.
+static INLINE arith_u64 internal_icbrt_u64(const arith_u64 n) {
+    // See internal_isqrt_u64() for implementation details.
+    const double root_estimate = cbrt((double)n);
+    arith_u64 root             = (arith_u64)root_estimate;
+    if (root > 2642245)
+        root = 2642245;  // The largest cube root of an `arith_u64`.
+
+    while (root * root * root > n)
+        --root;
+    while (root < 2642245 && (root + 1) * (root + 1) * (root + 1) <= n)
+        ++root;
+
+    return root;
+}
+
+
 
 #endif  // #ifndef ARITHMOS_NUMERIC_INTERNAL_H_
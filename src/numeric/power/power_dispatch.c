@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/power.h"
+
+#include <stddef.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(arith_i32, arith_power_mod_i32,
+                           (arith_i32 base, arith_u32 exponent, const arith_u32 modulus));
+ARITHMOS_DEFINE_DISPATCHER(arith_i64, arith_power_mod_i64,
+                           (const arith_i64 base, arith_u64 exponent, const arith_u64 modulus));
+ARITHMOS_DEFINE_DISPATCHER(arith_u32, arith_power_mod_u32,
+                           (arith_u32 base, arith_u32 exponent, const arith_u32 modulus));
+ARITHMOS_DEFINE_DISPATCHER(arith_u64, arith_power_mod_u64,
+                           (arith_u64 base, arith_u64 exponent, const arith_u64 modulus));
+
+ARITHMOS_DEFINE_DISPATCHER(void, arith_power_mod_u32_batch,
+                           (const arith_u32* base, const arith_u32* exponent, const arith_u32* modulus, arith_u32* out,
+                            const size_t count));
+ARITHMOS_DEFINE_DISPATCHER(void, arith_power_mod_u64_batch,
+                           (const arith_u64* base, const arith_u64* exponent, const arith_u64* modulus, arith_u64* out,
+                            const size_t count));
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_POWER_INTERNAL_H_
+#define ARITHMOS_NUMERIC_POWER_INTERNAL_H_
+
+
+#include "bit_operations.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+// Exponents of at least this many bits are handled by sliding-window exponentiation where the throughput of modular
+// multiplications is what counts, shorter ones by the binary square-and-multiply loop, which has no table to fill.
+#define POWER_MOD_WINDOW_THRESHOLD_BITS 16
+
+// The largest window width, for which the table holds `2^(POWER_MOD_MAX_WINDOW_WIDTH - 1)` odd powers.
+#define POWER_MOD_MAX_WINDOW_WIDTH 4
+
+
+// Returns the window width for an exponent of `bits` bits. A window of width `k` costs `2^(k - 1)` modular
+// multiplications to fill the table, after which there are about `bits / (k + 1)` windows against `bits / 2` set bits
+// for the binary loop.
+static INLINE unsigned internal_power_mod_window_width(const unsigned bits) {
+    return (bits > 48) ? 4 : 3;
+}
+
+// Computes `base ^ exponent (mod modulus)` where `^` is exponentiation, by left-to-right sliding-window
+// exponentiation. `exponent` must be nonzero and `modulus` larger than `1`.
+//
+// This takes about 10% fewer modular multiplications than arith_power_mod_u64() for 64-bit exponents, but all of them
+// depend on each other, while the multiplications of the binary loop run alongside its squarings. So it only wins
+// where many independent exponentiations are in flight and the divider is the bottleneck, as in the batch functions:
+// there it is 5-10% faster from 16-bit exponents on, and a single exponentiation is up to 10% slower.
+static INLINE arith_u64 internal_power_mod_window_u64(const arith_u64 base, const arith_u64 exponent,
+                                                      const arith_u64 modulus) {
+    const unsigned width = internal_power_mod_window_width(internal_bsr_u64(exponent) + 1);
+
+    // The odd powers `base^1, base^3, ..., base^(2^width - 1)`.
+    arith_u64 odd_powers[1 << (POWER_MOD_MAX_WINDOW_WIDTH - 1)];
+    odd_powers[0]          = base % modulus;
+    const arith_u64 square = internal_mod_mul_u64(odd_powers[0], odd_powers[0], modulus);
+    for (unsigned i = 1; i < (1U << (width - 1)); ++i)
+        odd_powers[i] = internal_mod_mul_u64(odd_powers[i - 1], square, modulus);
+
+    // Every window consists of at most `width` bits and starts and ends in a set bit. The result is squared once for
+    // every bit from the end of the previous window to the end of this one, and then multiplied by the power of its
+    // value. The first window sets the result instead, which saves the squarings of `1`.
+    arith_u64 result = 1;
+    arith_u64 rest   = exponent;
+    unsigned end     = 64;
+
+    while (rest != 0) {
+        const unsigned top = internal_bsr_u64(rest);
+        unsigned bottom    = (top + 1 >= width) ? top + 1 - width : 0;
+        bottom            += internal_bsf_u64(rest >> bottom);
+
+        const arith_u64 window = rest >> bottom;
+        if (end == 64) {
+            result = odd_powers[window >> 1];
+        } else {
+            for (unsigned i = bottom; i < end; ++i)
+                result = internal_mod_mul_u64(result, result, modulus);
+            result = internal_mod_mul_u64(result, odd_powers[window >> 1], modulus);
+        }
+
+        rest ^= window << bottom;
+        end   = bottom;
+    }
+
+    for (unsigned i = 0; i < end; ++i)
+        result = internal_mod_mul_u64(result, result, modulus);
+
+    return result;
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_POWER_INTERNAL_H_
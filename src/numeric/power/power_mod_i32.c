@@ -5,13 +5,14 @@
 
 #include <stdbool.h>
 
+#include "cpu_dispatch.h"
 #include "numeric/numeric_internal.h"
 
 #include "arithmos/core/types.h"
 
 
 
-extern arith_i32 arith_power_mod_i32(arith_i32 base, arith_u32 exponent, const arith_u32 modulus) {
+extern arith_i32 ARITHMOS_DISPATCHED(arith_power_mod_i32)(arith_i32 base, arith_u32 exponent, const arith_u32 modulus) {
     if (modulus == 1)
         return 0;
 
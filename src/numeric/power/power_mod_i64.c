@@ -5,13 +5,15 @@
 
 #include <stdbool.h>
 
+#include "cpu_dispatch.h"
 #include "numeric/numeric_internal.h"
 
 #include "arithmos/core/types.h"
 
 
 
-extern arith_i64 arith_power_mod_i64(const arith_i64 base, arith_u64 exponent, const arith_u64 modulus) {
+extern arith_i64 ARITHMOS_DISPATCHED(arith_power_mod_i64)(const arith_i64 base, arith_u64 exponent,
+                                                          const arith_u64 modulus) {
     if (modulus == 1)
         return 0;
 
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/power.h"
+
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+
+#if ARITHMOS_CPU_HAS_AVX2 || ARITHMOS_CPU_HAS_AVX512F
+#    include <immintrin.h>
+#endif  // #if ARITHMOS_CPU_HAS_AVX2 || ARITHMOS_CPU_HAS_AVX512F
+
+#include "arithmos/core/types.h"
+
+
+
+// The vector kernels below keep every 32-bit value in its own 64-bit lane, so that the full 64-bit products of
+// `_mm*_mul_epu32()` line up with their operands. A vector of 32-bit inputs is split into its even and its odd lanes,
+// which are exponentiated side by side, and merged again at the end.
+//
+// Each lane runs the same right-to-left square-and-multiply loop as arith_power_mod_u32(), but on Montgomery forms
+// with `R = 2^32` (see montgomery_power_mod_u64.c and internal_montgomery_reduce_u32()). Since the moduli differ per
+// lane, so do the Montgomery constants. `n^-1 (mod R)` follows from Newton's iteration as in
+// internal_inverse_mod_2_32_u32(). `R (mod n)` is obtained by doubling `1` 32 times, and `R^2 (mod n)`, the Montgomery
+// form of `R`, by doubling 4 more times and squaring the Montgomery form of `2^4` 3 times. This avoids the division
+// that the scalar code would need.
+//
+// A lane only multiplies its result by the base while its exponent has bits left, so lanes whose exponent has run out
+// keep their result while the loop continues for the others. The loop ends once every exponent is `0`.
+
+
+#if ARITHMOS_CPU_HAS_AVX512F
+
+// Computes `x - n` if `x >= n` and `x` otherwise, for every lane.
+static INLINE __m512i internal_reduce_once_u32x8(const __m512i x, const __m512i modulus) {
+    return _mm512_mask_sub_epi64(x, _mm512_cmpge_epu64_mask(x, modulus), x, modulus);
+}
+
+// Computes the Montgomery product `multiplier * multiplicand * R^-1 (mod modulus)` with `R = 2^32` for every lane.
+static INLINE __m512i internal_montgomery_mul_u32x8(const __m512i multiplier, const __m512i multiplicand,
+                                                    const __m512i modulus, const __m512i inverse) {
+    const __m512i product  = _mm512_mul_epu32(multiplier, multiplicand);
+    const __m512i quotient = _mm512_mul_epu32(product, inverse);
+    const __m512i x_high   = _mm512_srli_epi64(product, 32);
+    const __m512i qn_high  = _mm512_srli_epi64(_mm512_mul_epu32(quotient, modulus), 32);
+    const __m512i result   = _mm512_sub_epi64(x_high, qn_high);
+
+    return _mm512_mask_add_epi64(result, _mm512_cmplt_epu64_mask(x_high, qn_high), result, modulus);
+}
+
+// Computes `base ^ exponent (mod modulus)` for every 32-bit lane. Every modulus must be odd.
+static INLINE __m512i internal_power_mod_u32x16(const __m512i base, const __m512i exponent, const __m512i modulus) {
+    const __m512i low_mask = _mm512_set1_epi64(0xFFFFFFFF);
+    const __m512i one      = _mm512_set1_epi64(1);
+    const __m512i two      = _mm512_set1_epi64(2);
+
+    __m512i bases[2]     = {_mm512_and_si512(base, low_mask), _mm512_srli_epi64(base, 32)};
+    __m512i exponents[2] = {_mm512_and_si512(exponent, low_mask), _mm512_srli_epi64(exponent, 32)};
+    __m512i moduli[2]    = {_mm512_and_si512(modulus, low_mask), _mm512_srli_epi64(modulus, 32)};
+    __m512i inverses[2];
+    __m512i results[2];
+
+    for (int j = 0; j < 2; ++j) {
+        inverses[j] = moduli[j];
+        for (int k = 0; k < 4; ++k) {
+            const __m512i correction = _mm512_sub_epi64(two, _mm512_mul_epu32(moduli[j], inverses[j]));
+            inverses[j]              = _mm512_mul_epu32(inverses[j], correction);
+        }
+
+        __m512i power = internal_reduce_once_u32x8(one, moduli[j]);
+        for (int k = 0; k < 32; ++k)
+            power = internal_reduce_once_u32x8(_mm512_add_epi64(power, power), moduli[j]);
+        results[j] = power;
+
+        for (int k = 0; k < 4; ++k)
+            power = internal_reduce_once_u32x8(_mm512_add_epi64(power, power), moduli[j]);
+        for (int k = 0; k < 3; ++k)
+            power = internal_montgomery_mul_u32x8(power, power, moduli[j], inverses[j]);
+
+        bases[j] = internal_montgomery_mul_u32x8(bases[j], power, moduli[j], inverses[j]);
+    }
+
+    __mmask8 active[2] = {_mm512_test_epi64_mask(exponents[0], exponents[0]),
+                          _mm512_test_epi64_mask(exponents[1], exponents[1])};
+    while ((active[0] | active[1]) != 0) {
+        for (int j = 0; j < 2; ++j) {
+            const __mmask8 odd    = _mm512_test_epi64_mask(exponents[j], one);
+            const __m512i product = internal_montgomery_mul_u32x8(results[j], bases[j], moduli[j], inverses[j]);
+
+            results[j]   = _mm512_mask_mov_epi64(results[j], odd, product);
+            bases[j]     = internal_montgomery_mul_u32x8(bases[j], bases[j], moduli[j], inverses[j]);
+            exponents[j] = _mm512_srli_epi64(exponents[j], 1);
+            active[j]    = _mm512_test_epi64_mask(exponents[j], exponents[j]);
+        }
+    }
+
+    for (int j = 0; j < 2; ++j)
+        results[j] = internal_montgomery_mul_u32x8(results[j], one, moduli[j], inverses[j]);
+
+    return _mm512_or_si512(results[0], _mm512_slli_epi64(results[1], 32));
+}
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+// Computes `x - n` if `x >= n` and `x` otherwise, for every lane.
+static INLINE __m256i internal_reduce_once_u32x4(const __m256i x, const __m256i modulus) {
+    return _mm256_blendv_epi8(_mm256_sub_epi64(x, modulus), x, _mm256_cmpgt_epi64(modulus, x));
+}
+
+// Computes the Montgomery product `multiplier * multiplicand * R^-1 (mod modulus)` with `R = 2^32` for every lane.
+static INLINE __m256i internal_montgomery_mul_u32x4(const __m256i multiplier, const __m256i multiplicand,
+                                                    const __m256i modulus, const __m256i inverse) {
+    const __m256i product  = _mm256_mul_epu32(multiplier, multiplicand);
+    const __m256i quotient = _mm256_mul_epu32(product, inverse);
+    const __m256i x_high   = _mm256_srli_epi64(product, 32);
+    const __m256i qn_high  = _mm256_srli_epi64(_mm256_mul_epu32(quotient, modulus), 32);
+
+    // Both high halves are smaller than 2^32, so their difference is negative exactly if it borrowed.
+    const __m256i result = _mm256_sub_epi64(x_high, qn_high);
+
+    return _mm256_add_epi64(result, _mm256_and_si256(modulus, _mm256_cmpgt_epi64(qn_high, x_high)));
+}
+
+// Computes `base ^ exponent (mod modulus)` for every 32-bit lane. Every modulus must be odd.
+static INLINE __m256i internal_power_mod_u32x8(const __m256i base, const __m256i exponent, const __m256i modulus) {
+    const __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFF);
+    const __m256i one      = _mm256_set1_epi64x(1);
+    const __m256i two      = _mm256_set1_epi64x(2);
+
+    __m256i bases[2]     = {_mm256_and_si256(base, low_mask), _mm256_srli_epi64(base, 32)};
+    __m256i exponents[2] = {_mm256_and_si256(exponent, low_mask), _mm256_srli_epi64(exponent, 32)};
+    __m256i moduli[2]    = {_mm256_and_si256(modulus, low_mask), _mm256_srli_epi64(modulus, 32)};
+    __m256i inverses[2];
+    __m256i results[2];
+
+    for (int j = 0; j < 2; ++j) {
+        inverses[j] = moduli[j];
+        for (int k = 0; k < 4; ++k) {
+            const __m256i correction = _mm256_sub_epi64(two, _mm256_mul_epu32(moduli[j], inverses[j]));
+            inverses[j]              = _mm256_mul_epu32(inverses[j], correction);
+        }
+
+        __m256i power = internal_reduce_once_u32x4(one, moduli[j]);
+        for (int k = 0; k < 32; ++k)
+            power = internal_reduce_once_u32x4(_mm256_add_epi64(power, power), moduli[j]);
+        results[j] = power;
+
+        for (int k = 0; k < 4; ++k)
+            power = internal_reduce_once_u32x4(_mm256_add_epi64(power, power), moduli[j]);
+        for (int k = 0; k < 3; ++k)
+            power = internal_montgomery_mul_u32x4(power, power, moduli[j], inverses[j]);
+
+        bases[j] = internal_montgomery_mul_u32x4(bases[j], power, moduli[j], inverses[j]);
+    }
+
+    __m256i pending = _mm256_or_si256(exponents[0], exponents[1]);
+    while (!_mm256_testz_si256(pending, pending)) {
+        for (int j = 0; j < 2; ++j) {
+            const __m256i odd     = _mm256_cmpeq_epi64(_mm256_and_si256(exponents[j], one), one);
+            const __m256i product = internal_montgomery_mul_u32x4(results[j], bases[j], moduli[j], inverses[j]);
+
+            results[j]   = _mm256_blendv_epi8(results[j], product, odd);
+            bases[j]     = internal_montgomery_mul_u32x4(bases[j], bases[j], moduli[j], inverses[j]);
+            exponents[j] = _mm256_srli_epi64(exponents[j], 1);
+        }
+
+        pending = _mm256_or_si256(exponents[0], exponents[1]);
+    }
+
+    for (int j = 0; j < 2; ++j)
+        results[j] = internal_montgomery_mul_u32x4(results[j], one, moduli[j], inverses[j]);
+
+    return _mm256_or_si256(results[0], _mm256_slli_epi64(results[1], 32));
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F
+
+
+extern void ARITHMOS_DISPATCHED(arith_power_mod_u32_batch)(const arith_u32* base, const arith_u32* exponent,
+                                                           const arith_u32* modulus, arith_u32* out,
+                                                           const size_t count) {
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX512F
+
+    const __m512i one = _mm512_set1_epi32(1);
+    for (; i + 16 <= count; i += 16) {
+        // Montgomery arithmetic needs an odd modulus. Lanes with an even modulus compute modulo 1 instead and are
+        // redone by the scalar implementation afterwards.
+        const __m512i moduli = _mm512_loadu_si512(modulus + i);
+        const __mmask16 odd  = _mm512_test_epi32_mask(moduli, one);
+
+        const __m512i result = internal_power_mod_u32x16(_mm512_loadu_si512(base + i), _mm512_loadu_si512(exponent + i),
+                                                         _mm512_mask_mov_epi32(one, odd, moduli));
+        _mm512_mask_storeu_epi32(out + i, odd, result);
+
+        for (unsigned even = (unsigned)(~odd & 0xFFFF); even != 0; even &= even - 1) {
+            const size_t j = i + internal_bsf_u32(even);
+            out[j]         = arith_power_mod_u32(base[j], exponent[j], modulus[j]);
+        }
+    }
+
+#elif ARITHMOS_CPU_HAS_AVX2
+
+    const __m256i one = _mm256_set1_epi32(1);
+    for (; i + 8 <= count; i += 8) {
+        // See the AVX-512 version above.
+        const __m256i moduli = _mm256_loadu_si256((const __m256i*)(modulus + i));
+        const __m256i odd    = _mm256_cmpeq_epi32(_mm256_and_si256(moduli, one), one);
+
+        const __m256i result = internal_power_mod_u32x8(_mm256_loadu_si256((const __m256i*)(base + i)),
+                                                        _mm256_loadu_si256((const __m256i*)(exponent + i)),
+                                                        _mm256_blendv_epi8(one, moduli, odd));
+        _mm256_maskstore_epi32((int*)(out + i), odd, result);
+
+        for (unsigned even = (unsigned)~_mm256_movemask_ps(_mm256_castsi256_ps(odd)) & 0xFF; even != 0;
+             even &= even - 1) {
+            const size_t j = i + internal_bsf_u32(even);
+            out[j]         = arith_power_mod_u32(base[j], exponent[j], modulus[j]);
+        }
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F
+
+    for (; i < count; ++i)
+        out[i] = arith_power_mod_u32(base[i], exponent[i], modulus[i]);
+}
@@ -5,13 +5,14 @@
 
 #include <stdbool.h>
 
+#include "cpu_dispatch.h"
 #include "numeric/numeric_internal.h"
 
 #include "arithmos/core/types.h"
 
 
 
-extern arith_u64 arith_power_mod_u64(arith_u64 base, arith_u64 exponent, const arith_u64 modulus) {
+extern arith_u64 ARITHMOS_DISPATCHED(arith_power_mod_u64)(arith_u64 base, arith_u64 exponent, const arith_u64 modulus) {
     // This function uses a similar algorithm as arith_power_u64() but with some extra
     // edge case checks and modular multiplication instead of regular multiplication.
 
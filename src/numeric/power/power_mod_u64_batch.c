@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/power.h"
+
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "cpu_features.h"
+#include "inline.h"
+#include "numeric/power/power_internal.h"
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512IFMA
+#    include <immintrin.h>
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512IFMA
+
+#include "arithmos/core/types.h"
+
+
+
+// Computes `base ^ exponent (mod modulus)` for an element that is not handled in a vector. The elements are independent
+// of each other, so long exponents take the sliding-window path.
+static INLINE arith_u64 internal_power_mod_scalar_u64(const arith_u64 base, const arith_u64 exponent,
+                                                      const arith_u64 modulus) {
+    if (modulus == 1 || (exponent >> (POWER_MOD_WINDOW_THRESHOLD_BITS - 1)) == 0)
+        return arith_power_mod_u64(base, exponent, modulus);
+
+    return internal_power_mod_window_u64(base, exponent, modulus);
+}
+
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512IFMA
+
+// Computes `x - n` if `x >= n` and `x` otherwise, for every lane.
+static INLINE __m512i internal_reduce_once_u52x8(const __m512i x, const __m512i modulus) {
+    return _mm512_mask_sub_epi64(x, _mm512_cmpge_epu64_mask(x, modulus), x, modulus);
+}
+
+// Computes the Montgomery product `multiplier * multiplicand * R^-1 (mod modulus)` with `R = 2^52` for every lane. If
+// `multiplier >= R` or `multiplicand >= modulus`, the behaviour is undefined.
+static INLINE __m512i internal_montgomery_mul_u52x8(const __m512i multiplier, const __m512i multiplicand,
+                                                    const __m512i modulus, const __m512i inverse) {
+    // This is internal_montgomery_reduce_u64() with 52-bit limbs: IFMA multiplies the low 52 bits of its operands and
+    // returns either the low or the high 52 bits of the 104-bit product.
+    const __m512i zero     = _mm512_setzero_si512();
+    const __m512i x_low    = _mm512_madd52lo_epu64(zero, multiplier, multiplicand);
+    const __m512i x_high   = _mm512_madd52hi_epu64(zero, multiplier, multiplicand);
+    const __m512i quotient = _mm512_madd52lo_epu64(zero, x_low, inverse);
+    const __m512i qn_high  = _mm512_madd52hi_epu64(zero, quotient, modulus);
+    const __m512i result   = _mm512_sub_epi64(x_high, qn_high);
+
+    return _mm512_mask_add_epi64(result, _mm512_cmplt_epu64_mask(x_high, qn_high), result, modulus);
+}
+
+// Computes `base ^ exponent (mod modulus)` for every lane. Every modulus must be odd and smaller than `2^52`.
+static INLINE __m512i internal_power_mod_u52x8(const __m512i base, __m512i exponent, const __m512i modulus) {
+    // This follows the AVX-512 version of internal_power_mod_u32x16() in power_mod_u32_batch.c, with `R = 2^52`.
+    // `n^-1 (mod R)` needs 5 Newton iterations. `R^2 (mod n)` is the Montgomery form of `2^52 = (2^13)^4`, so after the
+    // 52 doublings that give `R (mod n)`, we double 13 more times and square twice.
+    //
+    // Unlike there, the base can exceed R. We split it as `base = high * R + low` with `low < R` and `high < 2^12`, so
+    // that its Montgomery form is the sum of the Montgomery products `low * R^2` and `high * R^3`.
+    const __m512i zero     = _mm512_setzero_si512();
+    const __m512i one      = _mm512_set1_epi64(1);
+    const __m512i two      = _mm512_set1_epi64(2);
+    const __m512i low_mask = _mm512_set1_epi64(((arith_u64)1 << 52) - 1);
+
+    __m512i inverse = modulus;
+    for (int k = 0; k < 5; ++k) {
+        const __m512i correction = _mm512_sub_epi64(two, _mm512_madd52lo_epu64(zero, modulus, inverse));
+        inverse                  = _mm512_madd52lo_epu64(zero, inverse, correction);
+    }
+
+    __m512i power = internal_reduce_once_u52x8(one, modulus);
+    for (int k = 0; k < 52; ++k)
+        power = internal_reduce_once_u52x8(_mm512_add_epi64(power, power), modulus);
+    __m512i result = power;
+
+    for (int k = 0; k < 13; ++k)
+        power = internal_reduce_once_u52x8(_mm512_add_epi64(power, power), modulus);
+    for (int k = 0; k < 2; ++k)
+        power = internal_montgomery_mul_u52x8(power, power, modulus, inverse);
+
+    const __m512i r_squared = power;
+    const __m512i r_cubed   = internal_montgomery_mul_u52x8(r_squared, r_squared, modulus, inverse);
+    __m512i mont_base       = _mm512_add_epi64(
+        internal_montgomery_mul_u52x8(_mm512_and_si512(base, low_mask), r_squared, modulus, inverse),
+        internal_montgomery_mul_u52x8(_mm512_srli_epi64(base, 52), r_cubed, modulus, inverse));
+    mont_base = internal_reduce_once_u52x8(mont_base, modulus);
+
+    __mmask8 active = _mm512_test_epi64_mask(exponent, exponent);
+    while (active != 0) {
+        const __mmask8 odd    = _mm512_test_epi64_mask(exponent, one);
+        const __m512i product = internal_montgomery_mul_u52x8(result, mont_base, modulus, inverse);
+
+        result    = _mm512_mask_mov_epi64(result, odd, product);
+        mont_base = internal_montgomery_mul_u52x8(mont_base, mont_base, modulus, inverse);
+        exponent  = _mm512_srli_epi64(exponent, 1);
+        active    = _mm512_test_epi64_mask(exponent, exponent);
+    }
+
+    return internal_montgomery_mul_u52x8(result, one, modulus, inverse);
+}
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512IFMA
+
+
+extern void ARITHMOS_DISPATCHED(arith_power_mod_u64_batch)(const arith_u64* base, const arith_u64* exponent,
+                                                           const arith_u64* modulus, arith_u64* out,
+                                                           const size_t count) {
+    size_t i = 0;
+
+#if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512IFMA
+
+    const __m512i one   = _mm512_set1_epi64(1);
+    const __m512i bound = _mm512_set1_epi64((arith_i64)1 << 52);
+    for (; i + 8 <= count; i += 8) {
+        // IFMA works on 52-bit limbs, so only lanes with an odd modulus below 2^52 can be handled in a vector. The
+        // other lanes compute modulo 1 instead and are redone by the scalar implementation afterwards.
+        const __m512i moduli     = _mm512_loadu_si512(modulus + i);
+        const __mmask8 supported = _mm512_test_epi64_mask(moduli, one) & _mm512_cmplt_epu64_mask(moduli, bound);
+
+        if (supported != 0) {
+            const __m512i bases     = _mm512_loadu_si512(base + i);
+            const __m512i exponents = _mm512_loadu_si512(exponent + i);
+            const __m512i moduli_1  = _mm512_mask_mov_epi64(one, supported, moduli);
+            const __m512i result    = internal_power_mod_u52x8(bases, exponents, moduli_1);
+            _mm512_mask_storeu_epi64(out + i, supported, result);
+        }
+
+        for (unsigned unsupported = (unsigned)(~supported & 0xFF); unsupported != 0; unsupported &= unsupported - 1) {
+            const size_t j = i + internal_bsf_u32(unsupported);
+            out[j]         = internal_power_mod_scalar_u64(base[j], exponent[j], modulus[j]);
+        }
+    }
+
+#endif  // #if ARITHMOS_CPU_HAS_AVX512F && ARITHMOS_CPU_HAS_AVX512IFMA
+
+    for (; i < count; ++i)
+        out[i] = internal_power_mod_scalar_u64(base[i], exponent[i], modulus[i]);
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/prime/prime_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+
+
+
+// The number of steps of Pollard's rho method between two gcd computations.
+#define RHO_BLOCK_SIZE 128
+
+// An `arith_u64` without prime factors below 128 has at most 9 prime factors, counted with multiplicity, since
+// `131^10 > 2^64`.
+#define MAX_LARGE_FACTORS 9
+
+
+// Computes `x^2 * R^-1 + c (mod modulus)`, the pseudorandom map of Pollard's rho method. If `x` or `c` is not smaller
+// than `modulus`, the behaviour is undefined.
+static INLINE arith_u64 internal_rho_step_u64(const arith_montgomery_u64* montgomery, const arith_u64 x,
+                                              const arith_u64 c) {
+    const arith_u64 square = internal_montgomery_mul_u64(montgomery, x, x);
+    const arith_u64 sum    = square + c;
+
+    return (sum < square || sum >= montgomery->modulus) ? sum - montgomery->modulus : sum;
+}
+
+// Computes `|x - y|`.
+static INLINE arith_u64 internal_absolute_difference_u64(const arith_u64 x, const arith_u64 y) {
+    return (x > y) ? x - y : y - x;
+}
+
+// Returns a nontrivial factor of the odd composite `n`. If `n` is prime, the function does not terminate.
+static arith_u64 internal_pollard_brent_u64(const arith_u64 n) {
+    // Pollard's rho method iterates a pseudorandom map x <- x^2 + c (mod n). Modulo a prime factor p of n, the
+    // sequence becomes periodic after about sqrt(p) steps, and then gcd(x_i - x_j, n) reveals p for indices i, j a
+    // period apart. Brent's variant compares every x_j with a saved x_i, which is replaced by x_j whenever j reaches
+    // twice i, so that every period is found with a single evaluation of the map per step.
+    //
+    // Each step multiplies the difference into a running product q, and gcd(q, n) is computed only once per block of
+    // RHO_BLOCK_SIZE steps. If the factors of n are found within the same block, the gcd becomes n. We then repeat the
+    // block from its saved start ys, taking the gcd after every step. If that still gives n, the periods modulo all
+    // prime factors were found at the same step, and we retry with the next c.
+    //
+    // No value is ever converted to Montgomery form: the map x <- x^2 * R^-1 + c is as good a pseudorandom map as
+    // x^2 + c, and the factors R^-1 in q do not change gcd(q, n), since n is odd. Hence the Montgomery constants that
+    // take divisions to compute are not needed either.
+    const arith_montgomery_u64 montgomery = {
+        .modulus   = n,
+        .inverse   = internal_inverse_mod_2_64_u64(n),
+        .one       = 0,
+        .r_squared = 0,
+    };
+
+    for (arith_u64 c = 1;; ++c) {
+        arith_u64 x       = 0;
+        arith_u64 y       = 2;
+        arith_u64 ys      = 2;
+        arith_u64 product = 1;
+        arith_u64 factor  = 1;
+
+        for (arith_u64 length = 1; factor == 1; length <<= 1) {
+            x = y;
+            for (arith_u64 i = 0; i < length; ++i)
+                y = internal_rho_step_u64(&montgomery, y, c);
+
+            for (arith_u64 k = 0; k < length && factor == 1; k += RHO_BLOCK_SIZE) {
+                const arith_u64 steps = (length - k < RHO_BLOCK_SIZE) ? length - k : RHO_BLOCK_SIZE;
+
+                ys = y;
+                for (arith_u64 i = 0; i < steps; ++i) {
+                    y                          = internal_rho_step_u64(&montgomery, y, c);
+                    const arith_u64 difference = internal_absolute_difference_u64(x, y);
+                    product                    = internal_montgomery_mul_u64(&montgomery, product, difference);
+                }
+
+                factor = arith_gcd_u64(product, n);
+            }
+        }
+
+        if (factor == n) {
+            do {
+                ys     = internal_rho_step_u64(&montgomery, ys, c);
+                factor = arith_gcd_u64(internal_absolute_difference_u64(x, ys), n);
+            } while (factor == 1);
+        }
+
+        if (factor != n)
+            return factor;
+    }
+}
+
+
+extern unsigned ARITHMOS_DISPATCHED(arith_factor_u64)(arith_u64 n, arith_u64* primes, unsigned* exponents) {
+    // Trial division removes the factors below 128, which are the most likely ones by far. A cofactor below 131^2 is
+    // then prime. Larger cofactors are split with Pollard's rho method until all parts are prime, and the prime
+    // factors found are sorted and merged at the end.
+
+    if (n < 2)
+        return 0;
+
+    unsigned count = 0;
+
+    const unsigned two_exponent = internal_bsf_u64(n);
+    if (two_exponent > 0) {
+        primes[count]    = 2;
+        exponents[count] = two_exponent;
+        ++count;
+        n >>= two_exponent;
+    }
+
+    for (unsigned i = 0; i < TRIAL_DIVISOR_COUNT_U64; ++i) {
+        if (n * trial_divisors_u64[i].inverse <= trial_divisors_u64[i].limit) {
+            unsigned exponent = 0;
+            do {
+                n *= trial_divisors_u64[i].inverse;
+                ++exponent;
+            } while (n * trial_divisors_u64[i].inverse <= trial_divisors_u64[i].limit);
+
+            primes[count]    = trial_divisors_u64[i].prime;
+            exponents[count] = exponent;
+            ++count;
+        }
+    }
+
+    if (n == 1)
+        return count;
+
+    arith_u64 factors[MAX_LARGE_FACTORS];
+    arith_u64 pending[MAX_LARGE_FACTORS];
+    unsigned factor_count  = 0;
+    unsigned pending_count = 0;
+
+    pending[pending_count++] = n;
+    while (pending_count > 0) {
+        const arith_u64 m = pending[--pending_count];
+
+        if (m < TRIAL_DIVISION_BOUND_U64 || arith_is_prime_u64(m)) {
+            // Insertion sort, since there are only a few factors.
+            unsigned i = factor_count++;
+            for (; i > 0 && factors[i - 1] > m; --i)
+                factors[i] = factors[i - 1];
+            factors[i] = m;
+        } else {
+            const arith_u64 factor   = internal_pollard_brent_u64(m);
+            pending[pending_count++] = factor;
+            pending[pending_count++] = m / factor;
+        }
+    }
+
+    for (unsigned i = 0; i < factor_count; ++i) {
+        if (i > 0 && factors[i] == factors[i - 1]) {
+            ++exponents[count - 1];
+        } else {
+            primes[count]    = factors[i];
+            exponents[count] = 1;
+            ++count;
+        }
+    }
+
+    return count;
+}
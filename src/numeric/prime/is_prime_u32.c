@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+// Bit `i` is set if and only if `i` is a prime below 64.
+#define SMALL_PRIME_MASK 0x28208A20A08A28ACULL
+
+// `n` is prime if it is not divisible by any of the trial divisors and smaller than the square of the next prime.
+#define TRIAL_DIVISION_BOUND (59 * 59)
+
+// The odd primes below 59. `n` is divisible by `p` if and only if `n * p^-1 (mod 2^32) <= floor((2^32 - 1) / p)`.
+static const struct {
+    arith_u32 inverse;  // `p^-1 (mod 2^32)`.
+    arith_u32 limit;    // `floor((2^32 - 1) / p)`.
+} trial_divisors[] = {
+    {0xAAAAAAAB, 0x55555555}, {0xCCCCCCCD, 0x33333333}, {0xB6DB6DB7, 0x24924924}, {0xBA2E8BA3, 0x1745D174},
+    {0xC4EC4EC5, 0x13B13B13}, {0xF0F0F0F1, 0x0F0F0F0F}, {0x286BCA1B, 0x0D79435E}, {0xE9BD37A7, 0x0B21642C},
+    {0x4F72C235, 0x08D3DCB0}, {0xBDEF7BDF, 0x08421084}, {0x914C1BAD, 0x06EB3E45}, {0xC18F9C19, 0x063E7063},
+    {0x2FA0BE83, 0x05F417D0}, {0x677D46CF, 0x0572620A}, {0x8C13521D, 0x04D4873E},
+};
+
+// The odd `n` that pass the test to base 2 are hashed to one of the second bases below by the top bits of
+// `n * HASH_MULTIPLIER (mod 2^32)`. All bases are smaller than `TRIAL_DIVISION_BOUND`, so none of them is `0 (mod n)`.
+#define HASH_MULTIPLIER 0x9E3779B1U
+#define HASH_BITS       4
+
+static const arith_u32 hashed_bases[1 << HASH_BITS] = {
+    166, 63, 101, 865, 15, 33, 255, 174, 942, 285, 1419, 937, 583, 2221, 734, 718,
+};
+
+
+// Computes `2^exponent` in Montgomery form. If `exponent` is `0`, the behaviour is undefined.
+static INLINE arith_u32 internal_montgomery_power_of_2_u32(const arith_montgomery_u32* montgomery,
+                                                           const arith_u32 exponent) {
+    // See internal_montgomery_power_of_2_u64() in is_prime_u64.c for implementation details.
+    const arith_u32 modulus = montgomery->modulus;
+    const arith_u32 one     = montgomery->one;
+    const arith_u32 two     = one + one;
+    arith_u32 result        = (two < one || two >= modulus) ? two - modulus : two;
+
+    for (unsigned bit = internal_bsr_u32(exponent); bit-- > 0;) {
+        result = internal_montgomery_mul_u32(montgomery, result, result);
+
+        const arith_u32 addend = result & -((exponent >> bit) & 1);
+        const arith_u32 sum    = result + addend;
+        result                 = (sum < result || sum >= modulus) ? sum - modulus : sum;
+    }
+
+    return result;
+}
+
+// Returns whether `modulus` is a strong probable prime to the base whose power `x = base^odd_part` is given in
+// Montgomery form, where `modulus - 1 = odd_part * 2^two_exponent`.
+static INLINE bool internal_is_strong_probable_prime_u32(const arith_montgomery_u32* montgomery, arith_u32 x,
+                                                         unsigned two_exponent) {
+    // See internal_is_strong_probable_prime_u64() in is_prime_u64.c for implementation details.
+    const arith_u32 minus_one = montgomery->modulus - montgomery->one;
+
+    if (x == montgomery->one || x == minus_one)
+        return true;
+
+    while (--two_exponent > 0) {
+        x = internal_montgomery_mul_u32(montgomery, x, x);
+        if (x == minus_one)
+            return true;
+    }
+
+    return false;
+}
+
+
+extern bool ARITHMOS_DISPATCHED(arith_is_prime_u32)(const arith_u32 n) {
+    // See is_prime_u64.c for the structure of the test. Below 2^32, every odd composite that passes the strong
+    // probable prime test to base 2 and has no prime factor below 59 fails it to the second base that it hashes to.
+    // The table of second bases was found by enumerating these composites (strong pseudoprimes to base 2), of which
+    // there are only 2116. Compared to the three bases 2, 7, 61 that are needed without hashing, this saves a
+    // full exponentiation for every prime, while composites usually already fail the test to base 2.
+
+    if (n < 64)
+        return ((SMALL_PRIME_MASK >> n) & 1) == 1;
+
+    if ((n & 1) == 0)
+        return false;
+
+    for (unsigned i = 0; i < sizeof(trial_divisors) / sizeof(trial_divisors[0]); ++i) {
+        if (n * trial_divisors[i].inverse <= trial_divisors[i].limit)
+            return false;
+    }
+
+    if (n < TRIAL_DIVISION_BOUND)
+        return true;
+
+    arith_montgomery_u32 montgomery = {
+        .modulus   = n,
+        .inverse   = internal_inverse_mod_2_32_u32(n),
+        .one       = (arith_u32)(((arith_u64)1 << 32) % n),
+        .r_squared = 0,
+    };
+
+    const unsigned two_exponent = internal_bsf_u32(n - 1);
+    const arith_u32 odd_part    = (n - 1) >> two_exponent;
+
+    if (!internal_is_strong_probable_prime_u32(&montgomery, internal_montgomery_power_of_2_u32(&montgomery, odd_part),
+                                               two_exponent))
+        return false;
+
+    montgomery.r_squared = (arith_u32)((arith_u64)montgomery.one * montgomery.one % n);
+
+    const arith_u32 base      = hashed_bases[(n * HASH_MULTIPLIER) >> (32 - HASH_BITS)];
+    const arith_u32 mont_base = internal_montgomery_to_mont_u32(&montgomery, base);
+
+    return internal_is_strong_probable_prime_u32(&montgomery,
+                                                 internal_montgomery_power_u32(&montgomery, mont_base, odd_part),
+                                                 two_exponent);
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+
+#include "bit_operations.h"
+#include "cpu_dispatch.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/prime/prime_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+// The bases after 2 of the smallest known set of bases for which the Miller-Rabin test is deterministic below 2^64,
+// found by Jim Sinclair.
+static const arith_u64 bases[] = {325, 9375, 28178, 450775, 9780504, 1795265022};
+
+
+// Computes `2^exponent` in Montgomery form. If `exponent` is `0`, the behaviour is undefined.
+static INLINE arith_u64 internal_montgomery_power_of_2_u64(const arith_montgomery_u64* montgomery,
+                                                           const arith_u64 exponent) {
+    // This is left-to-right binary exponentiation, in which every multiplication by the base is a doubling. A
+    // doubling is an addition with one conditional subtraction, so the exponentiation costs little more than its
+    // squarings. The doubling is done for every bit, with an addend of 0 for the 0-bits, so that the loop has no
+    // unpredictable branches. This also needs no conversion to Montgomery form, and thus no R^2 (mod n).
+    const arith_u64 modulus = montgomery->modulus;
+    const arith_u64 one     = montgomery->one;
+    const arith_u64 two     = one + one;
+    arith_u64 result        = (two < one || two >= modulus) ? two - modulus : two;
+
+    for (unsigned bit = internal_bsr_u64(exponent); bit-- > 0;) {
+        result = internal_montgomery_mul_u64(montgomery, result, result);
+
+        const arith_u64 addend = result & -((exponent >> bit) & 1);
+        const arith_u64 sum    = result + addend;
+        result                 = (sum < result || sum >= modulus) ? sum - modulus : sum;
+    }
+
+    return result;
+}
+
+// Returns whether `modulus` is a strong probable prime to the base whose power `x = base^odd_part` is given in
+// Montgomery form, where `modulus - 1 = odd_part * 2^two_exponent`.
+static INLINE bool internal_is_strong_probable_prime_u64(const arith_montgomery_u64* montgomery, arith_u64 x,
+                                                         unsigned two_exponent) {
+    // If n is prime, the only square roots of 1 (mod n) are 1 and -1. Hence the sequence x, x^2, ..., x^(2^(s - 1))
+    // either starts with 1 or contains -1, since its square x^(2^s) = base^(n - 1) is 1 by Fermat's little theorem.
+    // Montgomery forms of equal values are equal, so we compare with the Montgomery forms of 1 and -1 directly.
+    const arith_u64 minus_one = montgomery->modulus - montgomery->one;
+
+    if (x == montgomery->one || x == minus_one)
+        return true;
+
+    while (--two_exponent > 0) {
+        x = internal_montgomery_mul_u64(montgomery, x, x);
+        if (x == minus_one)
+            return true;
+    }
+
+    return false;
+}
+
+
+extern bool ARITHMOS_DISPATCHED(arith_is_prime_u64)(const arith_u64 n) {
+    // Below 2^32, the cheaper arithmetic of arith_is_prime_u32() suffices. Otherwise, trial division by the odd primes
+    // below 128 first rejects about three quarters of the odd n at the cost of a multiplication each. The remaining n
+    // are tested with the Miller-Rabin test to the 7 bases 2, 325, 9375, 28178, 450775, 9780504, 1795265022, which has
+    // no strong pseudoprimes below 2^64. Since all bases are smaller than n, none of them is 0 (mod n).
+    //
+    // Almost all composites already fail the test to base 2, so that one is done first, with the cheaper
+    // exponentiation of internal_montgomery_power_of_2_u64(). Only then R^2 (mod n) is computed, which is needed to
+    // convert the other bases to Montgomery form and costs a 128-bit division.
+
+    if (n <= ARITH_U32_MAX)
+        return arith_is_prime_u32((arith_u32)n);
+
+    if ((n & 1) == 0)
+        return false;
+
+    for (unsigned i = 0; i < TRIAL_DIVISOR_COUNT_U64; ++i) {
+        if (n * trial_divisors_u64[i].inverse <= trial_divisors_u64[i].limit)
+            return false;
+    }
+
+    arith_montgomery_u64 montgomery = {
+        .modulus   = n,
+        .inverse   = internal_inverse_mod_2_64_u64(n),
+        .one       = -n % n,
+        .r_squared = 0,
+    };
+
+    const unsigned two_exponent = internal_bsf_u64(n - 1);
+    const arith_u64 odd_part    = (n - 1) >> two_exponent;
+
+    if (!internal_is_strong_probable_prime_u64(&montgomery, internal_montgomery_power_of_2_u64(&montgomery, odd_part),
+                                               two_exponent))
+        return false;
+
+    montgomery.r_squared = (arith_u64)((arith_u128)montgomery.one * montgomery.one % n);
+
+    for (unsigned i = 0; i < sizeof(bases) / sizeof(bases[0]); ++i) {
+        const arith_u64 mont_base = internal_montgomery_to_mont_u64(&montgomery, bases[i]);
+
+        if (!internal_is_strong_probable_prime_u64(&montgomery,
+                                                   internal_montgomery_power_u64(&montgomery, mont_base, odd_part),
+                                                   two_exponent))
+            return false;
+    }
+
+    return true;
+}
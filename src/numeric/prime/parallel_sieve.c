@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "numeric/prime/sieve_internal.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+// The smallest number of segments per chunk. Moving the sieving primes of a thread to its next chunk costs a division
+// per sieving prime, so chunks also grow with `sqrt(hi)` to keep that cost small compared to sieving the chunk.
+#define SIEVE_MIN_CHUNK_SEGMENTS 16
+#define SIEVE_CHUNK_SQRT_DIVISOR 4096
+
+// The smallest number of chunks per thread, so that threads that finish early can take over the remaining work.
+#define SIEVE_CHUNKS_PER_THREAD 4
+
+// Every thread generates the sieving primes up to `sqrt(hi)` itself, so a thread is only started for every
+// `SIEVE_THREAD_SQRT_FACTOR * sqrt(hi)` numbers of the range.
+#define SIEVE_THREAD_SQRT_FACTOR 16
+
+// The primes of a chunk, which wait in a slot until all earlier chunks are passed to the callback.
+typedef struct internal_sieve_slot {
+    arith_u64* primes;
+    size_t count;
+    size_t capacity;
+    bool ready;
+} internal_sieve_slot;
+
+typedef struct internal_parallel_sieve {
+    arith_u64 segment_count;
+    arith_u64 chunk_segments;
+    arith_u64 chunk_count;
+    atomic_ullong next_chunk;  // The next chunk that no thread has taken yet.
+    atomic_ullong count;
+    atomic_bool failed;
+
+    arith_prime_callback callback;
+    void* context;
+
+    // The chunks that are taken but not yet passed to the callback are kept in a ring of `window` slots, indexed by
+    // chunk modulo `window`. A thread waits for its slot to be free before it sieves a chunk.
+    pthread_mutex_t mutex;
+    pthread_cond_t delivered_changed;
+    arith_u64 delivered;  // The next chunk to pass to the callback.
+    bool delivering;      // Set while a thread passes chunks to the callback.
+    size_t window;
+    internal_sieve_slot* slots;
+} internal_parallel_sieve;
+
+typedef struct internal_sieve_worker {
+    internal_parallel_sieve* shared;
+    internal_sieve sieve;
+    pthread_t thread;
+} internal_sieve_worker;
+
+
+// Waits until the slot of `chunk` is free, and returns `false` if another thread failed in the meantime.
+static bool internal_sieve_wait_for_slot(internal_parallel_sieve* shared, const arith_u64 chunk) {
+    pthread_mutex_lock(&shared->mutex);
+    while (chunk >= shared->delivered + shared->window && !atomic_load(&shared->failed))
+        pthread_cond_wait(&shared->delivered_changed, &shared->mutex);
+    pthread_mutex_unlock(&shared->mutex);
+
+    return !atomic_load(&shared->failed);
+}
+
+// Marks the slot of `chunk` as ready, and passes the ready chunks to the callback in order unless another thread is
+// already doing so. The callback is called without holding the mutex, so that the other threads keep sieving.
+static void internal_sieve_deliver(internal_parallel_sieve* shared, const arith_u64 chunk) {
+    pthread_mutex_lock(&shared->mutex);
+    shared->slots[chunk % shared->window].ready = true;
+
+    if (!shared->delivering) {
+        shared->delivering = true;
+
+        for (internal_sieve_slot* slot = &shared->slots[shared->delivered % shared->window]; slot->ready;
+             slot                      = &shared->slots[shared->delivered % shared->window]) {
+            pthread_mutex_unlock(&shared->mutex);
+            if (slot->count > 0)
+                shared->callback(slot->primes, slot->count, shared->context);
+            pthread_mutex_lock(&shared->mutex);
+
+            slot->ready = false;
+            slot->count = 0;
+            ++shared->delivered;
+            pthread_cond_broadcast(&shared->delivered_changed);
+        }
+
+        shared->delivering = false;
+    }
+
+    pthread_mutex_unlock(&shared->mutex);
+}
+
+// Stores the primes of the current segment of `sieve` in `slot`, and returns `false` if memory could not be
+// allocated.
+static bool internal_sieve_store_segment(internal_sieve_slot* slot, const internal_sieve* sieve) {
+    if (slot->capacity - slot->count < 8 * sieve->size) {
+        const size_t capacity = 2 * slot->capacity + 8 * sieve->size;
+        arith_u64* primes     = realloc(slot->primes, capacity * sizeof(*primes));
+        if (primes == NULL)
+            return false;
+
+        slot->primes   = primes;
+        slot->capacity = capacity;
+    }
+
+    slot->count += internal_sieve_extract_segment(sieve, slot->primes + slot->count);
+    return true;
+}
+
+static void* internal_sieve_work(void* argument) {
+    internal_sieve_worker* worker   = argument;
+    internal_parallel_sieve* shared = worker->shared;
+    internal_sieve* sieve           = &worker->sieve;
+    arith_u64 count                 = 0;
+
+    for (;;) {
+        const arith_u64 chunk = atomic_fetch_add(&shared->next_chunk, 1);
+        if (chunk >= shared->chunk_count || atomic_load(&shared->failed))
+            break;
+
+        internal_sieve_slot* slot = NULL;
+        if (shared->callback != NULL) {
+            if (!internal_sieve_wait_for_slot(shared, chunk))
+                break;
+            slot = &shared->slots[chunk % shared->window];
+        }
+
+        bool success = internal_sieve_seek(sieve, chunk * shared->chunk_segments);
+        for (arith_u64 i = 0; success && i < shared->chunk_segments && internal_sieve_next_segment(sieve); ++i) {
+            if (slot != NULL)
+                success = internal_sieve_store_segment(slot, sieve);
+            else
+                count += internal_sieve_count_segment(sieve);
+        }
+
+        if (!success || sieve->failed) {
+            atomic_store(&shared->failed, true);
+            pthread_mutex_lock(&shared->mutex);
+            pthread_cond_broadcast(&shared->delivered_changed);
+            pthread_mutex_unlock(&shared->mutex);
+            break;
+        }
+
+        if (slot != NULL)
+            internal_sieve_deliver(shared, chunk);
+    }
+
+    atomic_fetch_add(&shared->count, count);
+    return NULL;
+}
+
+
+extern bool internal_sieve_parallel(const arith_u64 lo, const arith_u64 hi, unsigned thread_count,
+                                    const arith_prime_callback callback, void* const context, arith_u64* const count) {
+    // The range is split into chunks of consecutive segments, which the threads take in increasing order. Every
+    // thread sieves with its own internal_sieve over the whole range, and moves its sieving primes past the chunks
+    // taken by the other threads with internal_sieve_seek(). Hence no state is shared while sieving, and the sieving
+    // primes are generated only once per thread.
+
+    if (thread_count == 0) {
+        const long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count         = (cpu_count > 0) ? (unsigned)cpu_count : 1;
+    }
+
+    internal_parallel_sieve shared = {
+        .callback   = callback,
+        .context    = context,
+        .delivered  = 0,
+        .delivering = false,
+    };
+    atomic_init(&shared.next_chunk, 0);
+    atomic_init(&shared.count, 0);
+    atomic_init(&shared.failed, false);
+
+    internal_sieve_worker* workers = calloc(thread_count, sizeof(*workers));
+    if (workers == NULL)
+        return false;
+
+    workers[0].shared = &shared;
+    if (!internal_sieve_init(&workers[0].sieve, lo, hi)) {
+        free(workers);
+        return false;
+    }
+
+    const arith_u64 useful_threads = (hi - lo) / (SIEVE_THREAD_SQRT_FACTOR * (workers[0].sieve.sqrt_hi + 1)) + 1;
+    if (thread_count > useful_threads)
+        thread_count = (unsigned)useful_threads;
+
+    // Chunks in callback mode stay small, since all primes of a chunk are held in memory until it is passed.
+    shared.segment_count  = workers[0].sieve.segment_count;
+    shared.chunk_segments = workers[0].sieve.sqrt_hi / SIEVE_CHUNK_SQRT_DIVISOR;
+    if (shared.chunk_segments < SIEVE_MIN_CHUNK_SEGMENTS || callback != NULL)
+        shared.chunk_segments = SIEVE_MIN_CHUNK_SEGMENTS;
+
+    const arith_u64 balanced_segments =
+    (shared.segment_count + SIEVE_CHUNKS_PER_THREAD * thread_count - 1) / (SIEVE_CHUNKS_PER_THREAD * thread_count);
+    if (shared.chunk_segments > balanced_segments)
+        shared.chunk_segments = (balanced_segments > 0) ? balanced_segments : 1;
+
+    shared.chunk_count = (shared.segment_count + shared.chunk_segments - 1) / shared.chunk_segments;
+    if (thread_count > shared.chunk_count)
+        thread_count = (shared.chunk_count > 0) ? (unsigned)shared.chunk_count : 1;
+
+    unsigned initialized = 1;
+    for (; initialized < thread_count; ++initialized) {
+        workers[initialized].shared = &shared;
+        if (!internal_sieve_init(&workers[initialized].sieve, lo, hi))
+            break;
+    }
+
+    bool success  = initialized == thread_count;
+    shared.window = 2 * (size_t)thread_count;
+    if (success && callback != NULL) {
+        shared.slots = calloc(shared.window, sizeof(*shared.slots));
+        success      = shared.slots != NULL;
+    }
+
+    if (success) {
+        pthread_mutex_init(&shared.mutex, NULL);
+        pthread_cond_init(&shared.delivered_changed, NULL);
+
+        // The calling thread is the first worker.
+        unsigned started = 1;
+        for (; started < thread_count; ++started) {
+            if (pthread_create(&workers[started].thread, NULL, internal_sieve_work, &workers[started]) != 0)
+                break;
+        }
+        internal_sieve_work(&workers[0]);
+        for (unsigned i = 1; i < started; ++i)
+            pthread_join(workers[i].thread, NULL);
+
+        pthread_cond_destroy(&shared.delivered_changed);
+        pthread_mutex_destroy(&shared.mutex);
+
+        success = !atomic_load(&shared.failed);
+        if (count != NULL)
+            *count = atomic_load(&shared.count);
+    }
+
+    for (size_t i = 0; i < shared.window && shared.slots != NULL; ++i)
+        free(shared.slots[i].primes);
+    free(shared.slots);
+
+    for (unsigned i = 0; i < initialized; ++i)
+        internal_sieve_free(&workers[i].sieve);
+    free(workers);
+
+    return success;
+}
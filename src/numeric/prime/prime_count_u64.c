@@ -0,0 +1,597 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "cpu_dispatch.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/prime/sieve_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+
+
+
+// Below this bound, the primes are counted with the sieve of Eratosthenes, which is faster there.
+#define LMO_SIEVE_BOUND 1000000
+
+// A segment covers `LMO_SEGMENT_SPAN` consecutive numbers, of which only the odd ones are stored, one bit each.
+#define LMO_SEGMENT_SPAN  ((arith_u64)1 << 20)
+#define LMO_SEGMENT_BITS  (LMO_SEGMENT_SPAN / 2)
+#define LMO_SEGMENT_WORDS (LMO_SEGMENT_BITS / 64)
+
+// The unsieved numbers of a segment are counted per block of `2^LMO_BLOCK_SHIFT` bits.
+#define LMO_BLOCK_SHIFT 10
+#define LMO_BLOCK_COUNT (LMO_SEGMENT_BITS >> LMO_BLOCK_SHIFT)
+#define LMO_BLOCK_WORDS ((1 << LMO_BLOCK_SHIFT) / 64)
+
+// `y = alpha * cbrt(x)` with `alpha = LMO_ALPHA_SCALE * log(x)^3`, but at least `cbrt(x) + 1`.
+#define LMO_ALPHA_SCALE 0.0003
+
+// The primes for P2 are generated in descending chunks of this length, each of which is a single sieve segment.
+#define LMO_P2_CHUNK_SPAN (SIEVE_SEGMENT_SPAN / 2)
+
+// The smallest number of units of work per thread, so that threads that finish early can take over the remaining work.
+#define LMO_UNITS_PER_THREAD 8
+
+
+// The special leaves `(p, m)` of a prime `p` with `lower < m <= upper`, visited in decreasing order of `m`, hence in
+// increasing order of their argument `z = x / (p * m)`. If `p > sqrt(y)`, every such `m` is a prime `q > p` and the
+// leaves are enumerated by the index of `q` instead.
+typedef struct internal_lmo_leaves {
+    arith_u64 m;    // The `m` of the next leaf, or the index of its prime `q`.
+    arith_u64 end;  // The leaves continue while `m > end`.
+    arith_u64 z;    // The argument of the next leaf, or `ARITH_U64_MAX` if there is none.
+} internal_lmo_leaves;
+
+// The primes `p` with `lower < p <= top` whose `pi(x / p)` is still to be counted, in decreasing order.
+typedef struct internal_lmo_p2 {
+    arith_u64* primes;  // The primes of the current chunk, taken from the end.
+    size_t count;
+    arith_u64 top;
+    arith_u64 lower;
+    arith_u64 p;  // The next prime, or `0` if there is none.
+} internal_lmo_p2;
+
+// The contribution of a unit of consecutive segments. Counts that depend on earlier units are kept as coefficients,
+// and are resolved once all units are done.
+typedef struct internal_lmo_unit {
+    arith_i128 sum;               // The part of `S2 - P2` that is known within the unit.
+    arith_i64 pi_coefficient;     // The multiple of the number of primes below the unit to add.
+    arith_i64* phi_coefficients;  // The multiples of `phi(low, b) + b - 1` below the unit to add.
+    arith_u64* phi_counts;        // The numbers left in the unit after sieving with the first `b` primes.
+    arith_u64 active;             // `phi_counts[b]` is only set for `b <= active`, and equals `prime_count` otherwise.
+    arith_u64 prime_count;        // The number of primes in the unit, with `1` counted instead of `2`.
+    arith_u64 p2_count;           // The number of primes of P2 whose `pi(x / p)` lies in the unit.
+} internal_lmo_unit;
+
+typedef struct internal_lmo {
+    arith_u64 x;
+    arith_u64 y;  // The primes up to `y` are sieved through the special leaves, the larger ones through P2.
+    arith_u64 sqrt_x;
+    arith_u64 sqrt_y;
+    arith_u64 bound;  // `x / y`, the largest argument of a special leaf.
+
+    arith_u32* primes;  // The primes up to `y`, from `primes[1] = 2` to `primes[a]`.
+    arith_u64 a;
+    arith_u64 hard_limit;      // The largest `b` for which there are hard leaves.
+    arith_u32* least_factors;  // The least prime factor of every `m <= y`, with `ARITH_U32_MAX` for `m = 1`.
+    signed char* mu;           // The Moebius function of every `m <= y`.
+
+    arith_u64 segment_count;
+    arith_u64 unit_segments;
+    arith_u64 unit_count;
+    internal_lmo_unit* units;
+    atomic_ullong next_unit;  // The next unit that no thread has taken yet.
+    atomic_bool failed;
+} internal_lmo;
+
+typedef struct internal_lmo_worker {
+    internal_lmo* shared;
+    arith_u64* words;     // The current segment, where bit `i` stands for `low + 2 * i + 1`.
+    arith_u32* counters;  // The number of set bits of every block of `words`.
+    arith_u32* prefix;    // `prefix[w]` is the number of set bits of the words before `w`.
+    internal_lmo_leaves* easy;
+    internal_lmo_leaves* hard;
+    internal_lmo_p2 p2;
+    pthread_t thread;
+} internal_lmo_worker;
+
+
+// Returns the number of primes up to `n`, which must be at most `y`.
+static arith_u64 internal_lmo_small_pi(const internal_lmo* lmo, const arith_u64 n) {
+    arith_u64 low  = 1;
+    arith_u64 high = lmo->a + 1;
+    while (low < high) {
+        const arith_u64 middle = low + (high - low) / 2;
+        if (lmo->primes[middle] <= n)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low - 1;
+}
+
+// Moves `leaves` to the first leaf of `p` at or below its current `m`.
+static INLINE void internal_lmo_find_leaf(const internal_lmo* lmo, internal_lmo_leaves* leaves, const arith_u64 p) {
+    if (p > lmo->sqrt_y) {
+        leaves->z = (leaves->m > leaves->end) ? lmo->x / (p * lmo->primes[leaves->m]) : ARITH_U64_MAX;
+        return;
+    }
+
+    while (leaves->m > leaves->end && (lmo->mu[leaves->m] == 0 || lmo->least_factors[leaves->m] <= p))
+        --leaves->m;
+    leaves->z = (leaves->m > leaves->end) ? lmo->x / (p * leaves->m) : ARITH_U64_MAX;
+}
+
+// Returns the Moebius function of the `m` of the current leaf of `p`.
+static INLINE int internal_lmo_leaf_mu(const internal_lmo* lmo, const internal_lmo_leaves* leaves, const arith_u64 p) {
+    return (p > lmo->sqrt_y) ? -1 : lmo->mu[leaves->m];
+}
+
+static void internal_lmo_init_leaves(const internal_lmo* lmo, internal_lmo_leaves* leaves, const arith_u64 p,
+                                     arith_u64 lower, const arith_u64 upper) {
+    if (p > lmo->sqrt_y) {
+        if (lower < p)
+            lower = p;
+        leaves->m   = (upper > lower) ? internal_lmo_small_pi(lmo, upper) : 0;
+        leaves->end = (upper > lower) ? internal_lmo_small_pi(lmo, lower) : 0;
+    } else {
+        leaves->m   = upper;
+        leaves->end = lower;
+    }
+
+    internal_lmo_find_leaf(lmo, leaves, p);
+}
+
+// Moves to the next prime for P2, and returns `false` if memory could not be allocated.
+static bool internal_lmo_next_p2(internal_lmo_p2* p2) {
+    while (p2->count == 0 && p2->top > p2->lower) {
+        const arith_u64 chunk_lo = (p2->top - p2->lower > LMO_P2_CHUNK_SPAN) ? p2->top - LMO_P2_CHUNK_SPAN + 1
+                                                                              : p2->lower + 1;
+
+        internal_sieve sieve;
+        if (!internal_sieve_init(&sieve, chunk_lo, p2->top))
+            return false;
+        while (internal_sieve_next_segment(&sieve))
+            p2->count += internal_sieve_extract_segment(&sieve, p2->primes + p2->count);
+
+        const bool failed = sieve.failed;
+        internal_sieve_free(&sieve);
+        if (failed)
+            return false;
+
+        p2->top = chunk_lo - 1;
+    }
+
+    p2->p = (p2->count > 0) ? p2->primes[--p2->count] : 0;
+    return true;
+}
+
+// Returns the number of set bits of the current segment before bit `index`.
+static INLINE arith_u64 internal_lmo_count(const internal_lmo_worker* worker, const arith_u64 index) {
+    arith_u64 count = worker->prefix[index / 64];
+    if (index % 64 != 0)
+        count += (arith_u64)__builtin_popcountll(worker->words[index / 64] & ((1ULL << (index % 64)) - 1));
+
+    return count;
+}
+
+// Crosses off the odd multiples of `p` from `p^2` on in the segment `[low, low + 2 * bits)`, and returns the number of
+// bits cleared. The counters are only kept up to date if `update_counters` is set.
+static INLINE arith_u64 internal_lmo_cross_off(internal_lmo_worker* worker, const arith_u64 low, const arith_u64 bits,
+                                               const arith_u64 p, const bool update_counters) {
+    arith_u64 start = (low + p - 1) / p * p;
+    if (start < p * p)
+        start = p * p;
+    if (start % 2 == 0)
+        start += p;
+
+    arith_u64* words  = worker->words;
+    arith_u64 removed = 0;
+    if (update_counters) {
+        for (arith_u64 i = (start - low - 1) / 2; i < bits; i += p) {
+            const arith_u64 bit = (words[i / 64] >> (i % 64)) & 1;
+            words[i / 64] &= ~(1ULL << (i % 64));
+            worker->counters[i >> LMO_BLOCK_SHIFT] -= (arith_u32)bit;
+            removed += bit;
+        }
+    } else {
+        for (arith_u64 i = (start - low - 1) / 2; i < bits; i += p)
+            words[i / 64] &= ~(1ULL << (i % 64));
+    }
+
+    return removed;
+}
+
+// Adds the hard leaves of `primes[b + 1]` in the segment `[low, high)`, which is sieved with the first `b` primes.
+static void internal_lmo_hard_leaves(internal_lmo_worker* worker, internal_lmo_unit* unit, const arith_u64 b,
+                                     const arith_u64 low, const arith_u64 high) {
+    const internal_lmo* lmo     = worker->shared;
+    internal_lmo_leaves* leaves = &worker->hard[b];
+    const arith_u64 p           = lmo->primes[b + 1];
+    const arith_i128 phi_offset = (arith_i128)unit->phi_counts[b] - (arith_i128)(b - 1);
+
+    size_t block     = 0;
+    arith_u64 before = 0;  // The number of set bits in the blocks before `block`.
+    while (leaves->z < high) {
+        const arith_u64 index  = (leaves->z - low + 1) / 2;
+        const arith_u64 target = index >> LMO_BLOCK_SHIFT;
+        for (; block < target; ++block)
+            before += worker->counters[block];
+
+        arith_u64 count = before;
+        for (arith_u64 w = target * LMO_BLOCK_WORDS; w < index / 64; ++w)
+            count += (arith_u64)__builtin_popcountll(worker->words[w]);
+        if (index % 64 != 0)
+            count += (arith_u64)__builtin_popcountll(worker->words[index / 64] & ((1ULL << (index % 64)) - 1));
+
+        const int mu = internal_lmo_leaf_mu(lmo, leaves, p);
+        unit->sum -= mu * (phi_offset + count);
+        unit->phi_coefficients[b] -= mu;
+
+        --leaves->m;
+        internal_lmo_find_leaf(lmo, leaves, p);
+    }
+}
+
+// Computes the contribution of unit `index`, and returns `false` if memory could not be allocated.
+static bool internal_lmo_process_unit(internal_lmo_worker* worker, const arith_u64 index) {
+    internal_lmo* lmo       = worker->shared;
+    internal_lmo_unit* unit = &lmo->units[index];
+    const arith_u64 x       = lmo->x;
+
+    const arith_u64 first_segment = index * lmo->unit_segments;
+    const arith_u64 end_segment   = (first_segment + lmo->unit_segments < lmo->segment_count)
+                                    ? first_segment + lmo->unit_segments
+                                    : lmo->segment_count;
+    const arith_u64 unit_low      = first_segment * LMO_SEGMENT_SPAN;
+    const arith_u64 unit_high     = (end_segment * LMO_SEGMENT_SPAN < lmo->bound + 1) ? end_segment * LMO_SEGMENT_SPAN
+                                                                                      : lmo->bound + 1;
+
+    // The leaves with an argument of at least `unit_low` are those with `p * m <= x / unit_low`.
+    for (arith_u64 b = 2; b < lmo->a; ++b) {
+        const arith_u64 p        = lmo->primes[b + 1];
+        const arith_u64 lower    = lmo->y / p;
+        const arith_u64 hard_max = x / p / p / p;  // Hard leaves `(p, m)` are those with `m <= x / p^3`.
+
+        arith_u64 upper = lmo->y;
+        if (unit_low > 0 && x / unit_low / p < upper)
+            upper = x / unit_low / p;
+
+        // Leaves of `p > sqrt(y)` with `x / (p * q) < p` are counted in arith_prime_count_u64().
+        const arith_u64 easy_upper = (p > lmo->sqrt_y && x / p / p < upper) ? x / p / p : upper;
+        internal_lmo_init_leaves(lmo, &worker->easy[b], p, (hard_max > lower) ? hard_max : lower, easy_upper);
+        if (b <= lmo->hard_limit)
+            internal_lmo_init_leaves(lmo, &worker->hard[b], p, lower, (hard_max < upper) ? hard_max : upper);
+    }
+
+    // The primes `p` for P2 are those with `unit_low <= x / p < unit_high`.
+    internal_lmo_p2* p2 = &worker->p2;
+    p2->count           = 0;
+    p2->top             = (unit_low > 0 && x / unit_low < lmo->sqrt_x) ? x / unit_low : lmo->sqrt_x;
+    p2->lower           = (x / unit_high > lmo->y) ? x / unit_high : lmo->y;
+    if (!internal_lmo_next_p2(p2))
+        return false;
+
+    unit->active      = 1;
+    unit->prime_count = 0;
+    for (arith_u64 segment = first_segment; segment < end_segment; ++segment) {
+        const arith_u64 low  = segment * LMO_SEGMENT_SPAN;
+        const arith_u64 high = (low + LMO_SEGMENT_SPAN < unit_high) ? low + LMO_SEGMENT_SPAN : unit_high;
+        const arith_u64 bits = (high - low) / 2;
+
+        for (arith_u64 w = 0; w < LMO_SEGMENT_WORDS; ++w) {
+            const arith_u64 word_bits = (bits > 64 * w) ? bits - 64 * w : 0;
+            worker->words[w]          = (word_bits >= 64) ? ~0ULL : (1ULL << word_bits) - 1;
+        }
+        for (arith_u64 block = 0; block < LMO_BLOCK_COUNT; ++block) {
+            const arith_u64 block_bits = (bits > (block << LMO_BLOCK_SHIFT)) ? bits - (block << LMO_BLOCK_SHIFT) : 0;
+            worker->counters[block]    = (arith_u32)((block_bits < (1 << LMO_BLOCK_SHIFT)) ? block_bits
+                                                                                          : (1 << LMO_BLOCK_SHIFT));
+        }
+
+        // Sieve with one prime at a time while there are hard leaves, whose values of phi() are counted in between.
+        arith_u64 segment_count = bits;
+        arith_u64 b             = 2;
+        for (; b <= lmo->hard_limit && (arith_u64)lmo->primes[b] * lmo->primes[b] < high; ++b) {
+            if (b > unit->active) {
+                unit->active        = b;
+                unit->phi_counts[b] = unit->prime_count;
+            }
+
+            segment_count -= internal_lmo_cross_off(worker, low, bits, lmo->primes[b], true);
+            internal_lmo_hard_leaves(worker, unit, b, low, high);
+            unit->phi_counts[b] += segment_count;
+        }
+        for (; b <= lmo->a && (arith_u64)lmo->primes[b] * lmo->primes[b] < high; ++b)
+            internal_lmo_cross_off(worker, low, bits, lmo->primes[b], false);
+
+        worker->prefix[0] = 0;
+        for (arith_u64 w = 0; w < LMO_SEGMENT_WORDS; ++w)
+            worker->prefix[w + 1] = worker->prefix[w] + (arith_u32)__builtin_popcountll(worker->words[w]);
+
+        // The segment now holds the primes, with `1` in place of `2`, so `pi(z)` is a count for `z >= 2`. Easy leaves
+        // have `p < z < p^2` and hence `phi(z, b) = pi(z) - b + 1`.
+        for (b = 2; b < lmo->a; ++b) {
+            internal_lmo_leaves* leaves = &worker->easy[b];
+            const arith_u64 p           = lmo->primes[b + 1];
+            while (leaves->z < high) {
+                const arith_u64 pi = unit->prime_count + internal_lmo_count(worker, (leaves->z - low + 1) / 2);
+                const int mu       = internal_lmo_leaf_mu(lmo, leaves, p);
+                unit->sum -= mu * ((arith_i128)pi - (arith_i128)(b - 1));
+                unit->pi_coefficient -= mu;
+
+                --leaves->m;
+                internal_lmo_find_leaf(lmo, leaves, p);
+            }
+        }
+
+        for (; p2->p != 0 && x / p2->p < high; ++unit->p2_count) {
+            unit->sum -= unit->prime_count + internal_lmo_count(worker, (x / p2->p - low + 1) / 2);
+            if (!internal_lmo_next_p2(p2))
+                return false;
+        }
+
+        unit->prime_count += worker->prefix[LMO_SEGMENT_WORDS];
+    }
+
+    return true;
+}
+
+static void* internal_lmo_work(void* argument) {
+    internal_lmo_worker* worker = argument;
+    internal_lmo* lmo           = worker->shared;
+
+    for (;;) {
+        const arith_u64 unit = atomic_fetch_add(&lmo->next_unit, 1);
+        if (unit >= lmo->unit_count || atomic_load(&lmo->failed))
+            break;
+
+        if (!internal_lmo_process_unit(worker, unit)) {
+            atomic_store(&lmo->failed, true);
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static bool internal_lmo_init_worker(internal_lmo_worker* worker, internal_lmo* lmo) {
+    worker->shared    = lmo;
+    worker->words     = malloc(LMO_SEGMENT_WORDS * sizeof(*worker->words));
+    worker->counters  = malloc(LMO_BLOCK_COUNT * sizeof(*worker->counters));
+    worker->prefix    = malloc((LMO_SEGMENT_WORDS + 1) * sizeof(*worker->prefix));
+    worker->easy      = malloc((lmo->a + 1) * sizeof(*worker->easy));
+    worker->hard      = malloc((lmo->hard_limit + 1) * sizeof(*worker->hard));
+    worker->p2.primes = malloc(8 * SIEVE_SEGMENT_BYTES * sizeof(*worker->p2.primes));
+
+    return worker->words != NULL && worker->counters != NULL && worker->prefix != NULL && worker->easy != NULL
+        && worker->hard != NULL && worker->p2.primes != NULL;
+}
+
+static void internal_lmo_free_worker(internal_lmo_worker* worker) {
+    free(worker->words);
+    free(worker->counters);
+    free(worker->prefix);
+    free(worker->easy);
+    free(worker->hard);
+    free(worker->p2.primes);
+}
+
+// Computes the least prime factors and the Moebius function up to `y`, and the primes up to `y`. Returns `false` if
+// memory could not be allocated.
+static bool internal_lmo_init_tables(internal_lmo* lmo) {
+    const arith_u64 y  = lmo->y;
+    lmo->least_factors = calloc(y + 1, sizeof(*lmo->least_factors));
+    lmo->mu            = malloc((y + 1) * sizeof(*lmo->mu));
+    lmo->primes        = malloc((y / 2 + 2) * sizeof(*lmo->primes));
+    if (lmo->least_factors == NULL || lmo->mu == NULL || lmo->primes == NULL)
+        return false;
+
+    lmo->a         = 0;
+    lmo->primes[0] = 1;
+    for (arith_u64 n = 2; n <= y; ++n) {
+        if (lmo->least_factors[n] != 0)
+            continue;
+
+        lmo->primes[++lmo->a] = (arith_u32)n;
+        for (arith_u64 multiple = n; multiple <= y; multiple += n) {
+            if (lmo->least_factors[multiple] == 0)
+                lmo->least_factors[multiple] = (arith_u32)n;
+        }
+    }
+
+    lmo->least_factors[1] = ARITH_U32_MAX;
+    lmo->mu[1]            = 1;
+    for (arith_u64 m = 2; m <= y; ++m) {
+        const arith_u64 p        = lmo->least_factors[m];
+        const arith_u64 cofactor = m / p;
+        lmo->mu[m]               = (cofactor % p == 0) ? 0 : (signed char)-lmo->mu[cofactor];
+    }
+
+    return true;
+}
+
+// Returns `y`, the bound that balances the special leaves against P2.
+static arith_u64 internal_lmo_y(const arith_u64 x, const arith_u64 sqrt_x) {
+    // The sieve of the special leaves covers `[0, x / y]` and P2 takes `O(x / y)` time as well, while the number of
+    // special leaves grows with `y`. The factor `alpha` was tuned with bench_prime_count_u64. Since `y > cbrt(x)`, the
+    // primes up to `y` suffice to sieve `[0, x / y]`.
+    const double log_x      = log((double)x);
+    const double alpha      = LMO_ALPHA_SCALE * log_x * log_x * log_x;
+    const double y_estimate = alpha * cbrt((double)x);
+
+    arith_u64 y = (arith_u64)y_estimate;
+    if (y <= internal_icbrt_u64(x))
+        y = internal_icbrt_u64(x) + 1;
+    if (y > sqrt_x)
+        y = sqrt_x;
+
+    return y;
+}
+
+
+extern bool ARITHMOS_DISPATCHED(arith_prime_count_u64)(const arith_u64 x, unsigned thread_count,
+                                                       arith_u64* const count) {
+    // The Lagarias-Miller-Odlyzko method. With `a = pi(y)` for some `cbrt(x) <= y <= sqrt(x)`,
+    //     pi(x) = phi(x, a) + a - 1 - P2,
+    // where `phi(x, b)` counts the `n <= x` without prime factors among the first `b` primes `p_1, ..., p_b`, and P2
+    // counts the `n <= x` with exactly two prime factors above `p_a`, that is,
+    //     P2 = sum over y < p <= sqrt(x) of (pi(x / p) - pi(p) + 1).
+    //
+    // Applying `phi(z, b) = phi(z, b - 1) - phi(z / p_b, b - 1)` recursively gives
+    //     phi(x, a) = S1 + S2 = sum over m <= y of mu(m) * floor(x / m)
+    //               - sum over p = p_{b+1} <= y, y / p < m <= y, lpf(m) > p of mu(m) * phi(x / (p * m), b),
+    // where the terms of S2 are the special leaves. For `b = 0, 1` their value is direct. Leaves with
+    // `x / (p * m) < p` have value `1`, and those with `x / (p * m) < p^2` (easy leaves) have value `pi(z) - b + 1`.
+    // The remaining (hard) leaves take the values of phi() from a segmented sieve of `[0, x / y]`: after crossing off
+    // the multiples of `p_b` from `p_b^2` on, `phi(z, b) + b - 1` numbers up to `z` are left, which are counted with
+    // a counter per block of the segment, so that crossing off and counting both take little time. Once the sieve is
+    // complete, the segment gives `pi(z)` for the easy leaves and for P2.
+    //
+    // The segments are split into units, which threads take in increasing order. The counts up to the start of a unit
+    // are not known while it is processed, so a unit keeps the coefficients of these counts, and the units are
+    // combined in order at the end. The time is about `O(x^(2/3))` and the memory about `O(y)`.
+
+    if (x < LMO_SIEVE_BOUND)
+        return arith_sieve_count_range(0, x, thread_count, count);
+
+    if (thread_count == 0) {
+        const long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count         = (cpu_count > 0) ? (unsigned)cpu_count : 1;
+    }
+
+    internal_lmo lmo = {.x = x};
+    lmo.sqrt_x       = internal_isqrt_u64(x);
+    lmo.y            = internal_lmo_y(x, lmo.sqrt_x);
+    lmo.sqrt_y       = internal_isqrt_u64(lmo.y);
+    lmo.bound        = x / lmo.y;
+    atomic_init(&lmo.next_unit, 0);
+    atomic_init(&lmo.failed, false);
+
+    internal_lmo_worker* workers = NULL;
+    arith_u64* phi_totals        = NULL;
+    unsigned initialized         = 0;
+    bool success                 = false;
+    if (!internal_lmo_init_tables(&lmo))
+        goto cleanup;
+
+    lmo.hard_limit = 1;
+    while (lmo.hard_limit + 2 <= lmo.a
+           && (arith_u64)lmo.primes[lmo.hard_limit + 2] * lmo.primes[lmo.hard_limit + 2] <= lmo.bound)
+        ++lmo.hard_limit;
+
+    lmo.segment_count = lmo.bound / LMO_SEGMENT_SPAN + 1;
+    lmo.unit_segments = (lmo.segment_count + LMO_UNITS_PER_THREAD * thread_count - 1)
+                      / (LMO_UNITS_PER_THREAD * thread_count);
+    lmo.unit_count    = (lmo.segment_count + lmo.unit_segments - 1) / lmo.unit_segments;
+    if (thread_count > lmo.unit_count)
+        thread_count = (unsigned)lmo.unit_count;
+
+    lmo.units  = calloc(lmo.unit_count, sizeof(*lmo.units));
+    workers    = calloc(thread_count, sizeof(*workers));
+    phi_totals = calloc(lmo.hard_limit + 1, sizeof(*phi_totals));
+    if (lmo.units == NULL || workers == NULL || phi_totals == NULL)
+        goto cleanup;
+
+    for (arith_u64 i = 0; i < lmo.unit_count; ++i) {
+        lmo.units[i].phi_coefficients = calloc(lmo.hard_limit + 1, sizeof(*lmo.units[i].phi_coefficients));
+        lmo.units[i].phi_counts       = calloc(lmo.hard_limit + 1, sizeof(*lmo.units[i].phi_counts));
+        if (lmo.units[i].phi_coefficients == NULL || lmo.units[i].phi_counts == NULL)
+            goto cleanup;
+    }
+
+    for (; initialized < thread_count; ++initialized) {
+        if (!internal_lmo_init_worker(&workers[initialized], &lmo)) {
+            internal_lmo_free_worker(&workers[initialized]);
+            goto cleanup;
+        }
+    }
+
+    // The calling thread is the first worker.
+    unsigned started = 1;
+    for (; started < thread_count; ++started) {
+        if (pthread_create(&workers[started].thread, NULL, internal_lmo_work, &workers[started]) != 0)
+            break;
+    }
+    internal_lmo_work(&workers[0]);
+    for (unsigned i = 1; i < started; ++i)
+        pthread_join(workers[i].thread, NULL);
+
+    if (atomic_load(&lmo.failed))
+        goto cleanup;
+
+    // S1 and the special leaves of `p = 2, 3`, with `phi(z, 0) = z` and `phi(z, 1) = z - z / 2`.
+    arith_i128 sum = 0;
+    for (arith_u64 m = 1; m <= lmo.y; ++m)
+        sum += lmo.mu[m] * (arith_i128)(x / m);
+    for (arith_u64 b = 0; b < 2; ++b) {
+        const arith_u64 p = lmo.primes[b + 1];
+        for (arith_u64 m = lmo.y / p + 1; m <= lmo.y; ++m) {
+            if (lmo.mu[m] != 0 && lmo.least_factors[m] > p) {
+                const arith_u64 z = x / (p * m);
+                sum -= lmo.mu[m] * (arith_i128)((b == 0) ? z : z - z / 2);
+            }
+        }
+    }
+
+    // The leaves `(p, q)` of `p > sqrt(y)` with `x / (p * q) < p`, that is, `q > x / p^2`, have value `1`.
+    for (arith_u64 b = 2; b < lmo.a; ++b) {
+        const arith_u64 p = lmo.primes[b + 1];
+        if (p > lmo.sqrt_y) {
+            const arith_u64 lower = (x / p / p > p) ? x / p / p : p;
+            if (lower < lmo.y)
+                sum += (arith_i128)(lmo.a - internal_lmo_small_pi(&lmo, lower));
+        }
+    }
+
+    // Resolves the counts below every unit, and subtracts `sum over a < k <= pi(sqrt(x)) of (k - 1)` from P2.
+    arith_u64 prime_total = 0;
+    arith_u64 p2_count    = 0;
+    for (arith_u64 i = 0; i < lmo.unit_count; ++i) {
+        const internal_lmo_unit* unit = &lmo.units[i];
+
+        sum += unit->sum + unit->pi_coefficient * (arith_i128)prime_total;
+        sum -= (arith_i128)unit->p2_count * prime_total;
+        for (arith_u64 b = 2; b <= lmo.hard_limit; ++b) {
+            sum += unit->phi_coefficients[b] * (arith_i128)phi_totals[b];
+            phi_totals[b] += (b <= unit->active) ? unit->phi_counts[b] : unit->prime_count;
+        }
+
+        prime_total += unit->prime_count;
+        p2_count += unit->p2_count;
+    }
+
+    const arith_u64 c = lmo.a + p2_count;
+    sum += (arith_i128)c * (c - 1) / 2 - (arith_i128)lmo.a * (lmo.a - 1) / 2;
+
+    *count  = (arith_u64)(sum + lmo.a - 1);
+    success = true;
+
+cleanup:
+    for (unsigned i = 0; i < initialized; ++i)
+        internal_lmo_free_worker(&workers[i]);
+    for (arith_u64 i = 0; lmo.units != NULL && i < lmo.unit_count; ++i) {
+        free(lmo.units[i].phi_coefficients);
+        free(lmo.units[i].phi_counts);
+    }
+    free(lmo.units);
+    free(workers);
+    free(phi_totals);
+    free(lmo.least_factors);
+    free(lmo.mu);
+    free(lmo.primes);
+
+    return success;
+}
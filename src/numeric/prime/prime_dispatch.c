@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_is_prime_u32, (const arith_u32 n));
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_is_prime_u64, (const arith_u64 n));
+
+ARITHMOS_DEFINE_DISPATCHER(unsigned, arith_factor_u64, (arith_u64 n, arith_u64* primes, unsigned* exponents));
+
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_prime_count_u64, (arith_u64 x, unsigned thread_count, arith_u64* count));
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_PRIME_INTERNAL_H_
+#define ARITHMOS_NUMERIC_PRIME_INTERNAL_H_
+
+
+#include "arithmos/core/types.h"
+
+
+
+#define TRIAL_DIVISOR_COUNT_U64 30
+
+// Every `n` without prime factors below 128 that is smaller than `TRIAL_DIVISION_BOUND_U64` is prime.
+#define TRIAL_DIVISION_BOUND_U64 (131 * 131)
+
+// The odd primes below 128. `n` is divisible by `p` if and only if `n * p^-1 (mod 2^64) <= floor((2^64 - 1) / p)`, in
+// which case `n / p = n * p^-1 (mod 2^64)`.
+static const struct {
+    arith_u64 prime;    // `p`.
+    arith_u64 inverse;  // `p^-1 (mod 2^64)`.
+    arith_u64 limit;    // `floor((2^64 - 1) / p)`.
+} trial_divisors_u64[TRIAL_DIVISOR_COUNT_U64] = {
+    {3, 0xAAAAAAAAAAAAAAAB, 0x5555555555555555},
+    {5, 0xCCCCCCCCCCCCCCCD, 0x3333333333333333},
+    {7, 0x6DB6DB6DB6DB6DB7, 0x2492492492492492},
+    {11, 0x2E8BA2E8BA2E8BA3, 0x1745D1745D1745D1},
+    {13, 0x4EC4EC4EC4EC4EC5, 0x13B13B13B13B13B1},
+    {17, 0xF0F0F0F0F0F0F0F1, 0x0F0F0F0F0F0F0F0F},
+    {19, 0x86BCA1AF286BCA1B, 0x0D79435E50D79435},
+    {23, 0xD37A6F4DE9BD37A7, 0x0B21642C8590B216},
+    {29, 0x34F72C234F72C235, 0x08D3DCB08D3DCB08},
+    {31, 0xEF7BDEF7BDEF7BDF, 0x0842108421084210},
+    {37, 0x14C1BACF914C1BAD, 0x06EB3E45306EB3E4},
+    {41, 0x8F9C18F9C18F9C19, 0x063E7063E7063E70},
+    {43, 0x82FA0BE82FA0BE83, 0x05F417D05F417D05},
+    {47, 0x51B3BEA3677D46CF, 0x0572620AE4C415C9},
+    {53, 0x21CFB2B78C13521D, 0x04D4873ECADE304D},
+    {59, 0xCBEEA4E1A08AD8F3, 0x0456C797DD49C341},
+    {61, 0x4FBCDA3AC10C9715, 0x04325C53EF368EB0},
+    {67, 0xF0B7672A07A44C6B, 0x03D226357E16ECE5},
+    {71, 0x193D4BB7E327A977, 0x039B0AD12073615A},
+    {73, 0x7E3F1F8FC7E3F1F9, 0x0381C0E070381C0E},
+    {79, 0x9B8B577E613716AF, 0x033D91D2A2067B23},
+    {83, 0xA3784A062B2E43DB, 0x03159721ED7E7534},
+    {89, 0xF47E8FD1FA3F47E9, 0x02E05C0B81702E05},
+    {97, 0xA3A0FD5C5F02A3A1, 0x02A3A0FD5C5F02A3},
+    {101, 0x3A4C0A237C32B16D, 0x0288DF0CAC5B3F5D},
+    {103, 0xDAB7EC1DD3431B57, 0x027C45979C95204F},
+    {107, 0x77A04C8F8D28AC43, 0x02647C69456217EC},
+    {109, 0xA6C0964FDA6C0965, 0x02593F69B02593F6},
+    {113, 0x90FDBC090FDBC091, 0x0243F6F0243F6F02},
+    {127, 0x7EFDFBF7EFDFBF7F, 0x0204081020408102},
+};
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_PRIME_INTERNAL_H_
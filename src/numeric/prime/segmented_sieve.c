@@ -0,0 +1,491 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "numeric/prime/sieve_internal.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+// Bucket entries keep the byte offset of the next multiple in the low bits of `position` and the wheel index above.
+#define SIEVE_WHEEL_SHIFT    26
+#define SIEVE_POSITION_MASK  ((1U << SIEVE_WHEEL_SHIFT) - 1)
+#define SIEVE_SMALL_CAPACITY 256
+#define SIEVE_FIRST_PRIME    17  // The first prime that is sieved rather than presieved.
+
+
+// The multiples `p * q` of a sieving prime `p = 30 * quotient + r`, with `q` coprime to 30, are crossed off by walking
+// through the residues of `q` modulo 30. Entry `8 * class(r) + class(q mod 30)` holds the bit of `p * q` in its byte,
+// and the step to the next such multiple `p * (q + delta)`: its byte is `quotient * delta + correction` bytes further,
+// where `correction` is the carry of `r * delta` into the byte. `next` is the entry of `q + delta`.
+static const struct {
+    unsigned char mask;
+    unsigned char delta;
+    unsigned char correction;
+    unsigned char next;
+} sieve_wheel[64] = {
+    {0x01, 6, 0, 1},  {0x02, 4, 0, 2},  {0x04, 2, 0, 3},  {0x08, 4, 0, 4},  {0x10, 2, 0, 5},  {0x20, 4, 0, 6},
+    {0x40, 6, 0, 7},  {0x80, 2, 1, 0},  {0x02, 6, 1, 9},  {0x20, 4, 1, 10}, {0x10, 2, 1, 11}, {0x01, 4, 0, 12},
+    {0x80, 2, 1, 13}, {0x08, 4, 1, 14}, {0x04, 6, 1, 15}, {0x40, 2, 1, 8},  {0x04, 6, 2, 17}, {0x10, 4, 2, 18},
+    {0x01, 2, 0, 19}, {0x40, 4, 2, 20}, {0x02, 2, 0, 21}, {0x80, 4, 2, 22}, {0x08, 6, 2, 23}, {0x20, 2, 1, 16},
+    {0x08, 6, 3, 25}, {0x01, 4, 1, 26}, {0x40, 2, 1, 27}, {0x20, 4, 2, 28}, {0x04, 2, 1, 29}, {0x02, 4, 1, 30},
+    {0x80, 6, 3, 31}, {0x10, 2, 1, 24}, {0x10, 6, 3, 33}, {0x80, 4, 3, 34}, {0x02, 2, 1, 35}, {0x04, 4, 2, 36},
+    {0x20, 2, 1, 37}, {0x40, 4, 3, 38}, {0x01, 6, 3, 39}, {0x08, 2, 1, 32}, {0x20, 6, 4, 41}, {0x08, 4, 2, 42},
+    {0x80, 2, 2, 43}, {0x02, 4, 2, 44}, {0x40, 2, 2, 45}, {0x01, 4, 2, 46}, {0x10, 6, 4, 47}, {0x04, 2, 1, 40},
+    {0x40, 6, 5, 49}, {0x04, 4, 3, 50}, {0x08, 2, 1, 51}, {0x80, 4, 4, 52}, {0x01, 2, 1, 53}, {0x10, 4, 3, 54},
+    {0x20, 6, 5, 55}, {0x02, 2, 1, 48}, {0x80, 6, 6, 57}, {0x40, 4, 4, 58}, {0x20, 2, 2, 59}, {0x10, 4, 4, 60},
+    {0x08, 2, 2, 61}, {0x04, 4, 4, 62}, {0x02, 6, 6, 63}, {0x01, 2, 1, 56},
+};
+
+// The distance from `r` to the next residue coprime to 30, for `0 <= r < 30`.
+static const unsigned char sieve_next_coprime[30] = {
+    1, 0, 5, 4, 3, 2, 1, 0, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0, 1, 0, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0,
+};
+
+// The index of `r` among the residues coprime to 30, for the `r` coprime to 30.
+static const unsigned char sieve_class[30] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0, 0, 0, 4, 0, 5, 0, 0, 0, 6, 0, 0, 0, 0, 0, 7,
+};
+
+
+// Returns a bucket block from the free list, or a newly allocated one, or `NULL` if allocation fails.
+static internal_bucket_block* internal_sieve_allocate_block(internal_sieve* sieve) {
+    internal_bucket_block* block = sieve->free_blocks;
+    if (block != NULL)
+        sieve->free_blocks = block->next;
+    else
+        block = malloc(sizeof(*block));
+
+    return block;
+}
+
+// Appends a large sieving prime to the bucket of segment `target`.
+static INLINE void internal_sieve_push_bucket(internal_sieve* sieve, const arith_u64 target, const arith_u32 quotient,
+                                              const arith_u32 position) {
+    internal_bucket_block** bucket = &sieve->buckets[target % sieve->bucket_count];
+    internal_bucket_block* block   = *bucket;
+
+    if (block == NULL || block->count == SIEVE_BUCKET_BLOCK_ENTRIES) {
+        internal_bucket_block* new_block = internal_sieve_allocate_block(sieve);
+        if (new_block == NULL) {
+            sieve->failed = true;
+            return;
+        }
+
+        new_block->next  = block;
+        new_block->count = 0;
+        *bucket          = new_block;
+        block            = new_block;
+    }
+
+    block->entries[block->count++] = (internal_bucket_entry){.quotient = quotient, .position = position};
+}
+
+// Adds the sieving prime `p`, whose square is below the end of the current segment, at its first multiple that is in
+// the current segment or later and not below `p^2`.
+static void internal_sieve_add_sieving_prime(internal_sieve* sieve, const arith_u64 p) {
+    // Smaller multiples of p have a smaller prime factor, and are crossed off by that one.
+    arith_u64 q = p;
+    if (p * p < sieve->low)
+        q = (sieve->low - 1) / p + 1;
+    q += sieve_next_coprime[q % 30];
+
+    if ((arith_u128)p * q > sieve->hi)
+        return;
+
+    const arith_u64 offset = (p * q - sieve->low) / 30;
+    const arith_u32 wheel  = 8U * sieve_class[p % 30] + sieve_class[q % 30];
+
+    if (p < SIEVE_SMALL_PRIME_LIMIT) {
+        if (sieve->small_prime_count == sieve->small_prime_capacity) {
+            const size_t capacity = 2 * sieve->small_prime_capacity;
+            internal_small_sieving_prime* small_primes =
+            realloc(sieve->small_primes, capacity * sizeof(*small_primes));
+            if (small_primes == NULL) {
+                sieve->failed = true;
+                return;
+            }
+
+            sieve->small_primes         = small_primes;
+            sieve->small_prime_capacity = capacity;
+        }
+
+        sieve->small_primes[sieve->small_prime_count++] = (internal_small_sieving_prime){
+            .quotient = (arith_u32)(p / 30),
+            .position = (arith_u32)offset,
+            .wheel    = wheel,
+        };
+    } else {
+        const arith_u64 target = sieve->segment_index + offset / SIEVE_SEGMENT_BYTES;
+        if (target < sieve->segment_count) {
+            internal_sieve_push_bucket(sieve, target, (arith_u32)(p / 30),
+                                       (arith_u32)(offset % SIEVE_SEGMENT_BYTES) | (wheel << SIEVE_WHEEL_SHIFT));
+        }
+    }
+}
+
+// Fills the current segment with the presieve pattern, in which the multiples of 7, 11 and 13 are crossed off.
+static void internal_sieve_presieve(internal_sieve* sieve) {
+    size_t phase = (size_t)((sieve->low / 30) % SIEVE_PRESIEVE_BYTES);
+
+    for (size_t i = 0; i < sieve->size;) {
+        const size_t length = (SIEVE_PRESIEVE_BYTES - phase < sieve->size - i) ? SIEVE_PRESIEVE_BYTES - phase
+                                                                              : sieve->size - i;
+        memcpy(sieve->segment + i, sieve->presieve + phase, length);
+        i     += length;
+        phase  = 0;
+    }
+
+    // 1 is not prime, while 7, 11 and 13 are, but were crossed off as multiples of themselves.
+    if (sieve->low == 0)
+        sieve->segment[0] = (unsigned char)((sieve->segment[0] & ~0x01) | 0x02 | 0x04 | 0x08);
+}
+
+// Crosses off the multiples of the small sieving primes in the current segment.
+static void internal_sieve_small_primes(internal_sieve* sieve) {
+    unsigned char* const segment = sieve->segment;
+    const size_t size            = sieve->size;
+
+    for (size_t i = 0; i < sieve->small_prime_count; ++i) {
+        internal_small_sieving_prime* prime = &sieve->small_primes[i];
+        const arith_u32 quotient            = prime->quotient;
+        arith_u32 position                  = prime->position;
+        arith_u32 wheel                     = prime->wheel;
+
+        // The multiples p * q, ..., p * (q + 29) with q coprime to 30 are at the same 8 offsets from the byte of
+        // p * q for every cycle of the wheel, and the next cycle starts p bytes further. Hence whole cycles are crossed
+        // off with fixed offsets and masks, and only the remainder walks through the wheel one multiple at a time.
+        const arith_u32 p = 30 * quotient + sieve_residues[wheel >> 3];
+        if (position + p <= size) {
+            arith_u32 offsets[8];
+            unsigned char masks[8];
+            arith_u32 offset = 0;
+            arith_u32 w      = wheel;
+            for (unsigned k = 0; k < 8; ++k) {
+                offsets[k]  = offset;
+                masks[k]    = (unsigned char)~sieve_wheel[w].mask;
+                offset     += quotient * sieve_wheel[w].delta + sieve_wheel[w].correction;
+                w           = sieve_wheel[w].next;
+            }
+
+            for (; position + p <= size; position += p) {
+                unsigned char* const cycle  = segment + position;
+                cycle[offsets[0]]          &= masks[0];
+                cycle[offsets[1]]          &= masks[1];
+                cycle[offsets[2]]          &= masks[2];
+                cycle[offsets[3]]          &= masks[3];
+                cycle[offsets[4]]          &= masks[4];
+                cycle[offsets[5]]          &= masks[5];
+                cycle[offsets[6]]          &= masks[6];
+                cycle[offsets[7]]          &= masks[7];
+            }
+        }
+
+        while (position < size) {
+            segment[position] &= (unsigned char)~sieve_wheel[wheel].mask;
+            position          += quotient * sieve_wheel[wheel].delta + sieve_wheel[wheel].correction;
+            wheel              = sieve_wheel[wheel].next;
+        }
+
+        prime->position = position - SIEVE_SEGMENT_BYTES;
+        prime->wheel    = wheel;
+    }
+}
+
+// Crosses off the multiples of the large sieving primes in the current segment, and moves each prime to the bucket of
+// the segment of its next multiple.
+static void internal_sieve_large_primes(internal_sieve* sieve) {
+    unsigned char* const segment = sieve->segment;
+    const size_t size            = sieve->size;
+    const bool is_last           = sieve->segment_index + 1 == sieve->segment_count;
+
+    internal_bucket_block** bucket = &sieve->buckets[sieve->segment_index % sieve->bucket_count];
+    internal_bucket_block* block   = *bucket;
+    *bucket                        = NULL;
+
+    while (block != NULL) {
+        for (arith_u32 i = 0; i < block->count; ++i) {
+            const arith_u32 quotient = block->entries[i].quotient;
+            arith_u32 position       = block->entries[i].position & SIEVE_POSITION_MASK;
+            arith_u32 wheel          = block->entries[i].position >> SIEVE_WHEEL_SHIFT;
+
+            while (position < size) {
+                segment[position] &= (unsigned char)~sieve_wheel[wheel].mask;
+                position          += quotient * sieve_wheel[wheel].delta + sieve_wheel[wheel].correction;
+                wheel              = sieve_wheel[wheel].next;
+            }
+
+            // Only the last segment is shorter than SIEVE_SEGMENT_BYTES, so position is in a later segment.
+            if (!is_last) {
+                const arith_u64 target = sieve->segment_index + position / SIEVE_SEGMENT_BYTES;
+                if (target < sieve->segment_count) {
+                    internal_sieve_push_bucket(sieve, target, quotient,
+                                               (position % SIEVE_SEGMENT_BYTES) | (wheel << SIEVE_WHEEL_SHIFT));
+                }
+            }
+        }
+
+        internal_bucket_block* const next = block->next;
+        block->next                       = sieve->free_blocks;
+        sieve->free_blocks                = block;
+        block                             = next;
+    }
+}
+
+// Moves a sieving prime whose next multiple is `behind` bytes before the start of a segment to its first multiple in
+// that segment or later, and returns the byte of that multiple relative to the start of the segment.
+static INLINE arith_u64 internal_sieve_skip(const arith_u32 quotient, arith_u32* wheel, const arith_u64 behind) {
+    // The multiples p * q and p * (q + 30) are p bytes apart and have the same wheel index, so the whole wheel cycles
+    // are skipped with a single division, and less than one cycle is walked.
+    const arith_u64 p = 30 * (arith_u64)quotient + sieve_residues[*wheel >> 3];
+
+    for (arith_u64 rest = behind % p; rest > 0;) {
+        const arith_u32 step = quotient * sieve_wheel[*wheel].delta + sieve_wheel[*wheel].correction;
+        *wheel               = sieve_wheel[*wheel].next;
+        if (step >= rest)
+            return step - rest;
+        rest -= step;
+    }
+
+    return 0;
+}
+
+// Clears the bits of the current segment that lie outside `[lo, hi]`, and the padding bytes.
+static void internal_sieve_mask_edges(internal_sieve* sieve) {
+    if (sieve->segment_index == 0) {
+        for (unsigned k = 0; k < 8 && sieve->low + sieve_residues[k] < sieve->lo; ++k)
+            sieve->segment[0] &= (unsigned char)~(1U << k);
+    }
+
+    if (sieve->segment_index + 1 == sieve->segment_count) {
+        const arith_u64 last = sieve->low + 30 * (arith_u64)(sieve->size - 1);
+        for (unsigned k = 8; k-- > 0 && sieve->hi - last < sieve_residues[k];)
+            sieve->segment[sieve->size - 1] &= (unsigned char)~(1U << k);
+
+        memset(sieve->segment + sieve->size, 0, ((sieve->size + 7) & ~(size_t)7) - sieve->size);
+    }
+}
+
+
+extern bool internal_sieve_init(internal_sieve* sieve, const arith_u64 lo, const arith_u64 hi) {
+    memset(sieve, 0, sizeof(*sieve));
+    sieve->lo  = lo;
+    sieve->hi  = hi;
+    sieve->low = lo - lo % 30;
+
+    // 2, 3 and 5 are not represented, and 1 is cleared, so there is nothing to sieve below 7.
+    if (hi < lo || hi < 7)
+        return true;
+
+    sieve->segment_count = (hi - sieve->low) / SIEVE_SEGMENT_SPAN + 1;
+    sieve->segment       = malloc(SIEVE_SEGMENT_BYTES);
+    sieve->sqrt_hi       = internal_isqrt_u64(hi);
+    if (sieve->segment == NULL)
+        goto fail;
+
+    for (size_t i = 0; i < SIEVE_PRESIEVE_BYTES; ++i) {
+        unsigned char byte = 0;
+        for (unsigned k = 0; k < 8; ++k) {
+            const arith_u64 n = 30 * (arith_u64)i + sieve_residues[k];
+            if (n % 7 != 0 && n % 11 != 0 && n % 13 != 0)
+                byte |= (unsigned char)(1U << k);
+        }
+        sieve->presieve[i] = byte;
+    }
+
+    if (sieve->sqrt_hi >= SIEVE_FIRST_PRIME) {
+        sieve->small_primes = malloc(SIEVE_SMALL_CAPACITY * sizeof(*sieve->small_primes));
+        sieve->source       = malloc(sizeof(*sieve->source));
+        if (sieve->small_primes == NULL || sieve->source == NULL) {
+            free(sieve->source);
+            sieve->source = NULL;
+            goto fail;
+        }
+        sieve->small_prime_capacity = SIEVE_SMALL_CAPACITY;
+
+        if (!internal_sieve_init(sieve->source, SIEVE_FIRST_PRIME, sieve->sqrt_hi)) {
+            free(sieve->source);
+            sieve->source = NULL;
+            goto fail;
+        }
+        sieve->next_sieving_prime = internal_sieve_next_prime(sieve->source);
+    }
+
+    if (sieve->sqrt_hi >= SIEVE_SMALL_PRIME_LIMIT) {
+        // A large sieving prime p advances by at most 6 * floor(p / 30) + 6 bytes per multiple, so its next multiple
+        // is in one of the next few segments.
+        sieve->bucket_count = (size_t)((6 * (sieve->sqrt_hi / 30) + 6) / SIEVE_SEGMENT_BYTES) + 2;
+        sieve->buckets      = calloc(sieve->bucket_count, sizeof(*sieve->buckets));
+        if (sieve->buckets == NULL)
+            goto fail;
+    }
+
+    return true;
+
+fail:
+    internal_sieve_free(sieve);
+    return false;
+}
+
+extern void internal_sieve_free(internal_sieve* sieve) {
+    for (size_t i = 0; i < sieve->bucket_count && sieve->buckets != NULL; ++i) {
+        while (sieve->buckets[i] != NULL) {
+            internal_bucket_block* const next = sieve->buckets[i]->next;
+            free(sieve->buckets[i]);
+            sieve->buckets[i] = next;
+        }
+    }
+    while (sieve->free_blocks != NULL) {
+        internal_bucket_block* const next = sieve->free_blocks->next;
+        free(sieve->free_blocks);
+        sieve->free_blocks = next;
+    }
+
+    if (sieve->source != NULL) {
+        internal_sieve_free(sieve->source);
+        free(sieve->source);
+    }
+
+    free(sieve->buckets);
+    free(sieve->small_primes);
+    free(sieve->segment);
+    memset(sieve, 0, sizeof(*sieve));
+}
+
+extern bool internal_sieve_next_segment(internal_sieve* sieve) {
+    if (sieve->failed)
+        return false;
+
+    if (sieve->started) {
+        ++sieve->segment_index;
+        sieve->low += SIEVE_SEGMENT_SPAN;
+    }
+    sieve->started = true;
+
+    if (sieve->segment_index >= sieve->segment_count)
+        return false;
+
+    const arith_u64 remaining = sieve->hi - sieve->low;
+    sieve->size = (remaining >= SIEVE_SEGMENT_SPAN) ? SIEVE_SEGMENT_BYTES : (size_t)(remaining / 30) + 1;
+
+    // Add the sieving primes whose squares are in this segment, in which case their first multiple to cross off is
+    // their square. The ones whose squares are below the first segment are added before it.
+    while (sieve->next_sieving_prime != 0) {
+        const arith_u64 square = sieve->next_sieving_prime * sieve->next_sieving_prime;
+        if (square >= sieve->low && square - sieve->low >= SIEVE_SEGMENT_SPAN)
+            break;
+
+        internal_sieve_add_sieving_prime(sieve, sieve->next_sieving_prime);
+        sieve->next_sieving_prime = internal_sieve_next_prime(sieve->source);
+    }
+    if (sieve->source != NULL && sieve->source->failed)
+        sieve->failed = true;
+
+    internal_sieve_presieve(sieve);
+    internal_sieve_small_primes(sieve);
+    if (sieve->buckets != NULL)
+        internal_sieve_large_primes(sieve);
+    internal_sieve_mask_edges(sieve);
+
+    return !sieve->failed;
+}
+
+extern bool internal_sieve_seek(internal_sieve* sieve, const arith_u64 segment_index) {
+    const arith_u64 next = sieve->segment_index + (sieve->started ? 1 : 0);
+    if (sieve->failed || segment_index <= next)
+        return !sieve->failed;
+
+    if (segment_index >= sieve->segment_count) {
+        sieve->segment_index = sieve->segment_count;
+        sieve->started       = false;
+        return true;
+    }
+
+    const arith_u64 distance = (segment_index - next) * SIEVE_SEGMENT_BYTES;
+
+    for (size_t i = 0; i < sieve->small_prime_count; ++i) {
+        internal_small_sieving_prime* prime = &sieve->small_primes[i];
+        prime->position = (arith_u32)internal_sieve_skip(prime->quotient, &prime->wheel, distance - prime->position);
+    }
+
+    if (sieve->buckets != NULL) {
+        // The buckets of the skipped segments are detached first, since the primes moved out of them may go to the
+        // same slots of the ring.
+        const size_t skipped_count = (segment_index - next < sieve->bucket_count) ? (size_t)(segment_index - next)
+                                                                                  : sieve->bucket_count;
+        internal_bucket_block** skipped = malloc(skipped_count * sizeof(*skipped));
+        if (skipped == NULL) {
+            sieve->failed = true;
+            return false;
+        }
+
+        for (size_t i = 0; i < skipped_count; ++i) {
+            const size_t slot    = (size_t)((next + i) % sieve->bucket_count);
+            skipped[i]           = sieve->buckets[slot];
+            sieve->buckets[slot] = NULL;
+        }
+
+        for (size_t i = 0; i < skipped_count; ++i) {
+            for (internal_bucket_block* block = skipped[i]; block != NULL;) {
+                for (arith_u32 j = 0; j < block->count; ++j) {
+                    const arith_u32 quotient = block->entries[j].quotient;
+                    const arith_u32 offset   = block->entries[j].position & SIEVE_POSITION_MASK;
+                    arith_u32 wheel          = block->entries[j].position >> SIEVE_WHEEL_SHIFT;
+
+                    // The byte of the next multiple, counted from the start of the first skipped segment.
+                    const arith_u64 byte = i * SIEVE_SEGMENT_BYTES + offset;
+
+                    const arith_u64 position = internal_sieve_skip(quotient, &wheel, distance - byte);
+                    const arith_u64 target   = segment_index + position / SIEVE_SEGMENT_BYTES;
+                    if (target < sieve->segment_count) {
+                        internal_sieve_push_bucket(sieve, target, quotient,
+                                                   (arith_u32)(position % SIEVE_SEGMENT_BYTES)
+                                                 | (wheel << SIEVE_WHEEL_SHIFT));
+                    }
+                }
+
+                internal_bucket_block* const next_block = block->next;
+                block->next                             = sieve->free_blocks;
+                sieve->free_blocks                      = block;
+                block                                   = next_block;
+            }
+        }
+
+        free(skipped);
+    }
+
+    sieve->low           += (sieve->started ? SIEVE_SEGMENT_SPAN : 0) + (segment_index - next) * SIEVE_SEGMENT_SPAN;
+    sieve->segment_index  = segment_index;
+    sieve->started        = false;
+    sieve->size           = 0;
+    sieve->scan_position  = 0;
+    sieve->scan_word      = 0;
+
+    return !sieve->failed;
+}
+
+extern arith_u64 internal_sieve_next_prime(internal_sieve* sieve) {
+    while (sieve->scan_word == 0) {
+        if (sieve->scan_position < sieve->size) {
+            memcpy(&sieve->scan_word, sieve->segment + sieve->scan_position, sizeof(sieve->scan_word));
+            sieve->scan_position += 8;
+        } else {
+            if (!internal_sieve_next_segment(sieve))
+                return 0;
+            sieve->scan_position = 0;
+        }
+    }
+
+    const unsigned bit  = internal_bsf_u64(sieve->scan_word);
+    sieve->scan_word   &= sieve->scan_word - 1;
+
+    return internal_sieve_number(sieve, 8 * (sieve->scan_position - 8) + bit);
+}
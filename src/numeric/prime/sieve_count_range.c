@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+
+#include "numeric/prime/sieve_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_sieve_count_range(const arith_u64 lo, const arith_u64 hi, const unsigned thread_count,
+                                    arith_u64* const count) {
+    // See parallel_sieve.c for implementation details. The wheel does not represent 2, 3 and 5, so these are counted
+    // separately.
+
+    arith_u64 small_count = 0;
+    for (arith_u64 p = 2; p <= 5; p += (p == 2) ? 1 : 2)
+        small_count += (lo <= p && p <= hi) ? 1 : 0;
+
+    *count = small_count;
+    if (hi < 7 || hi < lo)
+        return true;
+
+    arith_u64 sieved_count = 0;
+    if (!internal_sieve_parallel(lo, hi, thread_count, NULL, NULL, &sieved_count))
+        return false;
+
+    *count += sieved_count;
+    return true;
+}
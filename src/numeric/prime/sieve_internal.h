@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_SIEVE_INTERNAL_H_
+#define ARITHMOS_NUMERIC_SIEVE_INTERNAL_H_
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "inline.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+
+
+// The segmented sieve of Eratosthenes behind arith_sieve_range() and the other prime enumeration functions.
+//
+// Numbers are stored in a mod 30 wheel: byte `i` of a segment starting at `low` (a multiple of 30) holds the numbers
+// `low + 30 * i + r` for the 8 residues `r` coprime to 30, so a byte covers 30 numbers and multiples of 2, 3 and 5
+// take no space. A segment of `SIEVE_SEGMENT_BYTES` bytes fits into the L1 data cache of current CPUs.
+//
+// Sieving primes are split by size. Small ones hit every segment many times and keep their next multiple in an array.
+// Large ones hit a segment at most a few times, so they are kept in buckets: the bucket of a future segment holds the
+// primes whose next multiple lies in that segment, and no time is spent on primes that miss a segment. Sieving primes
+// are added only once the segments reach their squares, and are produced on the fly by a nested sieve up to
+// `sqrt(hi)`. Hence the memory used is bounded by a few segments plus the sieving primes up to `sqrt(hi)` whose next
+// multiple is at most `hi`, independent of the length of the range.
+
+
+#define SIEVE_SEGMENT_BYTES 32768
+
+// The number of integers covered by a segment.
+#define SIEVE_SEGMENT_SPAN ((arith_u64)30 * SIEVE_SEGMENT_BYTES)
+
+// The multiples of 7, 11 and 13 are not sieved but copied from a pattern, which repeats every 7 * 11 * 13 bytes.
+#define SIEVE_PRESIEVE_BYTES (7 * 11 * 13)
+
+// Sieving primes below this bound advance by less than a segment per multiple, and are kept in an array.
+#define SIEVE_SMALL_PRIME_LIMIT (5 * SIEVE_SEGMENT_BYTES)
+
+#define SIEVE_BUCKET_BLOCK_ENTRIES 1022
+
+
+// A sieving prime `p = 30 * quotient + r` whose next multiple `p * q` is in byte `position`, relative to the current
+// segment for small primes and to the segment of its bucket for large ones. `wheel` is `8 * class(r) + class(q)`,
+// where `class()` is the index among the residues coprime to 30.
+typedef struct internal_small_sieving_prime {
+    arith_u32 quotient;
+    arith_u32 position;
+    arith_u32 wheel;
+} internal_small_sieving_prime;
+
+// As `internal_small_sieving_prime`, with the wheel index in the top 6 bits of `position`.
+typedef struct internal_bucket_entry {
+    arith_u32 quotient;
+    arith_u32 position;
+} internal_bucket_entry;
+
+typedef struct internal_bucket_block {
+    struct internal_bucket_block* next;
+    arith_u32 count;
+    internal_bucket_entry entries[SIEVE_BUCKET_BLOCK_ENTRIES];
+} internal_bucket_block;
+
+typedef struct internal_sieve {
+    arith_u64 lo;  // The range `[lo, hi]` to sieve.
+    arith_u64 hi;
+
+    arith_u64 low;            // The first number of the current segment, a multiple of 30.
+    arith_u64 segment_index;  // The index of the current segment, counted from the first one.
+    arith_u64 segment_count;  // The number of segments of the range.
+    size_t size;              // The number of bytes of the current segment that lie in the range.
+    unsigned char* segment;   // The current segment, padded with `0`-bytes to a multiple of 8 bytes.
+    unsigned char presieve[SIEVE_PRESIEVE_BYTES];
+
+    internal_small_sieving_prime* small_primes;
+    size_t small_prime_count;
+    size_t small_prime_capacity;
+
+    internal_bucket_block** buckets;  // A ring of buckets, indexed by segment index modulo `bucket_count`.
+    size_t bucket_count;
+    internal_bucket_block* free_blocks;
+
+    struct internal_sieve* source;  // The sieve of the sieving primes, or `NULL` if there are none.
+    arith_u64 sqrt_hi;
+    arith_u64 next_sieving_prime;  // The next sieving prime from `source` that is not added yet, or `0`.
+
+    size_t scan_position;  // The state of internal_sieve_next_prime() in the current segment.
+    arith_u64 scan_word;
+
+    bool started;
+    bool failed;  // Set if memory could not be allocated while sieving, which ends the range early.
+} internal_sieve;
+
+
+// The residues coprime to 30, in increasing order.
+static const unsigned char sieve_residues[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+
+// Initializes `sieve` for the primes `p` with `lo <= p <= hi`, except 2, 3 and 5, which the wheel does not represent.
+// Returns `false` if memory could not be allocated, in which case `sieve` must not be used and needs no freeing.
+__attribute__((visibility("hidden"))) bool internal_sieve_init(internal_sieve* sieve, arith_u64 lo, arith_u64 hi);
+
+// Frees the memory held by `sieve`.
+__attribute__((visibility("hidden"))) void internal_sieve_free(internal_sieve* sieve);
+
+// Sieves the next segment of the range, and returns `false` if there is none or memory could not be allocated (see
+// `failed`). The set bits of the first `size` bytes of `segment` are then exactly the primes of the range in the
+// segment, and the padding bytes up to the next multiple of 8 are `0`.
+__attribute__((visibility("hidden"))) bool internal_sieve_next_segment(internal_sieve* sieve);
+
+// Skips the segments before `segment_index`, so that internal_sieve_next_segment() sieves that one next, and returns
+// `false` if memory could not be allocated. The sieving primes are moved to their first multiples in that segment or
+// later, at the cost of a division each. If `segment_index` is not after the current segment, does nothing.
+__attribute__((visibility("hidden"))) bool internal_sieve_seek(internal_sieve* sieve, arith_u64 segment_index);
+
+// Returns the next prime of the range, sieving the next segment when needed, or `0` if there is none or memory could
+// not be allocated (see `failed`). Must not be mixed with direct calls to internal_sieve_next_segment().
+__attribute__((visibility("hidden"))) arith_u64 internal_sieve_next_prime(internal_sieve* sieve);
+
+
+// Sieves `[lo, hi]` with `thread_count` threads, or one per CPU if `thread_count` is `0`. If `callback` is not `NULL`,
+// passes the primes to it in increasing order as arith_sieve_range() does, from one thread at a time. Otherwise,
+// stores the number of primes in `count`. Returns `false` if memory could not be allocated.
+__attribute__((visibility("hidden"))) bool internal_sieve_parallel(arith_u64 lo, arith_u64 hi, unsigned thread_count,
+                                                                   arith_prime_callback callback, void* context,
+                                                                   arith_u64* count);
+
+
+// Returns the number represented by bit `index` of the current segment, where bit `8 * i + k` is bit `k` of byte `i`.
+static INLINE arith_u64 internal_sieve_number(const internal_sieve* sieve, const arith_u64 index) {
+    return sieve->low + 30 * (index >> 3) + sieve_residues[index & 7];
+}
+
+// Returns the number of primes in the current segment.
+static INLINE arith_u64 internal_sieve_count_segment(const internal_sieve* sieve) {
+    arith_u64 count = 0;
+    for (size_t i = 0; i < sieve->size; i += 8) {
+        arith_u64 word;
+        __builtin_memcpy(&word, sieve->segment + i, sizeof(word));
+        count += (arith_u64)__builtin_popcountll(word);
+    }
+
+    return count;
+}
+
+// Stores the primes of the current segment in `out`, which must have room for `8 * size` primes, and returns their
+// number.
+static INLINE size_t internal_sieve_extract_segment(const internal_sieve* sieve, arith_u64* out) {
+    // Bit j of the little-endian word at byte i is bit j % 8 of byte i + j / 8, so the bit index in the segment is
+    // 8 * i + j.
+    size_t count = 0;
+    for (size_t i = 0; i < sieve->size; i += 8) {
+        arith_u64 word;
+        __builtin_memcpy(&word, sieve->segment + i, sizeof(word));
+
+        while (word != 0) {
+            out[count++] = internal_sieve_number(sieve, 8 * i + internal_bsf_u64(word));
+            word &= word - 1;
+        }
+    }
+
+    return count;
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_SIEVE_INTERNAL_H_
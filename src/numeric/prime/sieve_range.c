@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "numeric/prime/sieve_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_sieve_range(const arith_u64 lo, const arith_u64 hi, const arith_prime_callback callback,
+                              void* const context) {
+    // See sieve_internal.h for implementation details. The wheel does not represent 2, 3 and 5, so these are passed
+    // first. Every segment is then passed as one chunk, which holds at most one prime per bit.
+
+    static const arith_u64 wheel_primes[] = {2, 3, 5};
+    arith_u64 small_primes[3];
+    size_t small_count = 0;
+    for (unsigned i = 0; i < 3; ++i) {
+        if (lo <= wheel_primes[i] && wheel_primes[i] <= hi)
+            small_primes[small_count++] = wheel_primes[i];
+    }
+    if (small_count > 0)
+        callback(small_primes, small_count, context);
+
+    if (hi < 7 || hi < lo)
+        return true;
+
+    internal_sieve sieve;
+    if (!internal_sieve_init(&sieve, lo, hi))
+        return false;
+
+    arith_u64* const primes = malloc(8 * SIEVE_SEGMENT_BYTES * sizeof(*primes));
+    if (primes == NULL) {
+        internal_sieve_free(&sieve);
+        return false;
+    }
+
+    while (internal_sieve_next_segment(&sieve)) {
+        const size_t count = internal_sieve_extract_segment(&sieve, primes);
+        if (count > 0)
+            callback(primes, count, context);
+    }
+
+    const bool success = !sieve.failed;
+    free(primes);
+    internal_sieve_free(&sieve);
+
+    return success;
+}
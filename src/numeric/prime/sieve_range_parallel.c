@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/prime.h"
+
+#include <stdbool.h>
+
+#include "numeric/prime/sieve_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool arith_sieve_range_parallel(const arith_u64 lo, const arith_u64 hi, const unsigned thread_count,
+                                       const arith_prime_callback callback, void* const context) {
+    // See parallel_sieve.c for implementation details. As in arith_sieve_range(), 2, 3 and 5 are passed first.
+
+    static const arith_u64 wheel_primes[] = {2, 3, 5};
+    arith_u64 small_primes[3];
+    size_t small_count = 0;
+    for (unsigned i = 0; i < 3; ++i) {
+        if (lo <= wheel_primes[i] && wheel_primes[i] <= hi)
+            small_primes[small_count++] = wheel_primes[i];
+    }
+    if (small_count > 0)
+        callback(small_primes, small_count, context);
+
+    if (hi < 7 || hi < lo)
+        return true;
+
+    return internal_sieve_parallel(lo, hi, thread_count, callback, context, NULL);
+}
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/root.h"
+
+#include "numeric/numeric_internal.h"
+#include "numeric/root/root_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern arith_u64 arith_iroot_u64(const arith_u64 n, const unsigned k) {
+    if (k == 1)
+        return n;
+    if (k == 2)
+        return internal_isqrt_u64(n);
+    if (k == 3)
+        return internal_icbrt_u64(n);
+
+    // From `k = 64` on, every nonzero `n` is below `2^k`.
+    if (k >= 64)
+        return (n == 0) ? 0 : 1;
+
+    return internal_iroot_u64(n, k);
+}
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/root.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "bit_operations.h"
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/root/root_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/power.h"
+
+
+
+// The primes below 64. A `k`-th power is a `p`-th power for every prime `p` dividing `k`, so these are the only
+// exponents to try.
+static const unsigned prime_exponents[18] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61};
+
+// Bitmaps of the `p`-th powers modulo `q`, in `powers_p_mod_q`, with bit `r % 64` of word `r / 64` set if `r` is a
+// `p`-th power. Most moduli are primes `q` with `p | q - 1`, modulo which only about `1 / p` of the residues are
+// `p`-th powers. The tests for squares together pass 2.6% of the integers.
+static const arith_u64 powers_2_mod_64[1]   = {0x0202021202030213};
+static const arith_u64 powers_2_mod_63[1]   = {0x0402483012450293};
+static const arith_u64 powers_2_mod_11[1]   = {0x000000000000023B};
+static const arith_u64 powers_3_mod_63[1]   = {0x4080001818000103};
+static const arith_u64 powers_3_mod_37[1]   = {0x00000010AC804D43};
+static const arith_u64 powers_3_mod_19[1]   = {0x0000000000041983};
+static const arith_u64 powers_5_mod_11[1]   = {0x0000000000000403};
+static const arith_u64 powers_5_mod_31[1]   = {0x0000000046000063};
+static const arith_u64 powers_7_mod_29[1]   = {0x0000000010021003};
+static const arith_u64 powers_7_mod_43[1]   = {0x00000430000000C3};
+static const arith_u64 powers_11_mod_23[1]  = {0x0000000000400003};
+static const arith_u64 powers_13_mod_53[1]  = {0x0010000040800003};
+static const arith_u64 powers_17_mod_103[2] = {0x0300C00000000003, 0x0000004000000000};
+static const arith_u64 powers_19_mod_191[3] = {0x0002008000000083, 0x0000200000040000, 0x4100000001004000};
+static const arith_u64 powers_23_mod_47[1]  = {0x0000400000000003};
+static const arith_u64 powers_29_mod_59[1]  = {0x0400000000000003};
+static const arith_u64 powers_31_mod_311[5] = {0x0010001000000043, 0x0000000080000000, 0x0000000000000000,
+                                               0x0000000001000000, 0x0042000000080008};
+static const arith_u64 powers_37_mod_149[3] = {0x0000100000000003, 0x0000020000000000, 0x0000000000100000};
+
+// Returns whether `n (mod modulus)` is marked in `residues`.
+static INLINE bool internal_in_residues_u64(const arith_u64 n, const arith_u64 modulus, const arith_u64* residues) {
+    const arith_u64 residue = n % modulus;
+
+    return ((residues[residue >> 6] >> (residue & 63)) & 1) == 1;
+}
+
+// Returns `false` if `n` is certainly not a `p`-th power, and `true` if it may be one.
+static INLINE bool internal_may_be_power_u64(const arith_u64 n, const unsigned p) {
+    // In the `p`-th power of an even root, the exponent of `2` is a multiple of `p`.
+    if ((n & 1) == 0 && internal_ctz_u64(n) % p != 0)
+        return false;
+
+    // A `p`-th power is a `p`-th power modulo every modulus. The moduli are constants, so that the compiler replaces
+    // the divisions by multiplications. The tests are combined with `&` rather than `&&`, as their outcomes are close
+    // to random and a mispredicted branch costs more than a test.
+    if (p == 2)
+        return internal_in_residues_u64(n, 64, powers_2_mod_64)
+            & internal_in_residues_u64(n, 63, powers_2_mod_63)
+            & internal_in_residues_u64(n, 11, powers_2_mod_11);
+    if (p == 3)
+        return internal_in_residues_u64(n, 63, powers_3_mod_63)
+            & internal_in_residues_u64(n, 37, powers_3_mod_37)
+            & internal_in_residues_u64(n, 19, powers_3_mod_19);
+    if (p == 5)
+        return internal_in_residues_u64(n, 11, powers_5_mod_11) & internal_in_residues_u64(n, 31, powers_5_mod_31);
+    if (p == 7)
+        return internal_in_residues_u64(n, 29, powers_7_mod_29) & internal_in_residues_u64(n, 43, powers_7_mod_43);
+    if (p == 11)
+        return internal_in_residues_u64(n, 23, powers_11_mod_23);
+    if (p == 13)
+        return internal_in_residues_u64(n, 53, powers_13_mod_53);
+    if (p == 17)
+        return internal_in_residues_u64(n, 103, powers_17_mod_103);
+    if (p == 19)
+        return internal_in_residues_u64(n, 191, powers_19_mod_191);
+    if (p == 23)
+        return internal_in_residues_u64(n, 47, powers_23_mod_47);
+    if (p == 29)
+        return internal_in_residues_u64(n, 59, powers_29_mod_59);
+    if (p == 31)
+        return internal_in_residues_u64(n, 311, powers_31_mod_311);
+    if (p == 37)
+        return internal_in_residues_u64(n, 149, powers_37_mod_149);
+
+    return true;
+}
+
+// Returns the only candidate for a `p`-th root of odd `n`, for odd `p` with internal_max_root_u64(p) < 64. Modulo 64,
+// raising odd residues to the power `p` is undone by raising them to the power `p^3`, as `x^16 = 1 (mod 64)` for odd
+// `x` and `p^4 = 1 (mod 16)`. So the root is determined by `n (mod 64)`, without any search.
+static INLINE arith_u64 internal_odd_root_candidate_u64(const arith_u64 n, const unsigned p) {
+    return arith_power_u64(n, (p * p * p) & 15) & 63;
+}
+
+// Returns a bound on the primes `p` for which `n >= 4` may be a `p`-th power. If `n` is even, `p` is at most the
+// exponent of `2` in `n`, which for most even `n` ends the search without trying any exponent. If `n` is odd, then
+// `3^p <= n`, so `p <= log(n) / log(3)`, and `81 / 128` is just above `log(2) / log(3)`.
+static INLINE unsigned internal_max_exponent_u64(const arith_u64 n) {
+    return ((n & 1) == 0) ? internal_ctz_u64(n) : (internal_bsr_u64(n) + 1) * 81 / 128;
+}
+
+
+extern unsigned arith_perfect_power_u64(const arith_u64 n, arith_u64* root) {
+    // If `n = r^p` for a prime `p`, the largest exponent of `n` is `p` times that of `r`. So we take `p`-th roots for
+    // as long as they are exact, trying the primes in increasing order, and only those allowed by
+    // internal_max_exponent_u64().
+    arith_u64 base    = n;
+    unsigned exponent = 1;
+
+    size_t i = 0;
+    while (base >= 4 && i < sizeof(prime_exponents) / sizeof(prime_exponents[0])
+           && prime_exponents[i] <= internal_max_exponent_u64(base)) {
+        const unsigned p = prime_exponents[i];
+        if (!internal_may_be_power_u64(base, p)) {
+            ++i;
+            continue;
+        }
+
+        const arith_u64 max_root = internal_max_root_u64(p);
+
+        arith_u64 candidate;
+        if (p == 2)
+            candidate = internal_isqrt_u64(base);
+        else if (p == 3)
+            candidate = internal_icbrt_u64(base);
+        else if ((base & 1) == 1 && max_root < 64)
+            candidate = internal_odd_root_candidate_u64(base, p);
+        else
+            candidate = internal_iroot_u64(base, p);
+
+        // Only up to the largest root, `candidate^p` does not wrap around.
+        if (candidate <= max_root && arith_power_u64(candidate, p) == base) {
+            base      = candidate;
+            exponent *= p;
+        } else {
+            ++i;
+        }
+    }
+
+    if (root != NULL)
+        *root = base;
+
+    return exponent;
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_ROOT_INTERNAL_H_
+#define ARITHMOS_NUMERIC_ROOT_INTERNAL_H_
+
+
+#include <math.h>
+
+#include "inline.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/power.h"
+
+
+
+// If the largest `k`-th root of an `arith_u64` is at most this, internal_iroot_u64() finds the root by binary search.
+#define ROOT_SEARCH_THRESHOLD 16
+
+// `max_roots_u64[k] = floor((2^64 - 1)^(1 / k))` for `2 <= k <= 40`. For `41 <= k <= 63` it is `2`, and from `k = 64`
+// on it is `1`.
+static const arith_u64 max_roots_u64[41] = {
+    0, 0, 4294967295, 2642245, 65535, 7131, 1625, 565, 255, 138,  // k = 0, ..., 9
+    84, 56, 40, 30, 23, 19, 15, 13, 11, 10,                        // k = 10, ..., 19
+    9, 8, 7, 6, 6, 5, 5, 5, 4, 4,                                  // k = 20, ..., 29
+    4, 4, 3, 3, 3, 3, 3, 3, 3, 3,                                  // k = 30, ..., 39
+    3,                                                             // k = 40
+};
+
+// Returns `floor((2^64 - 1)^(1 / k))` for `k >= 2`, the largest `r` for which `r^k` does not overflow.
+static INLINE arith_u64 internal_max_root_u64(const unsigned k) {
+    if (k <= 40)
+        return max_roots_u64[k];
+
+    return (k < 64) ? 2 : 1;
+}
+
+// Computes `floor(n^(1 / k))` for `k >= 4`.
+static INLINE arith_u64 internal_iroot_u64(const arith_u64 n, const unsigned k) {
+    // Up to the largest root, `r^k` is exact, so arith_power_u64() decides which candidates are too large. From
+    // `k = 16` on, there are at most 15 candidates, and a binary search over them is cheaper than a call to pow().
+    const arith_u64 max_root = internal_max_root_u64(k);
+    if (max_root <= ROOT_SEARCH_THRESHOLD) {
+        arith_u64 low  = (n == 0) ? 0 : 1;
+        arith_u64 high = max_root;
+        while (low < high) {
+            const arith_u64 middle = (low + high + 1) / 2;
+            if (arith_power_u64(middle, k) <= n)
+                low = middle;
+            else
+                high = middle - 1;
+        }
+
+        return low;
+    }
+
+    // Otherwise the root is below `2^16`, and the double precision estimate is off by at most one after rounding
+    // towards zero.
+    const double root_estimate = pow((double)n, 1.0 / k);
+    arith_u64 root             = (arith_u64)root_estimate;
+    if (root > max_root)
+        root = max_root;
+
+    while (root > 0 && arith_power_u64(root, k) > n)
+        --root;
+    while (root < max_root && arith_power_u64(root + 1, k) <= n)
+        ++root;
+
+    return root;
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_ROOT_INTERNAL_H_
@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/sqrt_mod.h"
+
+#include <stdbool.h>
+
+#include "cpu_dispatch.h"
+
+#include "arithmos/core/types.h"
+
+
+
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_sqrt_mod_u64, (const arith_u64 a, const arith_u64 p, arith_u64* root));
+ARITHMOS_DEFINE_DISPATCHER(bool, arith_sqrt_prime_mod_u64,
+                           (const arith_sqrt_prime_u64* prime, const arith_u64 a, arith_u64* root));
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#ifndef ARITHMOS_NUMERIC_SQRT_MOD_INTERNAL_H_
+#define ARITHMOS_NUMERIC_SQRT_MOD_INTERNAL_H_
+
+
+#include <stdbool.h>
+
+#include "inline.h"
+#include "numeric/gcd/gcd_internal.h"
+#include "numeric/numeric_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/sqrt_mod.h"
+
+
+
+// From this two-adicity `s` of `p - 1` on, square roots are computed with Cipolla's algorithm rather than with
+// Tonelli-Shanks, whose cost grows as `s^2`. For 64-bit primes, Tonelli-Shanks is twice as fast at `s = 16`, the two
+// break even around `s = 28`, and Cipolla's algorithm is four times as fast at `s = 56`.
+#define SQRT_MOD_CIPOLLA_THRESHOLD 28
+
+
+// Computes `x / 2 (mod modulus)` for odd `modulus`. If `x` is not smaller than `modulus`, the behaviour is undefined.
+static INLINE arith_u64 internal_sqrt_mod_half_u64(const arith_u64 x, const arith_u64 modulus) {
+    // For odd x, (x + n) / 2 without overflowing.
+    return ((x & 1) == 0) ? x >> 1 : (x >> 1) + (modulus >> 1) + 1;
+}
+
+// Returns the smaller of the square roots `root` and `modulus - root`.
+static INLINE arith_u64 internal_sqrt_mod_smallest_u64(const arith_u64 root, const arith_u64 modulus) {
+    return (root <= modulus - root) ? root : modulus - root;
+}
+
+
+// Computes a square root of the Montgomery form `a` of a nonzero residue modulo `p = 5 (mod 8)`, in Montgomery form.
+// The result is only a square root if `a` is a square.
+static INLINE arith_u64 internal_sqrt_mod_atkin_u64(const arith_montgomery_u64* montgomery, const arith_u64 a) {
+    // Atkin's algorithm: 2 is a non-residue modulo p, so with v = (2a)^((p - 5) / 8) and i = 2a * v^2, which is a
+    // square root of -1 if a is a square, the square root is a * v * (i - 1).
+    const arith_u64 p      = montgomery->modulus;
+    const arith_u64 two_a  = internal_mod_add_u64(a, a, p);
+    const arith_u64 v      = internal_montgomery_power_u64(montgomery, two_a, p >> 3);
+    const arith_u64 v_sq   = internal_montgomery_mul_u64(montgomery, v, v);
+    const arith_u64 i      = internal_montgomery_mul_u64(montgomery, two_a, v_sq);
+    const arith_u64 a_by_v = internal_montgomery_mul_u64(montgomery, a, v);
+
+    return internal_montgomery_mul_u64(montgomery, a_by_v, internal_mod_sub_u64(i, montgomery->one, p));
+}
+
+// Computes a square root of the Montgomery form `a` of a nonzero residue modulo `p`, in Montgomery form, and returns
+// `true`, or returns `false` if `a` is not a square. `p - 1` must be divisible by `8`.
+static INLINE bool internal_sqrt_mod_tonelli_shanks_u64(const arith_sqrt_prime_u64* prime, const arith_u64 a,
+                                                        arith_u64* root) {
+    // With p - 1 = 2^s * q, x = a^((q + 1) / 2) satisfies x^2 = a * b for b = a^q, whose order is a power of 2. Every
+    // step finds the order 2^i of b by squaring, and multiplies x by a power t of the root of unity c of order 2^m
+    // with t^2 of order 2^i as well, so that b * t^2 has a smaller order. Then b * t^2 has order 1 after at most s
+    // steps, and x is the root. If the order of b is 2^s, a is not a square.
+    const arith_montgomery_u64* montgomery = &prime->montgomery;
+    const arith_u64 one                    = montgomery->one;
+
+    const arith_u64 w = internal_montgomery_power_u64(montgomery, a, prime->odd_part >> 1);
+    arith_u64 x       = internal_montgomery_mul_u64(montgomery, a, w);
+    arith_u64 b       = internal_montgomery_mul_u64(montgomery, x, w);
+    arith_u64 c       = prime->root_of_unity;
+    unsigned m        = prime->two_adicity;
+
+    while (b != one) {
+        unsigned i  = 0;
+        arith_u64 t = b;
+        do {
+            t = internal_montgomery_mul_u64(montgomery, t, t);
+            ++i;
+        } while (t != one && i < m);
+
+        if (i == m)
+            return false;
+
+        for (unsigned j = i + 1; j < m; ++j)
+            c = internal_montgomery_mul_u64(montgomery, c, c);
+
+        x = internal_montgomery_mul_u64(montgomery, x, c);
+        c = internal_montgomery_mul_u64(montgomery, c, c);
+        b = internal_montgomery_mul_u64(montgomery, b, c);
+        m = i;
+    }
+
+    *root = x;
+    return true;
+}
+
+// Computes a square root of the Montgomery form `a` of a nonzero residue modulo `p`, in Montgomery form. The result
+// is only a square root if `a` is a square.
+static INLINE arith_u64 internal_sqrt_mod_cipolla_u64(const arith_montgomery_u64* montgomery, const arith_u64 a) {
+    // Cipolla's algorithm: for t such that w = t^2 - a is a non-residue, the square root of a is
+    // (t + sqrt(w))^((p + 1) / 2), computed in the field F_p(sqrt(w)) of elements x + y * sqrt(w). About half of the
+    // t are suitable, and the Jacobi symbol decides which. Unlike Tonelli-Shanks, the cost does not depend on the
+    // two-adicity of p - 1.
+    const arith_u64 p   = montgomery->modulus;
+    const arith_u64 one = montgomery->one;
+
+    arith_u64 t = one;
+    arith_u64 w = internal_mod_sub_u64(one, a, p);
+    while (internal_jacobi_u64(internal_montgomery_from_mont_u64(montgomery, w), p, 0) != -1) {
+        // (t + 1)^2 - a = w + 2t + 1.
+        w = internal_mod_add_u64(w, internal_mod_add_u64(t, t, p), p);
+        w = internal_mod_add_u64(w, one, p);
+        t = internal_mod_add_u64(t, one, p);
+    }
+
+    // Left-to-right binary exponentiation of t + sqrt(w) to the power (p + 1) / 2, where the squaring of
+    // x + y * sqrt(w) gives x^2 + w * y^2 + 2xy * sqrt(w), and the multiplication by t + sqrt(w) gives
+    // xt + wy + (x + yt) * sqrt(w).
+    const arith_u64 exponent = (p >> 1) + 1;
+
+    arith_u64 x = t;
+    arith_u64 y = one;
+    for (int bit = (int)internal_bsr_u64(exponent) - 1; bit >= 0; --bit) {
+        const arith_u64 x_squared = internal_montgomery_mul_u64(montgomery, x, x);
+        const arith_u64 y_squared = internal_montgomery_mul_u64(montgomery, y, y);
+        const arith_u64 xy        = internal_montgomery_mul_u64(montgomery, x, y);
+
+        x = internal_mod_add_u64(x_squared, internal_montgomery_mul_u64(montgomery, w, y_squared), p);
+        y = internal_mod_add_u64(xy, xy, p);
+
+        if (((exponent >> bit) & 1) == 1) {
+            const arith_u64 x_cpy = x;
+
+            x = internal_mod_add_u64(internal_montgomery_mul_u64(montgomery, x, t),
+                                     internal_montgomery_mul_u64(montgomery, w, y), p);
+            y = internal_mod_add_u64(x_cpy, internal_montgomery_mul_u64(montgomery, y, t), p);
+        }
+    }
+
+    return x;
+}
+
+// Computes a square root of the Montgomery form `a` of a residue modulo `p`, in Montgomery form, and returns `true`,
+// or returns `false` if `a` is not a square.
+static INLINE bool internal_sqrt_mod_prime_u64(const arith_sqrt_prime_u64* prime, const arith_u64 a, arith_u64* root) {
+    const arith_montgomery_u64* montgomery = &prime->montgomery;
+    const arith_u64 p                      = montgomery->modulus;
+
+    if (a == 0) {
+        *root = 0;
+        return true;
+    }
+
+    if (prime->two_adicity >= 3 && prime->two_adicity < SQRT_MOD_CIPOLLA_THRESHOLD)
+        return internal_sqrt_mod_tonelli_shanks_u64(prime, a, root);
+
+    // The other algorithms give some result for non-residues as well, so their result is checked. For p = 3 (mod 4),
+    // a^((p + 1) / 4) is the square root of a if a is a square.
+    arith_u64 result;
+    if (prime->two_adicity == 1)
+        result = internal_montgomery_power_u64(montgomery, a, (p >> 2) + 1);
+    else if (prime->two_adicity == 2)
+        result = internal_sqrt_mod_atkin_u64(montgomery, a);
+    else
+        result = internal_sqrt_mod_cipolla_u64(montgomery, a);
+
+    if (internal_montgomery_mul_u64(montgomery, result, result) != a)
+        return false;
+
+    *root = result;
+    return true;
+}
+
+
+
+#endif  // #ifndef ARITHMOS_NUMERIC_SQRT_MOD_INTERNAL_H_
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/sqrt_mod.h"
+
+#include <stdbool.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/sqrt_mod/sqrt_mod_internal.h"
+
+#include "arithmos/core/types.h"
+
+
+
+extern bool ARITHMOS_DISPATCHED(arith_sqrt_mod_u64)(const arith_u64 a, const arith_u64 p, arith_u64* root) {
+    arith_sqrt_prime_u64 prime;
+    if (!arith_sqrt_prime_init_u64(&prime, p, 1))
+        return false;
+
+    arith_u64 mont_root;
+    if (!internal_sqrt_mod_prime_u64(&prime, internal_montgomery_to_mont_u64(&prime.montgomery, a), &mont_root))
+        return false;
+
+    *root = internal_sqrt_mod_smallest_u64(internal_montgomery_from_mont_u64(&prime.montgomery, mont_root), p);
+    return true;
+}
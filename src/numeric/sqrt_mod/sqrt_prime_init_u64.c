@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/sqrt_mod.h"
+
+#include <stdbool.h>
+
+#include "bit_operations.h"
+#include "numeric/gcd/gcd_internal.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/sqrt_mod/sqrt_mod_internal.h"
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+extern bool arith_sqrt_prime_init_u64(arith_sqrt_prime_u64* prime, const arith_u64 p, const unsigned k) {
+    if ((p & 1) == 0 || p == 1 || k == 0)
+        return false;
+
+    const arith_u64 max_quotient = ARITH_U64_MAX / p;
+
+    arith_u64 power = p;
+    for (unsigned i = 1; i < k; ++i) {
+        if (power > max_quotient)
+            return false;
+        power *= p;
+    }
+
+    arith_montgomery_init_u64(&prime->montgomery, p);
+    if (k == 1)
+        prime->power_montgomery = prime->montgomery;
+    else
+        arith_montgomery_init_u64(&prime->power_montgomery, power);
+
+    prime->max_quotient  = max_quotient;
+    prime->two_adicity   = internal_ctz_u64(p - 1);
+    prime->odd_part      = (p - 1) >> prime->two_adicity;
+    prime->root_of_unity = 0;
+    prime->exponent      = k;
+
+    // Only Tonelli-Shanks needs a non-residue z, and z^q generates the subgroup of order 2^s. The smallest non-residue
+    // is tiny in practice, so we simply try 2, 3, .... Before reaching a non-residue of a composite p, we reach a
+    // factor of it unless some Jacobi symbol is -1, so that a zero symbol proves p composite.
+    if (prime->two_adicity >= 3 && prime->two_adicity < SQRT_MOD_CIPOLLA_THRESHOLD) {
+        arith_u64 z = 2;
+        int symbol  = internal_jacobi_u64(z, p, 0);
+        while (symbol == 1)
+            symbol = internal_jacobi_u64(++z, p, 0);
+
+        if (symbol == 0)
+            return false;
+
+        const arith_u64 mont_z = internal_montgomery_to_mont_u64(&prime->montgomery, z);
+        prime->root_of_unity   = internal_montgomery_power_u64(&prime->montgomery, mont_z, prime->odd_part);
+    }
+
+    return true;
+}
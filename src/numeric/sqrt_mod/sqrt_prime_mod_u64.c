@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (C) 2026 Pieter te Brake
+
+#include "arithmos/numeric/sqrt_mod.h"
+
+#include <stdbool.h>
+
+#include "cpu_dispatch.h"
+#include "numeric/numeric_internal.h"
+#include "numeric/sqrt_mod/sqrt_mod_internal.h"
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+
+
+
+extern bool ARITHMOS_DISPATCHED(arith_sqrt_prime_mod_u64)(const arith_sqrt_prime_u64* prime, const arith_u64 a,
+                                                          arith_u64* root) {
+    const arith_montgomery_u64* montgomery = &prime->montgomery;
+    const arith_u64 p                      = montgomery->modulus;
+
+    arith_u64 mont_root;
+    if (prime->exponent == 1) {
+        if (!internal_sqrt_mod_prime_u64(prime, internal_montgomery_to_mont_u64(montgomery, a), &mont_root))
+            return false;
+
+        *root = internal_sqrt_mod_smallest_u64(internal_montgomery_from_mont_u64(montgomery, mont_root), p);
+        return true;
+    }
+
+    // Modulo p^k, we write a = p^e * b with b coprime to p. Then a is a square if and only if e is even and b is a
+    // square modulo p, and p^(e / 2) * sqrt(b) is a square root. The factors p are divided out by multiplying with
+    // p^-1 (mod 2^64), which is exact for multiples of p, and these are the x for which x * p^-1 (mod 2^64) is at most
+    // floor((2^64 - 1) / p).
+    const arith_montgomery_u64* power_montgomery = &prime->power_montgomery;
+    const arith_u64 modulus                      = power_montgomery->modulus;
+
+    arith_u64 b = internal_montgomery_from_mont_u64(power_montgomery,
+                                                    internal_montgomery_to_mont_u64(power_montgomery, a));
+    if (b == 0) {
+        *root = 0;
+        return true;
+    }
+
+    unsigned e = 0;
+    for (; b * montgomery->inverse <= prime->max_quotient; ++e)
+        b *= montgomery->inverse;
+
+    if ((e & 1) == 1)
+        return false;
+    if (!internal_sqrt_mod_prime_u64(prime, internal_montgomery_to_mont_u64(montgomery, b), &mont_root))
+        return false;
+
+    // Hensel lifting: the Newton iteration y <- y * (3 - b * y^2) / 2 for the inverse square root of b doubles the
+    // number of correct digits base p, and needs no division, unlike the one for the square root itself. It starts
+    // from the inverse of the square root modulo p, and then b * y is the square root modulo p^k.
+    const arith_u64 mont_b = internal_montgomery_to_mont_u64(power_montgomery, b);
+    const arith_u64 one    = power_montgomery->one;
+    const arith_u64 three  = internal_mod_add_u64(internal_mod_add_u64(one, one, modulus), one, modulus);
+
+    const arith_u64 root_b       = internal_montgomery_from_mont_u64(montgomery, mont_root);
+    const arith_u64 inverse_root = internal_mod_inverse_odd_u64(root_b, p);
+
+    arith_u64 y = internal_montgomery_to_mont_u64(power_montgomery, inverse_root);
+    for (unsigned precision = 1; precision < prime->exponent; precision *= 2) {
+        const arith_u64 y_squared = internal_montgomery_mul_u64(power_montgomery, y, y);
+        const arith_u64 b_y2      = internal_montgomery_mul_u64(power_montgomery, mont_b, y_squared);
+        const arith_u64 factor    = internal_mod_sub_u64(three, b_y2, modulus);
+
+        y = internal_sqrt_mod_half_u64(internal_montgomery_mul_u64(power_montgomery, y, factor), modulus);
+    }
+
+    // Multiplying the plain b by the Montgomery form of y gives b * y in plain form.
+    arith_u64 result = internal_montgomery_mul_u64(power_montgomery, b, y);
+    if (e == 0) {
+        *root = internal_sqrt_mod_smallest_u64(result, modulus);
+        return true;
+    }
+
+    // The square roots of a are the x = +-p^(e / 2) * sqrt(b) (mod p^(k - e / 2)). This rare case takes the only
+    // division of a square root, to reduce modulo p^(k - e / 2).
+    arith_u64 p_power      = 1;
+    arith_u64 root_modulus = modulus;
+    for (unsigned i = 0; i < e / 2; ++i) {
+        p_power      *= p;
+        root_modulus *= montgomery->inverse;
+    }
+
+    result = internal_montgomery_mul_u64(power_montgomery, internal_montgomery_to_mont_u64(power_montgomery, result),
+                                         p_power);
+    *root  = internal_sqrt_mod_smallest_u64(result % root_modulus, root_modulus);
+    return true;
+}
@@ -0,0 +1,185 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/power.h"
+
+#include "test_random.h"
+
+
+
+#define MAX_LOG_LENGTH 13
+#define MAX_LENGTH     (1 << MAX_LOG_LENGTH)
+#define RANDOM_TESTS   200
+
+
+static const arith_u32 primes[] = {998244353, 167772161, 469762049, 754974721, 257};
+
+
+static unsigned bit_reverse(const unsigned i, const unsigned log_length) {
+    unsigned reversed = 0;
+    for (unsigned k = 0; k < log_length; ++k)
+        reversed |= ((i >> k) & 1) << (log_length - 1 - k);
+
+    return reversed;
+}
+
+static void schoolbook(const arith_u32* a, const size_t a_count, const arith_u32* b, const size_t b_count,
+                       const arith_u32 modulus, arith_u32* out) {
+    for (size_t k = 0; k < a_count + b_count - 1; ++k)
+        out[k] = 0;
+
+    for (size_t i = 0; i < a_count; ++i) {
+        for (size_t j = 0; j < b_count; ++j)
+            out[i + j] = (arith_u32)((out[i + j] + (arith_u64)(a[i] % modulus) * (b[j] % modulus)) % modulus);
+    }
+}
+
+// Compares the forward transform with its definition for short lengths, and checks that the inverse transform undoes
+// it.
+static bool check_transform(const arith_ntt_u32* ntt, const unsigned log_length, arith_u32* values,
+                            arith_u32* original, arith_u32* expected) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const unsigned length   = 1U << log_length;
+
+    for (unsigned i = 0; i < length; ++i)
+        original[i] = (arith_u32)(next_random() % modulus);
+
+    memcpy(values, original, length * sizeof(*values));
+    arith_ntt_forward_u32(ntt, values, log_length);
+
+    bool passed = true;
+    if (log_length <= 6) {
+        // The root of order `2^log_length` in the tables, which must have `w^(2^(log_length - 1)) = -1`.
+        const arith_u32 root =
+        (length <= 2) ? modulus - 1 : arith_montgomery_from_mont_u32(&ntt->montgomery, ntt->roots[length / 2 + 1]);
+        if (length > 2 && arith_power_mod_u32(root, length / 2, modulus) != modulus - 1)
+            passed = false;
+
+        for (unsigned i = 0; i < length; ++i) {
+            const arith_u32 point = arith_power_mod_u32(root, bit_reverse(i, log_length), modulus);
+
+            arith_u64 sum = 0;
+            for (unsigned j = length; j-- > 0;)
+                sum = (sum * point + original[j]) % modulus;
+            expected[i] = (arith_u32)sum;
+        }
+
+        if (memcmp(values, expected, length * sizeof(*values)) != 0)
+            passed = false;
+    }
+
+    for (unsigned i = 0; i < length; ++i) {
+        if (values[i] >= modulus)
+            passed = false;
+    }
+
+    arith_ntt_inverse_u32(ntt, values, log_length);
+    if (memcmp(values, original, length * sizeof(*values)) != 0)
+        passed = false;
+
+    if (!passed)
+        fprintf(stderr, "Failed test transforms of length 2^%u modulo %u\n", log_length, modulus);
+
+    return passed;
+}
+
+// Compares arith_ntt_convolve_u32() with schoolbook multiplication, for distinct operands, a square and an output
+// that overlaps an operand.
+static bool check_convolve(const arith_ntt_u32* ntt, const size_t a_count, const size_t b_count, arith_u32* a,
+                           arith_u32* b, arith_u32* out, arith_u32* expected) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+    const size_t out_count  = a_count + b_count - 1;
+
+    for (size_t i = 0; i < a_count; ++i)
+        a[i] = (arith_u32)next_random();
+    for (size_t i = 0; i < b_count; ++i)
+        b[i] = (arith_u32)next_random();
+
+    bool passed = true;
+
+    schoolbook(a, a_count, b, b_count, modulus, expected);
+    if (!arith_ntt_convolve_u32(ntt, a, a_count, b, b_count, out)
+        || memcmp(out, expected, out_count * sizeof(*out)) != 0)
+        passed = false;
+
+    schoolbook(a, a_count, a, a_count, modulus, expected);
+    if (!arith_ntt_convolve_u32(ntt, a, a_count, a, a_count, out)
+        || memcmp(out, expected, (2 * a_count - 1) * sizeof(*out)) != 0)
+        passed = false;
+
+    schoolbook(out, a_count, b, b_count, modulus, expected);
+    if (!arith_ntt_convolve_u32(ntt, out, a_count, b, b_count, out)
+        || memcmp(out, expected, out_count * sizeof(*out)) != 0)
+        passed = false;
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_ntt_convolve_u32 of lengths %zu and %zu modulo %u\n", a_count, b_count,
+                modulus);
+
+    return passed;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    arith_ntt_u32 ntt;
+    if (arith_ntt_init_u32(&ntt, 998244351, 1) || arith_ntt_init_u32(&ntt, 998244353, 24)
+        || arith_ntt_init_u32(&ntt, 2013265921, 10) || arith_ntt_init_u32(&ntt, 2, 0)
+        || arith_ntt_init_u32(&ntt, 257, 9)) {
+        fprintf(stderr, "Failed test arith_ntt_init_u32 on invalid arguments\n");
+        passed = false;
+    }
+
+    arith_u32* buffer   = malloc(4 * 2 * MAX_LENGTH * sizeof(*buffer));
+    arith_u32* a        = buffer;
+    arith_u32* b        = buffer + 2 * MAX_LENGTH;
+    arith_u32* out      = buffer + 4 * MAX_LENGTH;
+    arith_u32* expected = buffer + 6 * MAX_LENGTH;
+    if (buffer == NULL)
+        return 1;
+
+    for (size_t p = 0; p < sizeof(primes) / sizeof(primes[0]); ++p) {
+        const unsigned max_log_length = (primes[p] == 257) ? 8 : MAX_LOG_LENGTH;
+        if (!arith_ntt_init_u32(&ntt, primes[p], max_log_length)) {
+            fprintf(stderr, "Failed test arith_ntt_init_u32(%u, %u)\n", primes[p], max_log_length);
+            passed = false;
+            continue;
+        }
+
+        for (unsigned log_length = 0; log_length <= max_log_length; ++log_length) {
+            if (!check_transform(&ntt, log_length, a, b, expected))
+                passed = false;
+        }
+
+        for (int i = 0; i < RANDOM_TESTS; ++i) {
+            // Operands of all sizes around the threshold of schoolbook multiplication, and a few large ones.
+            const size_t limit   = ((i & 31) == 0) ? ((size_t)1 << (max_log_length - 2)) : 100;
+            const size_t a_count = 1 + next_random() % limit;
+            const size_t b_count = 1 + next_random() % limit;
+            if (!check_convolve(&ntt, a_count, b_count, a, b, out, expected))
+                passed = false;
+        }
+
+        if (arith_ntt_convolve_u32(&ntt, a, (size_t)1 << max_log_length, b, 64, out)) {
+            fprintf(stderr, "Failed test arith_ntt_convolve_u32 on a too long product modulo %u\n", primes[p]);
+            passed = false;
+        }
+
+        arith_ntt_free_u32(&ntt);
+    }
+
+    free(buffer);
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
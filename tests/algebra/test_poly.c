@@ -0,0 +1,390 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arithmos/algebra/ntt.h"
+#include "arithmos/algebra/poly.h"
+#include "arithmos/core/types.h"
+
+#include "test_random.h"
+
+
+
+#define MAX_LENGTH   3000
+#define RANDOM_TESTS 100
+
+
+// Sets `poly` to a random polynomial with `length` coefficients, whose leading one is nonzero.
+static bool random_poly(const arith_ntt_u32* ntt, arith_poly_u32* poly, const size_t length, arith_u32* scratch) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    for (size_t i = 0; i < length; ++i)
+        scratch[i] = (arith_u32)(next_random() % modulus);
+    if (length > 0)
+        scratch[length - 1] = 1 + (arith_u32)(next_random() % (modulus - 1));
+
+    return arith_poly_set_u32(ntt, poly, scratch, length);
+}
+
+static void schoolbook(const arith_u32* a, const size_t a_count, const arith_u32* b, const size_t b_count,
+                       const arith_u32 modulus, arith_u32* out) {
+    for (size_t k = 0; k < a_count + b_count - 1; ++k)
+        out[k] = 0;
+
+    for (size_t i = 0; i < a_count; ++i) {
+        for (size_t j = 0; j < b_count; ++j)
+            out[i + j] = (arith_u32)((out[i + j] + (arith_u64)a[i] * b[j]) % modulus);
+    }
+}
+
+static arith_u32 horner(const arith_poly_u32* poly, const arith_u32 point, const arith_u32 modulus) {
+    arith_u64 value = 0;
+    for (size_t k = poly->length; k-- > 0;)
+        value = (value * (point % modulus) + poly->coefficients[k]) % modulus;
+
+    return (arith_u32)value;
+}
+
+static bool has_coefficients(const arith_poly_u32* poly, const arith_u32* coefficients, const size_t length) {
+    if (poly->length != length)
+        return false;
+
+    for (size_t i = 0; i < length; ++i) {
+        if (poly->coefficients[i] != coefficients[i])
+            return false;
+    }
+
+    return true;
+}
+
+// Returns the coefficient of `x^i` of `poly`.
+static arith_u32 coefficient(const arith_poly_u32* poly, const size_t i) {
+    return (i < poly->length) ? poly->coefficients[i] : 0;
+}
+
+// Returns whether `a = b (mod x^count)`.
+static bool agree(const arith_poly_u32* a, const arith_poly_u32* b, const size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (coefficient(a, i) != coefficient(b, i))
+            return false;
+    }
+
+    return true;
+}
+
+// Returns whether `a b = c (mod x^count)`, with `a` and `b` nonzero.
+static bool is_product(const arith_poly_u32* a, const arith_poly_u32* b, const arith_poly_u32* c, const size_t count,
+                       const arith_u32 modulus, arith_u32* scratch) {
+    const size_t a_count = (a->length < count) ? a->length : count;
+    const size_t b_count = (b->length < count) ? b->length : count;
+    schoolbook(a->coefficients, a_count, b->coefficients, b_count, modulus, scratch);
+
+    for (size_t i = 0; i < count; ++i) {
+        if (((i < a_count + b_count - 1) ? scratch[i] : 0) != coefficient(c, i))
+            return false;
+    }
+
+    return true;
+}
+
+// Sets `out` to the derivative of `poly`.
+static bool derivative(const arith_ntt_u32* ntt, const arith_poly_u32* poly, arith_poly_u32* out, arith_u32* scratch) {
+    for (size_t i = 1; i < poly->length; ++i)
+        scratch[i - 1] = (arith_u32)((arith_u64)i * poly->coefficients[i] % ntt->montgomery.modulus);
+
+    return arith_poly_set_u32(ntt, out, scratch, (poly->length > 0) ? poly->length - 1 : 0);
+}
+
+// Compares arith_poly_mul_u32() with schoolbook multiplication, also with the product stored in an operand.
+static bool check_mul(const arith_ntt_u32* ntt, const size_t a_length, const size_t b_length, arith_u32* scratch,
+                      arith_u32* expected) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_poly_u32 a, b, out;
+    arith_poly_init_u32(&a);
+    arith_poly_init_u32(&b);
+    arith_poly_init_u32(&out);
+
+    bool passed = random_poly(ntt, &a, a_length, scratch) && random_poly(ntt, &b, b_length, scratch);
+    if (passed) {
+        schoolbook(a.coefficients, a.length, b.coefficients, b.length, modulus, expected);
+
+        const size_t length = a_length + b_length - 1;
+        if (!arith_poly_mul_u32(ntt, &a, &b, &out) || !has_coefficients(&out, expected, length))
+            passed = false;
+        if (!arith_poly_mul_u32(ntt, &a, &b, &a) || !has_coefficients(&a, expected, length))
+            passed = false;
+    }
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_poly_mul_u32 of lengths %zu and %zu modulo %u with tables up to 2^%u\n",
+                a_length, b_length, modulus, ntt->max_log_length);
+
+    arith_poly_free_u32(&a);
+    arith_poly_free_u32(&b);
+    arith_poly_free_u32(&out);
+
+    return passed;
+}
+
+// Checks that arith_poly_divrem_u32() gives `a = q b + r` with `r` shorter than `b`, also with the results stored in
+// the operands.
+static bool check_divrem(const arith_ntt_u32* ntt, const size_t a_length, const size_t b_length, arith_u32* scratch,
+                         arith_u32* expected) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_poly_u32 a, b, q, r;
+    arith_poly_init_u32(&a);
+    arith_poly_init_u32(&b);
+    arith_poly_init_u32(&q);
+    arith_poly_init_u32(&r);
+
+    bool passed = random_poly(ntt, &a, a_length, scratch) && random_poly(ntt, &b, b_length, scratch)
+               && arith_poly_divrem_u32(ntt, &a, &b, &q, &r) && r.length < b.length;
+    if (passed && q.length > 0) {
+        schoolbook(q.coefficients, q.length, b.coefficients, b.length, modulus, expected);
+        for (size_t i = 0; i < r.length; ++i)
+            expected[i] = (expected[i] + r.coefficients[i]) % modulus;
+
+        if (!has_coefficients(&a, expected, q.length + b.length - 1))
+            passed = false;
+    } else if (passed && !has_coefficients(&r, a.coefficients, a.length)) {
+        passed = false;
+    }
+
+    if (passed) {
+        arith_poly_u32 quotient_only;
+        arith_poly_init_u32(&quotient_only);
+
+        if (!arith_poly_divrem_u32(ntt, &a, &b, &quotient_only, NULL)
+            || !has_coefficients(&quotient_only, q.coefficients, q.length))
+            passed = false;
+        if (!arith_poly_divrem_u32(ntt, &a, &b, &b, &a) || !has_coefficients(&b, q.coefficients, q.length)
+            || !has_coefficients(&a, r.coefficients, r.length))
+            passed = false;
+
+        arith_poly_free_u32(&quotient_only);
+    }
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_poly_divrem_u32 of lengths %zu and %zu modulo %u\n", a_length, b_length,
+                modulus);
+
+    arith_poly_free_u32(&a);
+    arith_poly_free_u32(&b);
+    arith_poly_free_u32(&q);
+    arith_poly_free_u32(&r);
+
+    return passed;
+}
+
+// Checks arith_poly_inverse_series_u32() and arith_poly_sqrt_series_u32() by multiplying out their results, that
+// arith_poly_exp_series_u32() gives `g' = g b'`, and that arith_poly_log_series_u32() undoes it, all to `count` terms.
+static bool check_series(const arith_ntt_u32* ntt, const size_t count, arith_u32* scratch, arith_u32* expected) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_poly_u32 a, b, out, one, d, e;
+    arith_poly_init_u32(&a);
+    arith_poly_init_u32(&b);
+    arith_poly_init_u32(&out);
+    arith_poly_init_u32(&one);
+    arith_poly_init_u32(&d);
+    arith_poly_init_u32(&e);
+
+    // `a` has constant coefficient `1` and `b` is `a - 1`, and both may be shorter or longer than the series.
+    const size_t length = 1 + next_random() % (count + 16);
+    bool passed         = random_poly(ntt, &a, length, scratch) && arith_poly_set_u32(ntt, &one, &(arith_u32){1}, 1);
+    if (passed) {
+        a.coefficients[0] = 1;
+        scratch[0]        = 0;
+        passed            = arith_poly_set_u32(ntt, &b, scratch, length);
+    }
+
+    if (passed
+        && (!arith_poly_inverse_series_u32(ntt, &a, count, &out)
+            || !is_product(&a, &out, &one, count, modulus, expected)
+            || !arith_poly_inverse_series_u32(ntt, &out, count, &out) || !agree(&out, &a, count)))
+        passed = false;
+
+    // `g = exp(b)` has `g' = g b'` and `log(g) = b`, and `log(a)` has `exp(log(a)) = a`.
+    if (passed && b.length > 0) {
+        if (!arith_poly_exp_series_u32(ntt, &b, count, &out) || coefficient(&out, 0) != 1
+            || !derivative(ntt, &out, &d, scratch) || !derivative(ntt, &b, &e, scratch)
+            || (count > 1 && !is_product(&out, &e, &d, count - 1, modulus, expected))
+            || !arith_poly_log_series_u32(ntt, &out, count, &out) || !agree(&out, &b, count))
+            passed = false;
+    }
+    if (passed
+        && (!arith_poly_log_series_u32(ntt, &a, count, &out) || !arith_poly_exp_series_u32(ntt, &out, count, &out)
+            || !agree(&out, &a, count)))
+        passed = false;
+
+    // The root of `x^2 a^2` with the smaller constant coefficient of `a^2` is `x a`, and `x a^2` has no square root.
+    if (passed && arith_poly_mul_u32(ntt, &a, &a, &d)) {
+        scratch[0] = 0;
+        scratch[1] = 0;
+        for (size_t i = 0; i < d.length; ++i)
+            scratch[i + 2] = d.coefficients[i];
+
+        if (!arith_poly_set_u32(ntt, &d, scratch, d.length + 2) || !arith_poly_sqrt_series_u32(ntt, &d, count, &out)
+            || coefficient(&out, 0) != 0 || (count > 1 && coefficient(&out, 1) != 1)
+            || !is_product(&out, &out, &d, count, modulus, expected))
+            passed = false;
+
+        if (passed && (!arith_poly_set_u32(ntt, &e, scratch + 1, d.length - 1)
+                       || arith_poly_sqrt_series_u32(ntt, &e, count, &out)))
+            passed = false;
+    } else {
+        passed = false;
+    }
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_poly_*_series_u32 of %zu terms modulo %u with tables up to 2^%u\n", count,
+                modulus, ntt->max_log_length);
+
+    arith_poly_free_u32(&a);
+    arith_poly_free_u32(&b);
+    arith_poly_free_u32(&out);
+    arith_poly_free_u32(&one);
+    arith_poly_free_u32(&d);
+    arith_poly_free_u32(&e);
+
+    return passed;
+}
+
+// Compares arith_poly_evaluate_u32() with Horner's rule, and checks that arith_poly_interpolate_u32() recovers the
+// polynomial from its values at `count` points.
+static bool check_evaluate(const arith_ntt_u32* ntt, const size_t length, const size_t count, arith_u32* points,
+                           arith_u32* values) {
+    const arith_u32 modulus = ntt->montgomery.modulus;
+
+    arith_poly_u32 poly, interpolated;
+    arith_poly_init_u32(&poly);
+    arith_poly_init_u32(&interpolated);
+
+    // Distinct points modulo `p`, some of them not reduced.
+    for (size_t i = 0; i < count; ++i)
+        points[i] = (arith_u32)((i * 7919 + 13) % modulus + (((i & 3) == 0) ? modulus : 0));
+
+    bool passed = random_poly(ntt, &poly, length, values)
+               && arith_poly_evaluate_u32(ntt, &poly, points, count, values);
+    for (size_t i = 0; passed && i < count; ++i) {
+        if (values[i] != horner(&poly, points[i], modulus))
+            passed = false;
+    }
+
+    if (passed && length <= count) {
+        if (!arith_poly_interpolate_u32(ntt, points, values, count, &interpolated)
+            || !has_coefficients(&interpolated, poly.coefficients, poly.length))
+            passed = false;
+    }
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_poly_evaluate_u32 of length %zu at %zu points modulo %u\n", length, count,
+                modulus);
+
+    arith_poly_free_u32(&poly);
+    arith_poly_free_u32(&interpolated);
+
+    return passed;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    arith_u32* buffer   = malloc(2 * 2 * MAX_LENGTH * sizeof(*buffer));
+    arith_u32* scratch  = buffer;
+    arith_u32* expected = buffer + 2 * MAX_LENGTH;
+    if (buffer == NULL)
+        return 1;
+
+    // Tables of length `2^4` leave only schoolbook and Karatsuba multiplication, and those of length `2^16` cover all
+    // products below.
+    static const arith_u32 primes[]         = {998244353, 998244353, 469762049};
+    static const unsigned max_log_lengths[] = {16, 4, 16};
+
+    for (size_t p = 0; p < sizeof(primes) / sizeof(primes[0]); ++p) {
+        arith_ntt_u32 ntt;
+        if (!arith_ntt_init_u32(&ntt, primes[p], max_log_lengths[p])) {
+            fprintf(stderr, "Failed test arith_ntt_init_u32(%u, %u)\n", primes[p], max_log_lengths[p]);
+            passed = false;
+            continue;
+        }
+
+        for (int i = 0; i < RANDOM_TESTS; ++i) {
+            // Lengths around the thresholds of schoolbook and Karatsuba multiplication, and a few long ones.
+            const size_t limit    = ((i & 15) == 0) ? MAX_LENGTH / 2 : 300;
+            const size_t a_length = 1 + next_random() % limit;
+            const size_t b_length = 1 + next_random() % limit;
+            if (!check_mul(&ntt, a_length, b_length, scratch, expected))
+                passed = false;
+            if (!check_divrem(&ntt, a_length + b_length - 1, b_length, scratch, expected)
+                || !check_divrem(&ntt, a_length, b_length, scratch, expected))
+                passed = false;
+        }
+
+        for (size_t count = 1; count <= 70; ++count) {
+            if (!check_evaluate(&ntt, count, count, scratch, expected))
+                passed = false;
+        }
+        for (int i = 0; i < RANDOM_TESTS / 4; ++i) {
+            // Lengths around the number of terms computed directly, and a few long ones.
+            const size_t count = 1 + next_random() % (((i & 7) == 0) ? MAX_LENGTH / 2 : 100);
+            if (!check_series(&ntt, count, scratch, expected))
+                passed = false;
+        }
+
+        if (!check_evaluate(&ntt, 1000, 1000, scratch, expected) || !check_evaluate(&ntt, 2500, 700, scratch, expected)
+            || !check_evaluate(&ntt, 300, 1500, scratch, expected))
+            passed = false;
+
+        arith_poly_u32 poly;
+        arith_poly_init_u32(&poly);
+
+        const arith_u32 points[] = {5, 9, 5 + primes[p]};
+        const arith_u32 values[] = {1, 2, 3};
+        if (arith_poly_interpolate_u32(&ntt, points, values, 3, &poly)) {
+            fprintf(stderr, "Failed test arith_poly_interpolate_u32 on equal points modulo %u\n", primes[p]);
+            passed = false;
+        }
+
+        arith_poly_u32 zero;
+        arith_poly_init_u32(&zero);
+        if (arith_poly_divrem_u32(&ntt, &poly, &zero, &poly, NULL)) {
+            fprintf(stderr, "Failed test arith_poly_divrem_u32 on a zero divisor modulo %u\n", primes[p]);
+            passed = false;
+        }
+
+        // `0` has no inverse, `2 + x` no logarithm, `1 + x` no exponential and `3` no square root modulo either prime.
+        const arith_u32 constants[] = {0, 2, 1, 3};
+        if (arith_poly_set_u32(&ntt, &poly, constants, 1) && arith_poly_inverse_series_u32(&ntt, &poly, 10, &poly)) {
+            fprintf(stderr, "Failed test arith_poly_inverse_series_u32 on a zero constant modulo %u\n", primes[p]);
+            passed = false;
+        }
+        if (arith_poly_set_u32(&ntt, &poly, constants + 1, 2) && arith_poly_log_series_u32(&ntt, &poly, 10, &poly)) {
+            fprintf(stderr, "Failed test arith_poly_log_series_u32 on a constant 2 modulo %u\n", primes[p]);
+            passed = false;
+        }
+        if (arith_poly_set_u32(&ntt, &poly, constants + 2, 2) && arith_poly_exp_series_u32(&ntt, &poly, 10, &poly)) {
+            fprintf(stderr, "Failed test arith_poly_exp_series_u32 on a constant 1 modulo %u\n", primes[p]);
+            passed = false;
+        }
+        if (arith_poly_set_u32(&ntt, &poly, constants + 3, 1) && arith_poly_sqrt_series_u32(&ntt, &poly, 10, &poly)) {
+            fprintf(stderr, "Failed test arith_poly_sqrt_series_u32 on a non-residue modulo %u\n", primes[p]);
+            passed = false;
+        }
+
+        arith_poly_free_u32(&poly);
+        arith_ntt_free_u32(&ntt);
+    }
+
+    free(buffer);
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/barrett.h"
+#include "arithmos/numeric/multiply.h"
+
+#include "test_random.h"
+
+
+
+#define TEST(type, func, m, a, b, ans)                                                                \
+    do {                                                                                              \
+        arith_barrett_##type barrett;                                                                 \
+        arith_barrett_init_##type(&barrett, m);                                                       \
+        if (arith_barrett_##func##_##type(&barrett, a, b) != ans) {                                   \
+            fprintf(stderr, "Failed test " #func "_" #type "(" #m ", " #a ", " #b ") == " #ans "\n"); \
+            passed = false;                                                                           \
+        }                                                                                             \
+    } while (0)
+
+
+int main(void) {
+    bool passed = true;
+
+    TEST(u32, mod_mul, 1, 12345, 6789, 0);
+    TEST(u32, mod_mul, 2, 3, 5, 1);
+    TEST(u32, mod_mul, 1024, 1000, 1000, 576);
+    TEST(u32, mod_mul, 97, ARITH_U32_MAX, ARITH_U32_MAX, 89);
+    TEST(u32, mod_mul, ARITH_U32_MAX, ARITH_U32_MAX - 1, ARITH_U32_MAX - 1, 1);
+    TEST(u32, mod_mul, ARITH_U32_MAX, ARITH_U32_MAX, 123, 0);
+    TEST(u32, mod_add, 97, 96, 96, 95);
+    TEST(u32, mod_add, ARITH_U32_MAX, ARITH_U32_MAX - 1, ARITH_U32_MAX - 1, ARITH_U32_MAX - 2);
+    TEST(u32, mod_add, 2147483648U, 2147483647U, 1, 0);
+    TEST(u32, mod_sub, 97, 3, 5, 95);
+    TEST(u32, mod_sub, 97, 5, 3, 2);
+    TEST(u32, mod_sub, ARITH_U32_MAX, 0, ARITH_U32_MAX - 1, 1);
+
+    TEST(u64, mod_mul, 1, 12345, 6789, 0);
+    TEST(u64, mod_mul, 2, 3, 5, 1);
+    TEST(u64, mod_mul, 1024, 1000, 1000, 576);
+    TEST(u64, mod_mul, 97, ARITH_U64_MAX, ARITH_U64_MAX, 11);
+    TEST(u64, mod_mul, ARITH_U64_MAX, ARITH_U64_MAX - 1, ARITH_U64_MAX - 1, 1);
+    TEST(u64, mod_mul, ARITH_U64_MAX, ARITH_U64_MAX, 123, 0);
+    TEST(u64, mod_mul, (arith_u64)1 << 63, ARITH_U64_MAX, ARITH_U64_MAX, 1);
+    TEST(u64, mod_add, 97, 96, 96, 95);
+    TEST(u64, mod_add, ARITH_U64_MAX, ARITH_U64_MAX - 1, ARITH_U64_MAX - 1, ARITH_U64_MAX - 2);
+    TEST(u64, mod_add, (arith_u64)1 << 63, ((arith_u64)1 << 63) - 1, 1, 0);
+    TEST(u64, mod_sub, 97, 3, 5, 95);
+    TEST(u64, mod_sub, 97, 5, 3, 2);
+    TEST(u64, mod_sub, ARITH_U64_MAX, 0, ARITH_U64_MAX - 1, 1);
+
+
+    for (int i = 0; i < 100000; ++i) {
+        // Vary the size of the modulus so that every normalization shift is exercised.
+        const unsigned bits = (unsigned)(i % 64) + 1;
+
+        const arith_u64 modulus64 = (next_random() >> (64 - bits)) | 1;
+        const arith_u64 a64       = next_random();
+        const arith_u64 b64       = next_random();
+        const arith_u128 x128     = ((arith_u128)next_random() << 64) | next_random();
+
+        arith_barrett_u64 barrett64;
+        arith_barrett_init_u64(&barrett64, modulus64);
+
+        if (arith_barrett_mod_mul_u64(&barrett64, a64, b64) != arith_mod_mul_u64(a64, b64, modulus64)
+            || arith_barrett_reduce_u64(&barrett64, x128) != (arith_u64)(x128 % modulus64)) {
+            fprintf(stderr, "Failed random test u64 (%lu, %lu, %lu)\n", a64, b64, modulus64);
+            passed = false;
+        }
+
+        const arith_u32 modulus32 = (arith_u32)(modulus64 >> (bits > 32 ? bits - 32 : 0)) | 1;
+        const arith_u32 a32       = (arith_u32)next_random();
+        const arith_u32 b32       = (arith_u32)next_random();
+        const arith_u64 x64       = next_random();
+
+        arith_barrett_u32 barrett32;
+        arith_barrett_init_u32(&barrett32, modulus32);
+
+        if (arith_barrett_mod_mul_u32(&barrett32, a32, b32) != arith_mod_mul_u32(a32, b32, modulus32)
+            || arith_barrett_reduce_u32(&barrett32, x64) != (arith_u32)(x64 % modulus32)) {
+            fprintf(stderr, "Failed random test u32 (%u, %u, %u)\n", a32, b32, modulus32);
+            passed = false;
+        }
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
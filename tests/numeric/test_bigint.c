@@ -0,0 +1,312 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/bigint.h"
+#include "arithmos/numeric/power.h"
+
+#include "test_random.h"
+
+
+
+#define MAX_LIMBS    4000
+#define ARENA_LIMBS  (1 << 22)
+#define RANDOM_TESTS 60
+
+
+// Room for the operands, which live outside the arenas.
+static arith_u64 operands[2 * MAX_LIMBS];
+
+// Sets `x` to a random integer with `length` limbs, taken from the end of `pool`. Some of them consist of runs of zero
+// and all-one limbs, which stress the carries and the signs of the intermediate values.
+static void random_bigint(arith_u64** pool, arith_bigint* x, const size_t length) {
+    x->limbs     = *pool;
+    x->length    = length;
+    x->capacity  = length;
+    *pool       += length;
+
+    const bool runs = (next_random() % 4 == 0);
+    for (size_t i = 0; i < length; ++i) {
+        const arith_u64 limb = next_random();
+        x->limbs[i]          = !runs ? limb : (limb & 1) ? ~(arith_u64)0 : 0;
+    }
+    if (length > 0 && x->limbs[length - 1] == 0)
+        x->limbs[length - 1] = 1;
+}
+
+static void schoolbook(const arith_bigint* a, const arith_bigint* b, arith_u64* out) {
+    memset(out, 0, (a->length + b->length) * sizeof(*out));
+
+    for (size_t i = 0; i < a->length; ++i) {
+        arith_u64 carry = 0;
+        for (size_t j = 0; j < b->length; ++j) {
+            const arith_u128 product = (arith_u128)a->limbs[i] * b->limbs[j] + out[i + j] + carry;
+            out[i + j]               = (arith_u64)product;
+            carry                    = (arith_u64)(product >> 64);
+        }
+        out[i + b->length] = carry;
+    }
+}
+
+static bool has_limbs(const arith_bigint* x, const arith_u64* limbs, size_t length) {
+    while (length > 0 && limbs[length - 1] == 0)
+        --length;
+
+    return x->length == length && (length == 0 || memcmp(x->limbs, limbs, length * sizeof(*limbs)) == 0);
+}
+
+// Compares arith_bigint_mul() with schoolbook multiplication, with and without NTTs, for a square and with the product
+// stored in an operand.
+static bool check_mul(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const size_t a_length,
+                      const size_t b_length, arith_u64* expected) {
+    const size_t mark = arena->used;
+    arith_u64* pool   = operands;
+
+    arith_bigint a, b, out;
+    random_bigint(&pool, &a, a_length);
+    random_bigint(&pool, &b, b_length);
+    arith_bigint_init(&out);
+
+    bool passed = true;
+
+    schoolbook(&a, &b, expected);
+    if (!arith_bigint_mul(ntt, arena, &a, &b, &out) || !has_limbs(&out, expected, a_length + b_length)
+        || !arith_bigint_mul(NULL, arena, &b, &a, &out) || !has_limbs(&out, expected, a_length + b_length))
+        passed = false;
+
+    schoolbook(&a, &a, expected);
+    if (!arith_bigint_mul(ntt, arena, &a, &a, &a) || !has_limbs(&a, expected, 2 * a_length))
+        passed = false;
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_bigint_mul of lengths %zu and %zu\n", a_length, b_length);
+
+    arena->used = mark;
+
+    return passed;
+}
+
+// Checks that arith_bigint_mul() gets by with the scratch space it documents, and fails without changing its output if
+// there is less.
+static bool check_mul_scratch(const arith_bigint_ntt* ntt, arith_u64* memory, const size_t a_length,
+                              const size_t b_length, arith_u64* expected) {
+    const size_t count = a_length + b_length;
+    arith_u64* pool    = operands;
+
+    arith_bigint a, b, out;
+    random_bigint(&pool, &a, a_length);
+    random_bigint(&pool, &b, b_length);
+    schoolbook(&a, &b, expected);
+
+    bool passed = true;
+
+    arith_bigint_arena arena;
+    arith_bigint_arena_init(&arena, memory, count + 8 * count);
+    arith_bigint_init(&out);
+    if (!arith_bigint_mul(ntt, &arena, &a, &b, &out) || !has_limbs(&out, expected, count) || arena.used != count)
+        passed = false;
+
+    arith_bigint_arena_init(&arena, memory, count + 8);
+    arith_bigint_init(&out);
+    if (arith_bigint_mul(ntt, &arena, &a, &b, &out) || out.length != 0 || out.limbs != NULL || arena.used != 0)
+        passed = false;
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_bigint_mul of lengths %zu and %zu in a tight arena\n", a_length, b_length);
+
+    return passed;
+}
+
+// Checks arith_bigint_add(), arith_bigint_sub(), arith_bigint_compare() and arith_bigint_mod_u64() against each other
+// and against arith_bigint_mul_u64().
+static bool check_add_sub(arith_bigint_arena* arena, const size_t a_length, const size_t b_length) {
+    const size_t mark = arena->used;
+    arith_u64* pool   = operands;
+
+    arith_bigint a, b, sum, difference, twice;
+    random_bigint(&pool, &a, a_length);
+    random_bigint(&pool, &b, b_length);
+    arith_bigint_init(&sum);
+    arith_bigint_init(&difference);
+    arith_bigint_init(&twice);
+
+    const arith_u64 modulus  = next_random() | 1;
+    const arith_u64 expected = (arith_u64)(((arith_u128)arith_bigint_mod_u64(&a, modulus)
+                                            + arith_bigint_mod_u64(&b, modulus))
+                                           % modulus);
+
+    bool passed = arith_bigint_add(arena, &a, &b, &sum) && arith_bigint_sub(arena, &sum, &b, &difference)
+               && arith_bigint_compare(&difference, &a) == 0 && arith_bigint_compare(&sum, &b) >= 0
+               && arith_bigint_mod_u64(&sum, modulus) == expected;
+
+    // `b - (a + b)` is negative unless `a` is `0`.
+    if (passed && arith_bigint_sub(arena, &b, &sum, &difference) != (a_length == 0))
+        passed = false;
+
+    // In place.
+    if (passed
+        && (!arith_bigint_add(arena, &a, &a, &twice) || !arith_bigint_mul_u64(arena, &a, 2, &a)
+            || arith_bigint_compare(&a, &twice) != 0 || !arith_bigint_sub(arena, &sum, &sum, &sum) || sum.length != 0))
+        passed = false;
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_bigint_add of lengths %zu and %zu\n", a_length, b_length);
+
+    arena->used = mark;
+
+    return passed;
+}
+
+// Compares arith_bigint_power_u64() with repeated multiplication by `base`, and with arith_power_u64() where the power
+// fits into a limb.
+static bool check_power(const arith_bigint_ntt* ntt, arith_bigint_arena* arena, const arith_u64 base,
+                        const arith_u64 exponent) {
+    const size_t mark = arena->used;
+
+    // The repeated products stay in `operands`, which has room for all of them.
+    arith_bigint power;
+    arith_bigint expected = {operands, 0, sizeof(operands) / sizeof(operands[0])};
+    arith_bigint_init(&power);
+
+    bool passed = arith_bigint_power_u64(ntt, arena, base, exponent, &power)
+               && arith_bigint_set_u64(arena, &expected, 1);
+    for (arith_u64 i = 0; passed && i < exponent; ++i)
+        passed = arith_bigint_mul_u64(arena, &expected, base, &expected);
+
+    if (passed && arith_bigint_compare(&power, &expected) != 0)
+        passed = false;
+    if (passed && power.length <= 1 && (power.length == 0 ? 0 : power.limbs[0]) != arith_power_u64(base, exponent))
+        passed = false;
+
+    if (!passed)
+        fprintf(stderr, "Failed test arith_bigint_power_u64(%lu, %lu)\n", base, exponent);
+
+    arena->used = mark;
+
+    return passed;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    arith_u64* memory   = malloc(ARENA_LIMBS * sizeof(*memory));
+    arith_u64* expected = malloc(2 * MAX_LIMBS * sizeof(*expected));
+    if (memory == NULL || expected == NULL)
+        return 1;
+
+    arith_bigint_arena arena;
+    arith_bigint_arena_init(&arena, memory, ARENA_LIMBS);
+
+    // Tables of length `2^13` only take products of up to `2^12` limbs, so longer ones fall back to Toom-3
+    // multiplication until the parts are short enough.
+    arith_bigint_ntt ntt, short_ntt;
+    if (!arith_bigint_ntt_init(&ntt, 16) || !arith_bigint_ntt_init(&short_ntt, 13)) {
+        fprintf(stderr, "Failed test arith_bigint_ntt_init\n");
+        return 1;
+    }
+    if (arith_bigint_ntt_init(&short_ntt, 24)) {
+        fprintf(stderr, "Failed test arith_bigint_ntt_init with tables that are too long\n");
+        passed = false;
+    }
+
+    for (int i = 0; i < RANDOM_TESTS; ++i) {
+        // Lengths around the thresholds of Karatsuba and Toom-3 multiplication, and a few long ones.
+        const size_t limit    = ((i & 7) == 0) ? MAX_LIMBS : 300;
+        const size_t a_length = 1 + next_random() % limit;
+        const size_t b_length = 1 + next_random() % limit;
+        if (!check_mul(&ntt, &arena, a_length, b_length, expected)
+            || !check_mul(&short_ntt, &arena, a_length, b_length, expected))
+            passed = false;
+        if (!check_add_sub(&arena, a_length, b_length) || !check_add_sub(&arena, 0, b_length))
+            passed = false;
+    }
+
+    if (!check_mul(&short_ntt, &arena, MAX_LIMBS, MAX_LIMBS, expected)
+        || !check_mul(&short_ntt, &arena, MAX_LIMBS, 1500, expected)
+        || !check_mul(NULL, &arena, MAX_LIMBS, MAX_LIMBS, expected))
+        passed = false;
+
+    if (!check_mul_scratch(&ntt, memory, 3000, 3000, expected) || !check_mul_scratch(&ntt, memory, 4000, 1100, expected)
+        || !check_mul_scratch(&short_ntt, memory, 4000, 4000, expected)
+        || !check_mul_scratch(NULL, memory, 2000, 1999, expected)
+        || !check_mul_scratch(NULL, memory, 500, 40, expected))
+        passed = false;
+
+    arith_bigint_arena_reset(&arena);
+
+    static const arith_u64 bases[]     = {0, 1, 2, 3, 10, 0xFFFFFFFFFFFFFFFF, 0x123456789ABCDEF};
+    static const arith_u64 exponents[] = {0, 1, 2, 5, 63, 64, 65, 100, 2000, 5000};
+    for (size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); ++i) {
+        for (size_t j = 0; j < sizeof(exponents) / sizeof(exponents[0]); ++j) {
+            if (!check_power(&ntt, &arena, bases[i], exponents[j])
+                || !check_power(NULL, &arena, bases[i], exponents[j]))
+                passed = false;
+        }
+    }
+
+    // `lcm(1, ..., 100)` is the product of the largest powers of the primes up to `100`, and the least common multiple
+    // of large distinct primes is their product.
+    {
+        arith_u64 values[100];
+        for (arith_u64 i = 0; i < 100; ++i)
+            values[i] = i + 1;
+
+        arith_bigint lcm, product;
+        arith_bigint_init(&lcm);
+        arith_bigint_init(&product);
+
+        bool lcm_passed = arith_bigint_lcm_u64_array(&arena, values, 100, &lcm)
+                       && arith_bigint_set_u64(&arena, &product, 1);
+        for (arith_u64 p = 2; lcm_passed && p <= 100; ++p) {
+            bool prime = true;
+            for (arith_u64 d = 2; d * d <= p; ++d)
+                prime = prime && (p % d != 0);
+
+            arith_u64 power = p;
+            while (prime && power * p <= 100)
+                power *= p;
+            if (prime)
+                lcm_passed = arith_bigint_mul_u64(&arena, &product, power, &product);
+        }
+        if (!lcm_passed || arith_bigint_compare(&lcm, &product) != 0) {
+            fprintf(stderr, "Failed test arith_bigint_lcm_u64_array(1, ..., 100)\n");
+            passed = false;
+        }
+
+        const arith_u64 primes[] = {18446744073709551557ULL, 18446744073709551533ULL, 18446744073709551557ULL,
+                                    18446744073709551521ULL};
+        if (!arith_bigint_lcm_u64_array(&arena, primes, 4, &lcm) || lcm.length != 3
+            || arith_bigint_mod_u64(&lcm, primes[0]) != 0 || arith_bigint_mod_u64(&lcm, primes[1]) != 0
+            || arith_bigint_mod_u64(&lcm, primes[3]) != 0) {
+            fprintf(stderr, "Failed test arith_bigint_lcm_u64_array of large primes\n");
+            passed = false;
+        }
+
+        const arith_u64 with_zero[] = {6, 0, 10};
+        if (!arith_bigint_lcm_u64_array(&arena, with_zero, 3, &lcm) || lcm.length != 0) {
+            fprintf(stderr, "Failed test arith_bigint_lcm_u64_array with a zero\n");
+            passed = false;
+        }
+
+        // The empty least common multiple is `1`, as for arith_lcm_u64_array().
+        if (!arith_bigint_lcm_u64_array(&arena, with_zero, 0, &lcm) || lcm.length != 1 || lcm.limbs[0] != 1) {
+            fprintf(stderr, "Failed test arith_bigint_lcm_u64_array of no values\n");
+            passed = false;
+        }
+    }
+
+    arith_bigint_ntt_free(&ntt);
+    arith_bigint_ntt_free(&short_ntt);
+    free(memory);
+    free(expected);
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/discrete_log.h"
+#include "arithmos/numeric/power.h"
+
+#include "test_random.h"
+
+
+
+#define RANDOM_TESTS 1000
+
+
+// Checks every logarithm to every base modulo the small prime `p` against the brute force one.
+static bool check_exhaustive(const arith_u64 p) {
+    for (arith_u64 g = 1; g < p; ++g) {
+        arith_log_base_u64 base;
+        if (!arith_log_base_init_u64(&base, g + p, p)) {
+            fprintf(stderr, "Failed test arith_log_base_init_u64(%lu, %lu)\n", g, p);
+            return false;
+        }
+
+        // expected[h] is the smallest x with g^x = h, or p if there is none.
+        static arith_u64 expected[1024];
+        for (arith_u64 h = 0; h < p; ++h)
+            expected[h] = p;
+
+        arith_u64 power = 1;
+        for (arith_u64 x = 0; expected[power] == p; ++x) {
+            expected[power] = x;
+            power           = power * g % p;
+        }
+
+        for (arith_u64 h = 0; h < p; ++h) {
+            arith_u64 x       = p;
+            const bool result = arith_log_base_discrete_log_u64(&base, h, &x);
+            if (result != (expected[h] != p) || x != expected[h]) {
+                fprintf(stderr, "Failed test arith_log_base_discrete_log_u64(%lu) to base %lu mod %lu == %lu\n", h,
+                        g, p, x);
+                arith_log_base_free_u64(&base);
+                return false;
+            }
+        }
+
+        arith_log_base_free_u64(&base);
+    }
+
+    return true;
+}
+
+// Checks the logarithms of random powers of `g` modulo the prime `p`.
+static bool check_random(const arith_u64 g, const arith_u64 p, const int count) {
+    arith_log_base_u64 base;
+    if (!arith_log_base_init_u64(&base, g, p)) {
+        fprintf(stderr, "Failed test arith_log_base_init_u64(%lu, %lu)\n", g, p);
+        return false;
+    }
+
+    bool passed = true;
+    for (int i = 0; i < count && passed; ++i) {
+        const arith_u64 exponent = next_random() % base.order;
+        const arith_u64 h        = arith_power_mod_u64(g, exponent, p);
+
+        arith_u64 x = 0;
+        if (!arith_log_base_discrete_log_u64(&base, h, &x) || x != exponent) {
+            fprintf(stderr, "Failed test arith_log_base_discrete_log_u64(%lu) to base %lu mod %lu == %lu\n", h, g, p,
+                    x);
+            passed = false;
+        }
+    }
+
+    arith_log_base_free_u64(&base);
+
+    return passed;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    static const arith_u64 small_primes[] = {3, 5, 7, 11, 13, 17, 31, 97, 101, 257, 601};
+    for (size_t i = 0; i < sizeof(small_primes) / sizeof(small_primes[0]); ++i)
+        passed &= check_exhaustive(small_primes[i]);
+
+    // Smooth and less smooth group orders, up to one with a prime factor q = 2^38 + 7 of 2^19 baby steps and one with
+    // q = 2^41 + 27 beyond the baby-step tables, for Pollard's rho.
+    passed &= check_random(3, 4294967291, RANDOM_TESTS);
+    passed &= check_random(7, 0xffffffff00000001, RANDOM_TESTS);
+    passed &= check_random(37, 0x1fffffffffffffff, RANDOM_TESTS);
+    passed &= check_random(2, 0x800001800e00002b, 20);
+    passed &= check_random(2, 0x8000340006c002bf, 10);
+
+    // Powers of a base of smaller order, of which the other elements are no powers.
+    arith_log_base_u64 base;
+    passed &= arith_log_base_init_u64(&base, 49, 0xffffffff00000001);
+    passed &= base.order == 0x7fffffff80000000;
+
+    arith_u64 x = 0;
+    passed &= !arith_log_base_discrete_log_u64(&base, 7, &x) && x == 0;
+    passed &= !arith_log_base_discrete_log_u64(&base, 0, &x) && x == 0;
+    passed &= arith_log_base_discrete_log_u64(&base, 2401, &x) && x == 2;
+    passed &= arith_log_base_discrete_log_u64(&base, 1, &x) && x == 0;
+    arith_log_base_free_u64(&base);
+
+    passed &= arith_log_base_init_u64(&base, 0xffffffff00000000, 0xffffffff00000001);
+    passed &= base.order == 2 && base.subgroup_count == 1;
+    arith_log_base_free_u64(&base);
+
+    passed &= arith_discrete_log_u64(5, 8, 23, &x) && x == 6;
+    passed &= arith_discrete_log_u64(1, 1, 23, &x) && x == 0;
+    passed &= !arith_discrete_log_u64(1, 2, 23, &x) && x == 0;
+
+    // Invalid moduli and bases.
+    passed &= !arith_log_base_init_u64(&base, 2, 0);
+    passed &= !arith_log_base_init_u64(&base, 2, 1);
+    passed &= !arith_log_base_init_u64(&base, 1, 2);
+    passed &= !arith_log_base_init_u64(&base, 2, 15);
+    passed &= !arith_log_base_init_u64(&base, 0, 23);
+    passed &= !arith_log_base_init_u64(&base, 46, 23);
+
+    if (!passed)
+        return 1;
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/fixed_base.h"
+#include "arithmos/numeric/power.h"
+
+#include "test_random.h"
+
+
+
+#define RANDOM_TESTS 200
+#define BATCH_COUNT  1003
+
+
+// Compares the powers of `base` modulo `modulus` with digits of `width` bits with arith_power_mod_u64(), for single
+// exponentiations and in a batch.
+static bool check_fixed_base(const arith_u64 base, const arith_u64 modulus, const unsigned width) {
+    static arith_u64 exponents[BATCH_COUNT], out[BATCH_COUNT];
+
+    arith_fixed_base_u64 fixed_base;
+    if (!arith_fixed_base_init_u64(&fixed_base, base, modulus, width)) {
+        fprintf(stderr, "Failed test arith_fixed_base_init_u64(%lu, %lu, %u)\n", base, modulus, width);
+        return false;
+    }
+
+    bool passed = true;
+
+    // Exponents of all lengths, including `0` and ones with zero digits.
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        exponents[i] = next_random() >> (next_random() & 63);
+        if (i % 7 == 0)
+            exponents[i] &= next_random() & next_random();
+    }
+    exponents[0] = 0;
+    exponents[1] = 1;
+    exponents[2] = ARITH_U64_MAX;
+
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        const arith_u64 expected = arith_power_mod_u64(base, exponents[i], modulus);
+        if (arith_fixed_base_power_u64(&fixed_base, exponents[i]) != expected) {
+            fprintf(stderr, "Failed test arith_fixed_base_power_u64(%lu, %lu, %lu) with width %u\n", base,
+                    exponents[i], modulus, width);
+            passed = false;
+        }
+    }
+
+    arith_fixed_base_power_u64_batch(&fixed_base, exponents, out, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (out[i] != arith_fixed_base_power_u64(&fixed_base, exponents[i])) {
+            fprintf(stderr, "Failed test arith_fixed_base_power_u64_batch at index %d with width %u\n", i, width);
+            passed = false;
+        }
+    }
+
+    // `out` may alias `exponent`.
+    arith_fixed_base_power_u64_batch(&fixed_base, exponents, exponents, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (exponents[i] != out[i]) {
+            fprintf(stderr, "Failed test arith_fixed_base_power_u64_batch in place at index %d\n", i);
+            passed = false;
+        }
+    }
+
+    arith_fixed_base_free_u64(&fixed_base);
+
+    return passed;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    // Every width, with moduli of all sizes.
+    for (unsigned width = 1; width <= 16; ++width) {
+        if (!check_fixed_base(next_random(), next_random() | 1, width)
+            || !check_fixed_base(next_random(), (next_random() >> (next_random() & 63)) | 1, width))
+            passed = false;
+    }
+
+    for (int i = 0; i < RANDOM_TESTS; ++i) {
+        const unsigned width = 1 + (unsigned)(next_random() % 12);
+        if (!check_fixed_base(next_random(), (next_random() >> (i % 64)) | 1, width))
+            passed = false;
+    }
+
+    // Edge cases of the base and modulus.
+    if (!check_fixed_base(0, 1000000007, 8) || !check_fixed_base(1, 1000000007, 8)
+        || !check_fixed_base(ARITH_U64_MAX, ARITH_U64_MAX, 8) || !check_fixed_base(ARITH_U64_MAX, 3, 5)
+        || !check_fixed_base(12345, 1, 4) || !check_fixed_base(2, 18446744073709551557ULL, 7))
+        passed = false;
+
+    // Even moduli and widths outside `[1, 16]` are rejected.
+    arith_fixed_base_u64 fixed_base;
+    if (arith_fixed_base_init_u64(&fixed_base, 3, 1000, 8) || arith_fixed_base_init_u64(&fixed_base, 3, 1001, 0)
+        || arith_fixed_base_init_u64(&fixed_base, 3, 1001, 17)) {
+        fprintf(stderr, "Failed test arith_fixed_base_init_u64 with invalid arguments\n");
+        passed = false;
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -3,8 +3,11 @@
 #include <stdio.h>
 
 #include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
 #include "arithmos/numeric/gcd.h"
 
+#include "test_random.h"
+
 
 
 #define TEST(func, m, n, ans)                                                       \
@@ -15,6 +18,191 @@
         }                                                                           \
     } while (0)
 
+#define TEST_XGCD(func, type, m, n, ans, x_ans, y_ans)                                                           \
+    do {                                                                                                         \
+        type x, y;                                                                                               \
+        if (func(m, n, &x, &y) != ans || x != x_ans || y != y_ans) {                                             \
+            fprintf(stderr, "Failed test " #func "(" #m ", " #n ") == (" #ans ", " #x_ans ", " #y_ans ")\n"); \
+            passed = false;                                                                                      \
+        }                                                                                                        \
+    } while (0)
+
+
+// Not a multiple of any vector width, so that the scalar tail is exercised as well.
+#define BATCH_COUNT 1003
+
+
+static arith_u128 abs_i128(const arith_i128 x) {
+    return (x < 0) ? (arith_u128)-x : (arith_u128)x;
+}
+
+// Checks that `gcd = m * x + n * y` is the gcd of `m` and `n`, and that the coefficients are within their bounds.
+static bool is_xgcd(const arith_i128 m, const arith_i128 n, const arith_i128 gcd, const arith_i128 x,
+                    const arith_i128 y) {
+    if (m * x + n * y != gcd)
+        return false;
+
+    if (gcd == 0)
+        return m == 0 && n == 0;
+
+    if (m % gcd != 0 || n % gcd != 0)
+        return false;
+
+    const arith_u128 x_bound = abs_i128(n) / (arith_u128)(2 * gcd);
+    const arith_u128 y_bound = abs_i128(m) / (arith_u128)(2 * gcd);
+    return abs_i128(x) <= ((x_bound > 1) ? x_bound : 1) && abs_i128(y) <= ((y_bound > 1) ? y_bound : 1);
+}
+
+static bool check_xgcd_i32(const arith_i32 m, const arith_i32 n) {
+    arith_i32 x, y;
+    const arith_i32 gcd = arith_xgcd_i32(m, n, &x, &y);
+    if (gcd == arith_gcd_i32(m, n) && is_xgcd(m, n, gcd, x, y))
+        return true;
+
+    fprintf(stderr, "Failed test arith_xgcd_i32(%d, %d)\n", m, n);
+    return false;
+}
+
+static bool check_xgcd_i64(const arith_i64 m, const arith_i64 n) {
+    arith_i64 x, y;
+    const arith_i64 gcd = arith_xgcd_i64(m, n, &x, &y);
+    if (gcd == arith_gcd_i64(m, n) && is_xgcd(m, n, gcd, x, y))
+        return true;
+
+    fprintf(stderr, "Failed test arith_xgcd_i64(%ld, %ld)\n", m, n);
+    return false;
+}
+
+static bool check_xgcd_u32(const arith_u32 m, const arith_u32 n) {
+    arith_i32 x, y;
+    const arith_u32 gcd = arith_xgcd_u32(m, n, &x, &y);
+    if (gcd == arith_gcd_u32(m, n) && is_xgcd(m, n, gcd, x, y))
+        return true;
+
+    fprintf(stderr, "Failed test arith_xgcd_u32(%u, %u)\n", m, n);
+    return false;
+}
+
+static bool check_xgcd_u64(const arith_u64 m, const arith_u64 n) {
+    arith_i64 x, y;
+    const arith_u64 gcd = arith_xgcd_u64(m, n, &x, &y);
+    if (gcd == arith_gcd_u64(m, n) && is_xgcd(m, n, gcd, x, y))
+        return true;
+
+    fprintf(stderr, "Failed test arith_xgcd_u64(%lu, %lu)\n", m, n);
+    return false;
+}
+
+// Checks the array gcds of `count` random values against folding them with the pairwise gcds. If `common` is set, the
+// values have a common factor, and a few of them are 0.
+static bool check_gcd_arrays(const size_t count, const bool common) {
+    static arith_i32 values_i32[BATCH_COUNT];
+    static arith_i64 values_i64[BATCH_COUNT];
+    static arith_u32 values_u32[BATCH_COUNT];
+    static arith_u64 values_u64[BATCH_COUNT];
+
+    const arith_u64 factor = common ? (next_random() >> 40) | 1 : 1;
+
+    arith_i32 gcd_i32 = 0;
+    arith_i64 gcd_i64 = 0;
+    arith_u32 gcd_u32 = 0;
+    arith_u64 gcd_u64 = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const arith_u64 random = (common && i % 17 == 5) ? 0 : next_random();
+
+        values_i32[i] = (arith_i32)((factor >> 12) * (random >> 53)) * ((i % 2 == 0) ? 1 : -1);
+        values_i64[i] = (arith_i64)(factor * (random >> 25)) * ((i % 3 == 0) ? 1 : -1);
+        values_u32[i] = (arith_u32)((factor >> 12) * (random >> 52));
+        values_u64[i] = factor * (random >> 24);
+
+        gcd_i32 = arith_gcd_i32(gcd_i32, values_i32[i]);
+        gcd_i64 = arith_gcd_i64(gcd_i64, values_i64[i]);
+        gcd_u32 = arith_gcd_u32(gcd_u32, values_u32[i]);
+        gcd_u64 = arith_gcd_u64(gcd_u64, values_u64[i]);
+    }
+
+    bool passed = true;
+    if (arith_gcd_i32_array(values_i32, count) != gcd_i32) {
+        fprintf(stderr, "Failed test arith_gcd_i32_array with count %zu\n", count);
+        passed = false;
+    }
+    if (arith_gcd_i64_array(values_i64, count) != gcd_i64) {
+        fprintf(stderr, "Failed test arith_gcd_i64_array with count %zu\n", count);
+        passed = false;
+    }
+    if (arith_gcd_u32_array(values_u32, count) != gcd_u32) {
+        fprintf(stderr, "Failed test arith_gcd_u32_array with count %zu\n", count);
+        passed = false;
+    }
+    if (arith_gcd_u64_array(values_u64, count) != gcd_u64) {
+        fprintf(stderr, "Failed test arith_gcd_u64_array with count %zu\n", count);
+        passed = false;
+    }
+
+    return passed;
+}
+
+// Computes the Kronecker symbol `(a / n)` with the textbook algorithm, which reduces by divisions.
+static int reference_kronecker(arith_i128 a, arith_i128 n) {
+    if (n == 0)
+        return (a == 1 || a == -1) ? 1 : 0;
+
+    int symbol = 1;
+    if (n < 0) {
+        n = -n;
+        if (a < 0)
+            symbol = -symbol;
+    }
+    while (n % 2 == 0) {
+        if (a % 2 == 0)
+            return 0;
+        n /= 2;
+        if ((a % 8 + 8) % 8 == 3 || (a % 8 + 8) % 8 == 5)
+            symbol = -symbol;
+    }
+
+    a = (a % n + n) % n;
+    while (a != 0) {
+        while (a % 2 == 0) {
+            a /= 2;
+            if (n % 8 == 3 || n % 8 == 5)
+                symbol = -symbol;
+        }
+
+        const arith_i128 swap = a;
+        a                     = n;
+        n                     = swap;
+        if (a % 4 == 3 && n % 4 == 3)
+            symbol = -symbol;
+        a %= n;
+    }
+
+    return (n == 1) ? symbol : 0;
+}
+
+// Checks the Jacobi and Kronecker symbols of `a` and `n`, reinterpreted as the types of the arguments.
+static bool check_symbols(const arith_u64 a, const arith_u64 n) {
+    const arith_u64 odd_n = n | 1;
+    const arith_i64 sa    = (arith_i64)a;
+    const arith_i64 sn    = (arith_i64)(odd_n >> 1) | 1;
+
+    bool passed = true;
+    if (arith_jacobi_u64(a, odd_n) != reference_kronecker(a, odd_n)) {
+        fprintf(stderr, "Failed test arith_jacobi_u64(%lu, %lu)\n", a, odd_n);
+        passed = false;
+    }
+    if (arith_jacobi_i64(sa, sn) != reference_kronecker(sa, sn)) {
+        fprintf(stderr, "Failed test arith_jacobi_i64(%ld, %ld)\n", sa, sn);
+        passed = false;
+    }
+    if (arith_kronecker_i64(sa, (arith_i64)n) != reference_kronecker(sa, (arith_i64)n)) {
+        fprintf(stderr, "Failed test arith_kronecker_i64(%ld, %ld)\n", sa, (arith_i64)n);
+        passed = false;
+    }
+
+    return passed;
+}
+
 
 int main(void) {
     bool passed = true;
@@ -68,6 +256,202 @@ int main(void) {
     TEST(arith_gcd_u64, ARITH_U64_MAX, ARITH_U64_MAX, ARITH_U64_MAX);
 
 
+    TEST_XGCD(arith_xgcd_i32, arith_i32, 0, 0, 0, 1, 0);
+    TEST_XGCD(arith_xgcd_i32, arith_i32, 0, -7, 7, 0, -1);
+    TEST_XGCD(arith_xgcd_i32, arith_i32, -5, 0, 5, -1, 0);
+    TEST_XGCD(arith_xgcd_i32, arith_i32, 240, 46, 2, -9, 47);
+    TEST_XGCD(arith_xgcd_i32, arith_i32, -240, 46, 2, 9, 47);
+    TEST_XGCD(arith_xgcd_i32, arith_i32, 46, -240, 2, 47, 9);
+    TEST_XGCD(arith_xgcd_i32, arith_i32, ARITH_I32_MIN, ARITH_I32_MAX, 1, -1, -1);
+
+    TEST_XGCD(arith_xgcd_i64, arith_i64, 0, 0, 0, 1, 0);
+    TEST_XGCD(arith_xgcd_i64, arith_i64, 240, 46, 2, -9, 47);
+    TEST_XGCD(arith_xgcd_i64, arith_i64, -240, -46, 2, 9, -47);
+    TEST_XGCD(arith_xgcd_i64, arith_i64, ARITH_I64_MIN, ARITH_I64_MAX, 1, -1, -1);
+
+    TEST_XGCD(arith_xgcd_u32, arith_i32, 0, 0, 0, 1, 0);
+    TEST_XGCD(arith_xgcd_u32, arith_i32, 12, 12, 12, 0, 1);
+    TEST_XGCD(arith_xgcd_u32, arith_i32, 3, 6, 3, 1, 0);
+    TEST_XGCD(arith_xgcd_u32, arith_i32, 240, 46, 2, -9, 47);
+    TEST_XGCD(arith_xgcd_u32, arith_i32, 46, 240, 2, 47, -9);
+    TEST_XGCD(arith_xgcd_u32, arith_i32, ARITH_U32_MAX, ARITH_U32_MAX - 1, 1, 1, -1);
+
+    TEST_XGCD(arith_xgcd_u64, arith_i64, 0, 0, 0, 1, 0);
+    TEST_XGCD(arith_xgcd_u64, arith_i64, 0, 7, 7, 0, 1);
+    TEST_XGCD(arith_xgcd_u64, arith_i64, 5, 0, 5, 1, 0);
+    TEST_XGCD(arith_xgcd_u64, arith_i64, 240, 46, 2, -9, 47);
+    TEST_XGCD(arith_xgcd_u64, arith_i64, ARITH_U64_MAX, ARITH_U64_MAX - 1, 1, 1, -1);
+    // Consecutive Fibonacci numbers have the longest sequence of quotients.
+    TEST_XGCD(arith_xgcd_u64, arith_i64, 12200160415121876738u, 7540113804746346429u, 1, -2880067194370816120,
+              4660046610375530309);
+
+    for (int i = 0; i < 100000; ++i) {
+        // Test operands of different sizes, and give a quarter of them a common factor.
+        arith_u64 m = next_random() >> (next_random() & 63);
+        arith_u64 n = next_random() >> (next_random() & 63);
+        if (i % 4 == 0) {
+            const arith_u64 factor = next_random() >> 40;
+            m                      = factor * (m >> 24);
+            n                      = factor * (n >> 24);
+        }
+
+        if (!check_xgcd_i32((arith_i32)m, (arith_i32)n))
+            passed = false;
+        if (!check_xgcd_i64((arith_i64)m, (arith_i64)n))
+            passed = false;
+        if (!check_xgcd_u32((arith_u32)m, (arith_u32)n))
+            passed = false;
+        if (!check_xgcd_u64(m, n))
+            passed = false;
+    }
+
+
+    TEST(arith_jacobi_u64, 0, 1, 1);
+    TEST(arith_jacobi_u64, 0, 3, 0);
+    TEST(arith_jacobi_u64, 1, 1, 1);
+    TEST(arith_jacobi_u64, 2, 7, 1);
+    TEST(arith_jacobi_u64, 2, 3, -1);
+    TEST(arith_jacobi_u64, 5, 21, 1);
+    TEST(arith_jacobi_u64, 6, 9, 0);
+    TEST(arith_jacobi_u64, 1001, 9907, -1);
+    TEST(arith_jacobi_u64, ARITH_U64_MAX, ARITH_U64_MAX, 0);
+    TEST(arith_jacobi_u64, ARITH_U64_MAX, ARITH_I64_MAX, 1);
+    TEST(arith_jacobi_u64, ARITH_U64_MAX - 1, 3, -1);
+
+    TEST(arith_jacobi_i64, -1, 3, -1);
+    TEST(arith_jacobi_i64, -1, 5, 1);
+    TEST(arith_jacobi_i64, -2, 7, -1);
+    TEST(arith_jacobi_i64, ARITH_I64_MIN, 3, 1);
+    TEST(arith_jacobi_i64, ARITH_I64_MIN, ARITH_I64_MAX, -1);
+
+    TEST(arith_kronecker_i64, 1, 0, 1);
+    TEST(arith_kronecker_i64, -1, 0, 1);
+    TEST(arith_kronecker_i64, 2, 0, 0);
+    TEST(arith_kronecker_i64, 0, -1, 1);
+    TEST(arith_kronecker_i64, 0, 2, 0);
+    TEST(arith_kronecker_i64, 3, 2, -1);
+    TEST(arith_kronecker_i64, -3, 2, -1);
+    TEST(arith_kronecker_i64, 7, 2, 1);
+    TEST(arith_kronecker_i64, -1, -1, -1);
+    TEST(arith_kronecker_i64, -5, -6, 1);
+    TEST(arith_kronecker_i64, -7, 12, -1);
+    TEST(arith_kronecker_i64, ARITH_I64_MIN, -1, -1);
+    TEST(arith_kronecker_i64, ARITH_I64_MIN, ARITH_I64_MIN, 0);
+    TEST(arith_kronecker_i64, 3, ARITH_I64_MIN, -1);
+    TEST(arith_kronecker_i64, -ARITH_I64_MAX, ARITH_I64_MIN, -1);
+
+    for (int i = 0; i < 100000; ++i) {
+        // Mix in small and even operands, and pairs with common factors.
+        const arith_u64 factor = (i % 4 == 0) ? (next_random() & 0xFFF) : 1;
+        const arith_u64 a      = factor * (next_random() >> (next_random() & 63));
+        const arith_u64 n      = factor * (next_random() >> (next_random() & 63)) << (i % 3);
+
+        if (!check_symbols(a, n))
+            passed = false;
+    }
+
+
+    static arith_u32 m32[BATCH_COUNT], n32[BATCH_COUNT], out32[BATCH_COUNT];
+    static arith_u64 m64[BATCH_COUNT], n64[BATCH_COUNT], out64[BATCH_COUNT];
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        // Give the operands a common factor and some trailing zeros, and make a few of them 0.
+        const arith_u64 factor = (next_random() & 0xFFFF) << (next_random() & 7);
+
+        m32[i] = (arith_u32)(factor * (next_random() & 0xFFFF));
+        n32[i] = (arith_u32)(factor * (next_random() & 0xFFFF));
+        m64[i] = factor * (next_random() >> 24);
+        n64[i] = (i % 7 == 0) ? next_random() : factor * (next_random() >> 24);
+        if (i % 13 == 0) {
+            m32[i] = 0;
+            n64[i] = 0;
+        }
+    }
+    m32[1] = n32[1] = 0;
+    m64[1] = n64[1] = 0;
+    m32[2] = n32[2] = ARITH_U32_MAX;
+    m64[2] = n64[2] = ARITH_U64_MAX;
+
+    arith_gcd_u32_batch(m32, n32, out32, BATCH_COUNT);
+    arith_gcd_u64_batch(m64, n64, out64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (out32[i] != arith_gcd_u32(m32[i], n32[i])) {
+            fprintf(stderr, "Failed test arith_gcd_u32_batch at index %d (%u, %u)\n", i, m32[i], n32[i]);
+            passed = false;
+        }
+        if (out64[i] != arith_gcd_u64(m64[i], n64[i])) {
+            fprintf(stderr, "Failed test arith_gcd_u64_batch at index %d (%lu, %lu)\n", i, m64[i], n64[i]);
+            passed = false;
+        }
+    }
+
+    // `out` may alias an input.
+    arith_gcd_u64_batch(m64, n64, m64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (m64[i] != out64[i]) {
+            fprintf(stderr, "Failed test arith_gcd_u64_batch in place at index %d\n", i);
+            passed = false;
+        }
+    }
+
+
+    static arith_u64 a_u64[BATCH_COUNT], n_u64[BATCH_COUNT];
+    static arith_i64 a_i64[BATCH_COUNT], n_i64[BATCH_COUNT];
+    static int jacobi_u64[BATCH_COUNT], jacobi_i64[BATCH_COUNT], kronecker_i64[BATCH_COUNT];
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        // Make a few of the `a` zero or equal to `n`, so that some lanes are done before others.
+        a_u64[i] = (i % 11 == 0) ? 0 : next_random() >> (next_random() & 63);
+        n_u64[i] = (i % 5 == 0) ? 1 : (next_random() >> (next_random() & 63)) | 1;
+        if (i % 17 == 0)
+            a_u64[i] = n_u64[i];
+
+        a_i64[i] = (arith_i64)next_random() >> (next_random() & 63);
+        n_i64[i] = (arith_i64)(next_random() >> 1 >> (next_random() & 63)) | 1;
+    }
+    a_u64[3] = ARITH_U64_MAX;
+    n_u64[3] = ARITH_U64_MAX - 2;
+
+    arith_jacobi_u64_batch(a_u64, n_u64, jacobi_u64, BATCH_COUNT);
+    arith_jacobi_i64_batch(a_i64, n_i64, jacobi_i64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (jacobi_u64[i] != arith_jacobi_u64(a_u64[i], n_u64[i])) {
+            fprintf(stderr, "Failed test arith_jacobi_u64_batch at index %d (%lu, %lu)\n", i, a_u64[i], n_u64[i]);
+            passed = false;
+        }
+        if (jacobi_i64[i] != arith_jacobi_i64(a_i64[i], n_i64[i])) {
+            fprintf(stderr, "Failed test arith_jacobi_i64_batch at index %d (%ld, %ld)\n", i, a_i64[i], n_i64[i]);
+            passed = false;
+        }
+    }
+
+    // The Kronecker symbol takes any `n`, including 0 and negative and even ones.
+    for (int i = 0; i < BATCH_COUNT; ++i)
+        n_i64[i] = (i % 13 == 0) ? 0 : (arith_i64)((next_random() >> (next_random() & 63)) << (i % 4));
+
+    arith_kronecker_i64_batch(a_i64, n_i64, kronecker_i64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (kronecker_i64[i] != arith_kronecker_i64(a_i64[i], n_i64[i])) {
+            fprintf(stderr, "Failed test arith_kronecker_i64_batch at index %d (%ld, %ld)\n", i, a_i64[i], n_i64[i]);
+            passed = false;
+        }
+    }
+
+
+    // Cover empty arrays, the scalar tail and several blocks, and the early exit once the gcd is 1.
+    const size_t array_counts[] = {0, 1, 2, 63, 64, 65, 128, 200, BATCH_COUNT};
+    for (size_t i = 0; i < sizeof(array_counts) / sizeof(array_counts[0]); ++i) {
+        if (!check_gcd_arrays(array_counts[i], true))
+            passed = false;
+        if (!check_gcd_arrays(array_counts[i], false))
+            passed = false;
+    }
+
+    const arith_i64 minimum_i64[] = {ARITH_I64_MIN, ARITH_I64_MIN, 6};
+    if (arith_gcd_i64_array(minimum_i64, 3) != 2) {
+        fprintf(stderr, "Failed test arith_gcd_i64_array({ARITH_I64_MIN, ARITH_I64_MIN, 6}, 3) == 2\n");
+        passed = false;
+    }
+
+
     if (!passed)
         return 1;
 
@@ -0,0 +1,138 @@
+#include <array>
+#include <cstdio>
+
+#include "arithmos/arithmos.hpp"
+
+#include "test_random.h"
+
+
+
+#define RANDOM_TESTS 100000
+
+
+// The compile-time path of the function templates.
+static_assert(arithmos::gcd<arith_i32>(-12, 18) == 6);
+static_assert(arithmos::gcd<arith_u64>(0, 0) == 0);
+static_assert(arithmos::gcd<arith_u64>(1ULL << 63, 3ULL << 60) == 1ULL << 60);
+static_assert(arithmos::lcm<arith_i64>(-4, 6) == 12);
+static_assert(arithmos::lcm<arith_u32>(0, 6) == 0);
+static_assert(arithmos::power<arith_i32>(-3, 5) == -243);
+static_assert(arithmos::power<arith_u32>(0, 0) == 1);
+static_assert(arithmos::power<arith_u64>(3, 41) == 18026252303461234787ULL);
+static_assert(arithmos::power_mod<arith_i32>(-2, 3, 7) == 6);
+static_assert(arithmos::power_mod<arith_i64>(-7, 0, 7) == 1);
+static_assert(arithmos::power_mod<arith_u64>(2, ARITH_U64_MAX, ARITH_U64_MAX) == 1ULL << 63);
+
+// Mersenne primes, for which the residues take 32 and 64 bits.
+using mod_int_31 = arithmos::mod_int<(1ULL << 31) - 1>;
+using mod_int_61 = arithmos::mod_int<(1ULL << 61) - 1>;
+
+static_assert(std::same_as<mod_int_31::value_type, arith_u32>);
+static_assert(std::same_as<mod_int_61::value_type, arith_u64>);
+static_assert((mod_int_31(-1) + 1).value() == 0);
+static_assert((mod_int_61(3) - 5).value() == (1ULL << 61) - 3);
+static_assert((mod_int_61(1ULL << 60) * 4).value() == 2);
+static_assert(mod_int_61(2).pow(61).value() == 1);
+static_assert(mod_int_61(10).inverse() * 10 == 1);
+static_assert(arithmos::mod_int<12>(8).inverse() == 0);
+static_assert(arithmos::mod_int<1>(5).pow(0) == 0);
+
+// A table of binomial coefficients modulo a prime, computed at compile time.
+constexpr arith_u64 BINOMIAL_MODULUS = 998244353;
+constexpr int BINOMIAL_TABLE_SIZE    = 64;
+
+constexpr auto factorials = [] {
+    std::array<arithmos::mod_int<BINOMIAL_MODULUS>, BINOMIAL_TABLE_SIZE> table{};
+    table[0] = 1;
+    for (int i = 1; i < BINOMIAL_TABLE_SIZE; ++i)
+        table[(size_t)i] = table[(size_t)i - 1] * i;
+
+    return table;
+}();
+
+constexpr arithmos::mod_int<BINOMIAL_MODULUS> binomial(const int n, const int k) {
+    return factorials[(size_t)n] / (factorials[(size_t)k] * factorials[(size_t)(n - k)]);
+}
+
+static_assert(binomial(10, 3) == 120);
+static_assert(binomial(63, 31).value() == 916312070471295267ULL % BINOMIAL_MODULUS);
+
+
+// Checks the run-time path of the function templates, which calls the library, against the compile-time path.
+static bool check_templates(const arith_u64 m, const arith_u64 n, const arith_u64 modulus) {
+    const arith_i64 sm        = (arith_i64)m;
+    const arith_i64 sn        = (arith_i64)n;
+    const arith_i32 sm32      = (arith_i32)m;
+    const arith_u32 m32       = (arith_u32)m;
+    const arith_u32 n32       = (arith_u32)n;
+    const arith_u32 modulus32 = ((arith_u32)modulus >> 1) | 1;
+    const arith_u32 residue32 = (arith_u32)(((arith_i64)sm32 % modulus32 + modulus32) % modulus32);
+    const arith_u64 signed_gcd =
+    arithmos::detail::gcd(arithmos::detail::unsigned_abs(sm), arithmos::detail::unsigned_abs(sn));
+
+    if (arithmos::gcd(m, n) == arithmos::detail::gcd(m, n)
+        && arithmos::gcd(sm, sn) == (arith_i64)signed_gcd
+        && arithmos::lcm(m32, n32) == ((m32 == 0 || n32 == 0) ? 0 : m32 / arithmos::detail::gcd(m32, n32) * n32)
+        && arithmos::power(m, n) == arithmos::detail::power(m, n)
+        && arithmos::power_mod(m, n, modulus) == arithmos::detail::power_mod(m, n, modulus)
+        && arithmos::power_mod(sm32, n32, modulus32)
+               == (arith_i32)arithmos::detail::power_mod(residue32, n32, modulus32))
+        return true;
+
+    fprintf(stderr, "Failed test function templates on (%lu, %lu, %lu)\n", m, n, modulus);
+    return false;
+}
+
+template <arith_u64 Modulus>
+static bool check_mod_int(const arith_u64 a, const arith_u64 b) {
+    using mod_int = arithmos::mod_int<Modulus>;
+
+    const arith_u64 ra = a % Modulus;
+    const arith_u64 rb = b % Modulus;
+
+    const mod_int x = a;
+    const mod_int y = b;
+
+    if ((x * y).value() == arith_mod_mul_u64(ra, rb, Modulus)
+        && (x + y).value() == (arith_u64)(((arith_u128)ra + rb) % Modulus)
+        && (x - y).value() == (arith_u64)(((arith_u128)ra + Modulus - rb) % Modulus)
+        && x.pow(b).value() == arith_power_mod_u64(a, b, Modulus)
+        && x.inverse().value() == arith_mod_inverse_u64(a, Modulus))
+        return true;
+
+    fprintf(stderr, "Failed test mod_int<%lu> on (%lu, %lu)\n", Modulus, a, b);
+    return false;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    for (int i = 0; i < RANDOM_TESTS; ++i) {
+        const arith_u64 m = next_random() >> (next_random() & 63);
+        const arith_u64 n = next_random() >> (next_random() & 63);
+
+        if (!check_templates(m, n, next_random() | 1))
+            passed = false;
+
+        if (!check_mod_int<1000000007>(m, n))
+            passed = false;
+        if (!check_mod_int<(1ULL << 32) + 15>(m, n))
+            passed = false;
+        if (!check_mod_int<(1ULL << 61) - 1>(m, n))
+            passed = false;
+        if (!check_mod_int<(1ULL << 63) + 29>(m, n))
+            passed = false;
+        if (!check_mod_int<ARITH_U64_MAX>(m, n))
+            passed = false;
+        if (!check_mod_int<1ULL << 40>(m, n))
+            passed = false;
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
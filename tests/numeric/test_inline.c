@@ -0,0 +1,158 @@
+#define ARITHMOS_HEADER_ONLY
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/abs.h"
+#include "arithmos/numeric/gcd.h"
+#include "arithmos/numeric/lcm.h"
+#include "arithmos/numeric/multiply.h"
+
+#include "test_random.h"
+
+
+
+#define TEST_ABS(func, x, ans)                                              \
+    do {                                                                    \
+        if (func(x) != ans) {                                               \
+            fprintf(stderr, "Failed test " #func "(" #x ") == " #ans "\n"); \
+            passed = false;                                                 \
+        }                                                                   \
+    } while (0)
+
+#define TEST(func, m, n, ans)                                                       \
+    do {                                                                            \
+        if (func(m, n) != ans) {                                                    \
+            fprintf(stderr, "Failed test " #func "(" #m ", " #n ") == " #ans "\n"); \
+            passed = false;                                                         \
+        }                                                                           \
+    } while (0)
+
+#define TEST_MOD_MUL(func, a, b, modulus, ans)                                                    \
+    do {                                                                                          \
+        if (func(a, b, modulus) != ans) {                                                         \
+            fprintf(stderr, "Failed test " #func "(" #a ", " #b ", " #modulus ") == " #ans "\n"); \
+            passed = false;                                                                       \
+        }                                                                                         \
+    } while (0)
+
+
+#define RANDOM_TESTS 100000
+
+
+static arith_u64 euclid_gcd(arith_u64 m, arith_u64 n) {
+    while (n != 0) {
+        const arith_u64 r = m % n;
+        m                 = n;
+        n                 = r;
+    }
+
+    return m;
+}
+
+static bool check_u64(const arith_u64 m, const arith_u64 n) {
+    const arith_u64 gcd = euclid_gcd(m, n);
+    const arith_u64 lcm = (gcd == 0) ? 0 : m / gcd * n;
+    if (arith_gcd_u64(m, n) == gcd && arith_lcm_u64(m, n) == lcm) {
+        const arith_u64 modulus = (n == 0) ? 1 : n;
+        if (arith_mod_mul_u64(m, n, modulus) == (arith_u64)((arith_u128)m * n % modulus)
+            && arith_multiply_u64(m, n) == (arith_u128)m * n)
+            return true;
+    }
+
+    fprintf(stderr, "Failed test u64 functions on (%lu, %lu)\n", m, n);
+    return false;
+}
+
+static bool check_i64(const arith_i64 m, const arith_i64 n) {
+    const arith_u64 gcd = euclid_gcd(arith_unsigned_abs_i64(m), arith_unsigned_abs_i64(n));
+    if (arith_gcd_i64(m, n) == (arith_i64)gcd) {
+        const arith_u64 modulus  = (n == 0) ? 1 : arith_unsigned_abs_i64(n);
+        const arith_i128 product = (arith_i128)m * n;
+        const arith_i128 reduced = product % modulus;
+        if (arith_mod_mul_i64(m, n, modulus) == (arith_i64)((reduced < 0) ? reduced + modulus : reduced)
+            && arith_multiply_i64(m, n) == product)
+            return true;
+    }
+
+    fprintf(stderr, "Failed test i64 functions on (%ld, %ld)\n", m, n);
+    return false;
+}
+
+static bool check_u32(const arith_u32 m, const arith_u32 n) {
+    const arith_u32 gcd     = (arith_u32)euclid_gcd(m, n);
+    const arith_u32 lcm     = (gcd == 0) ? 0 : m / gcd * n;
+    const arith_u32 modulus = (n == 0) ? 1 : n;
+    if (arith_gcd_u32(m, n) == gcd && arith_lcm_u32(m, n) == lcm
+        && arith_mod_mul_u32(m, n, modulus) == (arith_u32)((arith_u64)m * n % modulus))
+        return true;
+
+    fprintf(stderr, "Failed test u32 functions on (%u, %u)\n", m, n);
+    return false;
+}
+
+static bool check_i32(const arith_i32 m, const arith_i32 n) {
+    const arith_u64 gcd     = euclid_gcd(arith_unsigned_abs_i32(m), arith_unsigned_abs_i32(n));
+    const arith_u32 modulus = (n == 0) ? 1 : arith_unsigned_abs_i32(n);
+    const arith_i64 reduced = (arith_i64)m * n % modulus;
+    if (arith_gcd_i32(m, n) == (arith_i32)gcd
+        && arith_mod_mul_i32(m, n, modulus) == (arith_i32)((reduced < 0) ? reduced + modulus : reduced))
+        return true;
+
+    fprintf(stderr, "Failed test i32 functions on (%d, %d)\n", m, n);
+    return false;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    TEST_ABS(arith_abs_i32, -10, 10);
+    TEST_ABS(arith_abs_i64, ARITH_I64_MIN + 1, ARITH_I64_MAX);
+    TEST_ABS(arith_unsigned_abs_i32, ARITH_I32_MIN, (arith_u32)ARITH_I32_MAX + 1);
+    TEST_ABS(arith_unsigned_abs_i64, ARITH_I64_MIN, (arith_u64)ARITH_I64_MAX + 1);
+
+    TEST(arith_gcd_i32, 0, 0, 0);
+    TEST(arith_gcd_i32, -12, 18, 6);
+    TEST(arith_gcd_i64, ARITH_I64_MIN + 1, 0, ARITH_I64_MAX);
+    TEST(arith_gcd_u32, 0, 7, 7);
+    TEST(arith_gcd_u32, ARITH_U32_MAX, 0x10001, 0x10001);
+    TEST(arith_gcd_u64, 1ULL << 63, 3ULL << 60, 1ULL << 60);
+    TEST(arith_gcd_u64, ARITH_U64_MAX, ARITH_U64_MAX, ARITH_U64_MAX);
+
+    TEST(arith_lcm_i32, -4, 6, 12);
+    TEST(arith_lcm_i32, 0, -6, 0);
+    TEST(arith_lcm_i64, -(1LL << 40), 3, 3LL << 40);
+    TEST(arith_lcm_u32, 65536, 65536, 65536);
+    TEST(arith_lcm_u64, 1ULL << 32, 1ULL << 32, 1ULL << 32);
+
+    TEST_MOD_MUL(arith_mod_mul_i32, -3, 5, 7, 6);
+    TEST_MOD_MUL(arith_mod_mul_i64, ARITH_I64_MIN, ARITH_I64_MAX, ARITH_U64_MAX, 0x4000000000000000);
+    TEST_MOD_MUL(arith_mod_mul_u32, ARITH_U32_MAX, ARITH_U32_MAX, 7, 2);
+    TEST_MOD_MUL(arith_mod_mul_u64, ARITH_U64_MAX, ARITH_U64_MAX, ARITH_U64_MAX - 1, 1);
+
+    for (int i = 0; i < RANDOM_TESTS; ++i) {
+        // Shifting by a random amount gives operands of all sizes.
+        const arith_u64 m = next_random() >> (next_random() & 63);
+        const arith_u64 n = next_random() >> (next_random() & 63);
+
+        if (!check_u64(m, n))
+            passed = false;
+        if (!check_i64((arith_i64)m, (arith_i64)n))
+            passed = false;
+        if (!check_u32((arith_u32)m, (arith_u32)n))
+            passed = false;
+        if (!check_i32((arith_i32)m, (arith_i32)n))
+            passed = false;
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+#include "arithmos/numeric/inverse.h"
+
+#include "test_random.h"
+
+
+
+#define TEST(func, a, modulus, ans)                                                       \
+    do {                                                                                  \
+        if (func(a, modulus) != ans) {                                                    \
+            fprintf(stderr, "Failed test " #func "(" #a ", " #modulus ") == " #ans "\n"); \
+            passed = false;                                                               \
+        }                                                                                 \
+    } while (0)
+
+
+#define RANDOM_COUNT 100000
+#define BATCH_COUNT  1003
+
+
+// Checks that `inverse` is the result arith_mod_inverse_u64() specifies for `a` and `modulus`.
+static bool is_mod_inverse(const arith_u64 a, const arith_u64 modulus, const arith_u64 inverse) {
+    if (arith_gcd_u64(a, modulus) != 1 || modulus == 1)
+        return inverse == 0;
+
+    return inverse < modulus && (arith_u128)a * inverse % modulus == 1;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    TEST(arith_mod_inverse_u32, 3, 7, 5);
+    TEST(arith_mod_inverse_u32, 10, 7, 5);
+    TEST(arith_mod_inverse_u32, 0, 7, 0);
+    TEST(arith_mod_inverse_u32, 7, 7, 0);
+    TEST(arith_mod_inverse_u32, 5, 1, 0);
+    TEST(arith_mod_inverse_u32, 1, 2, 1);
+    TEST(arith_mod_inverse_u32, 2, 4, 0);
+    TEST(arith_mod_inverse_u32, 3, 8, 3);
+    TEST(arith_mod_inverse_u32, 7, 12, 7);
+    TEST(arith_mod_inverse_u32, 6, 9, 0);
+    TEST(arith_mod_inverse_u32, 2, ARITH_U32_MAX, 2147483648);
+    TEST(arith_mod_inverse_u32, ARITH_U32_MAX, 2147483648, 2147483647);
+    TEST(arith_mod_inverse_u32, ARITH_U32_MAX - 1, ARITH_U32_MAX, ARITH_U32_MAX - 1);
+
+    TEST(arith_mod_inverse_u64, 3, 7, 5);
+    TEST(arith_mod_inverse_u64, 0, 7, 0);
+    TEST(arith_mod_inverse_u64, 5, 1, 0);
+    TEST(arith_mod_inverse_u64, 7, 12, 7);
+    TEST(arith_mod_inverse_u64, 6, 9, 0);
+    TEST(arith_mod_inverse_u64, 2, 2305843009213693951, 1152921504606846976);  // 2^61 - 1
+    TEST(arith_mod_inverse_u64, 3, (arith_u64)1 << 63, 3074457345618258603);
+    TEST(arith_mod_inverse_u64, 2, ARITH_U64_MAX, (arith_u64)1 << 63);
+    TEST(arith_mod_inverse_u64, ARITH_U64_MAX - 1, ARITH_U64_MAX, ARITH_U64_MAX - 1);
+    TEST(arith_mod_inverse_u64, ARITH_U64_MAX, (arith_u64)1 << 63, ((arith_u64)1 << 63) - 1);
+
+
+    // Check random values against the definition, with random moduli of every size and parity.
+    for (int i = 0; i < RANDOM_COUNT; ++i) {
+        const unsigned bits     = 1 + (unsigned)(next_random() % 64);
+        const arith_u64 modulus = (next_random() >> (64 - bits)) | 1;
+        const arith_u64 a       = next_random();
+
+        const arith_u64 moduli[] = {modulus, modulus + 1, modulus << (next_random() % (65 - bits))};
+        for (unsigned j = 0; j < sizeof(moduli) / sizeof(moduli[0]); ++j) {
+            if (moduli[j] == 0)
+                continue;
+
+            if (!is_mod_inverse(a, moduli[j], arith_mod_inverse_u64(a, moduli[j]))) {
+                fprintf(stderr, "Failed test arith_mod_inverse_u64(%lu, %lu)\n", a, moduli[j]);
+                passed = false;
+            }
+
+            const arith_u32 modulus_32 = (arith_u32)(moduli[j] >> (64 - bits < 32 ? 0 : 32)) | 1;
+            const arith_u32 a_32       = (arith_u32)a;
+            if (!is_mod_inverse(a_32, modulus_32, arith_mod_inverse_u32(a_32, modulus_32))) {
+                fprintf(stderr, "Failed test arith_mod_inverse_u32(%u, %u)\n", a_32, modulus_32);
+                passed = false;
+            }
+        }
+    }
+
+
+    // Compare arith_mod_inverse_u64_batch() with arith_mod_inverse_u64(), with and without non-invertible elements.
+    static const arith_u64 batch_moduli[] = {
+        1,
+        2,
+        1000000007,
+        2305843009213693951,
+        ARITH_U64_MAX,
+        (arith_u64)1 << 63,
+        3 * ((arith_u64)1 << 40),
+        18446744073709551557ULL,
+    };
+    for (unsigned i = 0; i < sizeof(batch_moduli) / sizeof(batch_moduli[0]); ++i) {
+        for (int with_zero = 0; with_zero < 2; ++with_zero) {
+            arith_u64 a[BATCH_COUNT];
+            arith_u64 out[BATCH_COUNT];
+            for (unsigned j = 0; j < BATCH_COUNT; ++j)
+                a[j] = next_random() | (batch_moduli[i] % 2 == 0 ? 1 : 0);
+            if (with_zero)
+                a[next_random() % BATCH_COUNT] = batch_moduli[i] * 5;
+
+            arith_mod_inverse_u64_batch(a, batch_moduli[i], out, BATCH_COUNT);
+            for (unsigned j = 0; j < BATCH_COUNT; ++j) {
+                if (out[j] != arith_mod_inverse_u64(a[j], batch_moduli[i])) {
+                    fprintf(stderr, "Failed test arith_mod_inverse_u64_batch(%lu) at %u\n", batch_moduli[i], j);
+                    passed = false;
+                    break;
+                }
+            }
+        }
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
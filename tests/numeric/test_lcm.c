@@ -3,8 +3,12 @@
 #include <stdio.h>
 
 #include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
 #include "arithmos/numeric/lcm.h"
 
+#include "test_random.h"
+
 
 
 #define TEST(func, m, n, ans)                                                       \
@@ -15,6 +19,16 @@
         }                                                                           \
     } while (0)
 
+#define TEST_ARRAY(func, type, ans, overflow_ans, ...)                                                          \
+    do {                                                                                                        \
+        const type values[] = {__VA_ARGS__};                                                                    \
+        bool overflow;                                                                                          \
+        if (func(values, sizeof(values) / sizeof(values[0]), &overflow) != ans || overflow != overflow_ans) {   \
+            fprintf(stderr, "Failed test " #func "({" #__VA_ARGS__ "}) == " #ans ", " #overflow_ans "\n");       \
+            passed = false;                                                                                     \
+        }                                                                                                       \
+    } while (0)
+
 
 int main(void) {
     bool passed = true;
@@ -65,6 +79,56 @@ int main(void) {
     TEST(arith_lcm_u64, ARITH_U64_MAX, ARITH_U64_MAX, ARITH_U64_MAX);
 
 
+    TEST_ARRAY(arith_lcm_i32_array, arith_i32, 60, false, 4, -6, 10);
+    TEST_ARRAY(arith_lcm_i32_array, arith_i32, 0, false, 4, 0, 10);
+    TEST_ARRAY(arith_lcm_i32_array, arith_i32, ARITH_I32_MAX, false, ARITH_I32_MAX, -ARITH_I32_MAX);
+    TEST_ARRAY(arith_lcm_i32_array, arith_i32, 0, true, ARITH_I32_MIN, 3);
+    TEST_ARRAY(arith_lcm_i32_array, arith_i32, 0, false, 65536, 65537, 3, 0);
+
+    TEST_ARRAY(arith_lcm_i64_array, arith_i64, 60, false, -4, 6, -10);
+    TEST_ARRAY(arith_lcm_i64_array, arith_i64, 0, false, 0);
+    TEST_ARRAY(arith_lcm_i64_array, arith_i64, 8117355456, false, 123456, 789012, 123456);
+    TEST_ARRAY(arith_lcm_i64_array, arith_i64, 0, true, 4294967296, 2147483649);
+
+    TEST_ARRAY(arith_lcm_u32_array, arith_u32, 2520, false, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+    TEST_ARRAY(arith_lcm_u32_array, arith_u32, ARITH_U32_MAX, false, 3, 5, 17, 257, 65537);
+    TEST_ARRAY(arith_lcm_u32_array, arith_u32, 0, true, 65536, 65537);
+
+    TEST_ARRAY(arith_lcm_u64_array, arith_u64, 232792560, false, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+               17, 18, 19, 20);
+    TEST_ARRAY(arith_lcm_u64_array, arith_u64, 18446743979220271189u, false, 4294967291, 4294967279);
+    TEST_ARRAY(arith_lcm_u64_array, arith_u64, 0, true, 4294967291, 4294967279, 3, 4294967291);
+    TEST_ARRAY(arith_lcm_u64_array, arith_u64, 0, false, 4294967291, 4294967279, 3, 0);
+
+    // The lcm is 1 for an empty array, and `overflow` may be `NULL`.
+    if (arith_lcm_u64_array(NULL, 0, NULL) != 1 || arith_lcm_i32_array(NULL, 0, NULL) != 1) {
+        fprintf(stderr, "Failed test of an empty array\n");
+        passed = false;
+    }
+
+    static arith_u64 values[1000];
+    for (int i = 0; i < 100; ++i) {
+        // Products of small random factors, whose lcm overflows after a varying number of values.
+        const size_t count = (size_t)(i + 1) * 10;
+        arith_u64 lcm      = 1;
+        bool overflow      = false;
+        for (size_t j = 0; j < count; ++j) {
+            values[j] = (((next_random() & 0x3F) + 1) * ((next_random() & 0x3F) + 1)) << (next_random() & 3);
+            if (!overflow) {
+                const arith_u128 product = (arith_u128)lcm * (values[j] / arith_gcd_u64(lcm, values[j]));
+                overflow                 = product > ARITH_U64_MAX;
+                lcm                      = (arith_u64)product;
+            }
+        }
+
+        bool array_overflow;
+        if (arith_lcm_u64_array(values, count, &array_overflow) != (overflow ? 0 : lcm) || array_overflow != overflow) {
+            fprintf(stderr, "Failed test arith_lcm_u64_array with count %zu\n", count);
+            passed = false;
+        }
+    }
+
+
     if (!passed)
         return 1;
 
@@ -0,0 +1,102 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/montgomery.h"
+#include "arithmos/numeric/multiply.h"
+#include "arithmos/numeric/power.h"
+
+#include "test_random.h"
+
+
+
+#define TEST_POWER_MOD(type, a, b, m, ans)                                                                 \
+    do {                                                                                                   \
+        arith_montgomery_##type montgomery;                                                                \
+        arith_montgomery_init_##type(&montgomery, m);                                                      \
+        if (arith_montgomery_power_mod_##type(&montgomery, a, b) != ans) {                                 \
+            fprintf(stderr, "Failed test montgomery_power_mod_" #type "(" #a ", " #b ", " #m ") == " #ans "\n"); \
+            passed = false;                                                                                \
+        }                                                                                                  \
+    } while (0)
+
+
+int main(void) {
+    bool passed = true;
+
+    TEST_POWER_MOD(u32, 0, 0, 1, 0);
+    TEST_POWER_MOD(u32, 0, 0, 3, 1);
+    TEST_POWER_MOD(u32, 5, 0, 7, 1);
+    TEST_POWER_MOD(u32, 1, 12345, 97, 1);
+    TEST_POWER_MOD(u32, 123, 456, 1, 0);
+    TEST_POWER_MOD(u32, 14, 5, 7, 0);
+    TEST_POWER_MOD(u32, 42, 1, 97, 42);
+    TEST_POWER_MOD(u32, 2, 1000000, 13, 3);
+    TEST_POWER_MOD(u32, 3, 1 << 20, 17, 1);
+    TEST_POWER_MOD(u32, 5, 1000000007, 19, 4);
+    TEST_POWER_MOD(u32, ARITH_U32_MAX, 2, 97, 89);
+    TEST_POWER_MOD(u32, ARITH_U32_MAX, ARITH_U32_MAX, 13, 5);
+    TEST_POWER_MOD(u32, 7, 1000, ARITH_U32_MAX - 2, 2081127449);
+
+    TEST_POWER_MOD(u64, 0, 0, 1, 0);
+    TEST_POWER_MOD(u64, 0, 0, 3, 1);
+    TEST_POWER_MOD(u64, 5, 0, 7, 1);
+    TEST_POWER_MOD(u64, 1, 12345, 97, 1);
+    TEST_POWER_MOD(u64, 123, 456, 1, 0);
+    TEST_POWER_MOD(u64, 14, 5, 7, 0);
+    TEST_POWER_MOD(u64, 42, 1, 97, 42);
+    TEST_POWER_MOD(u64, 2, 1000000, 13, 3);
+    TEST_POWER_MOD(u64, 3, 1 << 20, 17, 1);
+    TEST_POWER_MOD(u64, 5, 1000000007, 19, 4);
+    TEST_POWER_MOD(u64, ARITH_U64_MAX, 2, 97, 11);
+    TEST_POWER_MOD(u64, ARITH_U64_MAX, ARITH_U64_MAX, 13, 8);
+    TEST_POWER_MOD(u64, 7, 1000, ARITH_U64_MAX, 4349782150649683021ULL);
+
+
+    for (int i = 0; i < 10000; ++i) {
+        const arith_u32 modulus32 = (arith_u32)next_random() | 1;
+        const arith_u32 a32       = (arith_u32)next_random();
+        const arith_u32 b32       = (arith_u32)next_random();
+
+        arith_montgomery_u32 montgomery32;
+        arith_montgomery_init_u32(&montgomery32, modulus32);
+
+        const arith_u32 mont_a32 = arith_montgomery_to_mont_u32(&montgomery32, a32);
+        const arith_u32 mont_b32 = arith_montgomery_to_mont_u32(&montgomery32, b32);
+        if (arith_montgomery_from_mont_u32(&montgomery32, mont_a32) != a32 % modulus32
+            || arith_montgomery_from_mont_u32(
+                   &montgomery32, arith_montgomery_mul_u32(&montgomery32, mont_a32, mont_b32))
+                   != arith_mod_mul_u32(a32, b32, modulus32)
+            || arith_montgomery_power_mod_u32(&montgomery32, a32, b32) != arith_power_mod_u32(a32, b32, modulus32)) {
+            fprintf(stderr, "Failed random test u32 (%u, %u, %u)\n", a32, b32, modulus32);
+            passed = false;
+        }
+
+        const arith_u64 modulus64 = next_random() | 1;
+        const arith_u64 a64       = next_random();
+        const arith_u64 b64       = next_random();
+
+        arith_montgomery_u64 montgomery64;
+        arith_montgomery_init_u64(&montgomery64, modulus64);
+
+        const arith_u64 mont_a64 = arith_montgomery_to_mont_u64(&montgomery64, a64);
+        const arith_u64 mont_b64 = arith_montgomery_to_mont_u64(&montgomery64, b64);
+        if (arith_montgomery_from_mont_u64(&montgomery64, mont_a64) != a64 % modulus64
+            || arith_montgomery_from_mont_u64(
+                   &montgomery64, arith_montgomery_mul_u64(&montgomery64, mont_a64, mont_b64))
+                   != arith_mod_mul_u64(a64, b64, modulus64)
+            || arith_montgomery_power_mod_u64(&montgomery64, a64, b64) != arith_power_mod_u64(a64, b64, modulus64)) {
+            fprintf(stderr, "Failed random test u64 (%lu, %lu, %lu)\n", a64, b64, modulus64);
+            passed = false;
+        }
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -3,8 +3,11 @@
 #include <stdio.h>
 
 #include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
 #include "arithmos/numeric/power.h"
 
+#include "test_random.h"
+
 
 
 #define TEST(func, m, n, ans)                                                       \
@@ -24,6 +27,10 @@
     } while (0)
 
 
+// Not a multiple of any vector width, so that the scalar tail is exercised as well.
+#define BATCH_COUNT 1003
+
+
 int main(void) {
     bool passed = true;
 
@@ -149,6 +156,75 @@ int main(void) {
     TEST_MOD(arith_power_mod_u64, 7, 1000, ARITH_U64_MAX - 1, 16134194563271013985ULL);
 
 
+    static arith_u32 base32[BATCH_COUNT], exponent32[BATCH_COUNT], modulus32[BATCH_COUNT], out32[BATCH_COUNT];
+    static arith_u64 base64[BATCH_COUNT], exponent64[BATCH_COUNT], modulus64[BATCH_COUNT], out64[BATCH_COUNT];
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        // Mix moduli of all sizes, including even ones, 64-bit ones above 2^52 and a few 1s, and exponents of all
+        // lengths, so that the lanes of a vector finish at different times.
+        const unsigned shift = (unsigned)(next_random() & 63);
+
+        base32[i]     = (arith_u32)next_random();
+        exponent32[i] = (arith_u32)(next_random() >> (32 + (shift & 31)));
+        modulus32[i]  = (arith_u32)(next_random() >> (32 + (shift >> 1))) | 1;
+        base64[i]     = next_random();
+        exponent64[i] = next_random() >> shift;
+        modulus64[i]  = (next_random() >> (i % 3 == 0 ? 0 : 12 + (shift & 31))) | 1;
+        if (i % 5 == 0) {
+            modulus32[i] = (modulus32[i] | 2) & ~(arith_u32)1;
+            modulus64[i] = (modulus64[i] | 2) & ~(arith_u64)1;
+        }
+        if (i % 17 == 0) {
+            modulus32[i] = 1;
+            modulus64[i] = 1;
+        }
+        if (i % 19 == 0) {
+            base32[i] = 0;
+            base64[i] = 0;
+        }
+    }
+    modulus32[3] = modulus32[4] = 2;
+    modulus64[3] = modulus64[4] = 2;
+
+    arith_power_mod_u32_batch(base32, exponent32, modulus32, out32, BATCH_COUNT);
+    arith_power_mod_u64_batch(base64, exponent64, modulus64, out64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (out32[i] != arith_power_mod_u32(base32[i], exponent32[i], modulus32[i])) {
+            fprintf(stderr, "Failed test arith_power_mod_u32_batch at index %d (%u, %u, %u)\n", i, base32[i],
+                    exponent32[i], modulus32[i]);
+            passed = false;
+        }
+        if (out64[i] != arith_power_mod_u64(base64[i], exponent64[i], modulus64[i])) {
+            fprintf(stderr, "Failed test arith_power_mod_u64_batch at index %d (%lu, %lu, %lu)\n", i, base64[i],
+                    exponent64[i], modulus64[i]);
+            passed = false;
+        }
+    }
+
+    // `out` may alias an input.
+    arith_power_mod_u64_batch(base64, exponent64, modulus64, base64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (base64[i] != out64[i]) {
+            fprintf(stderr, "Failed test arith_power_mod_u64_batch in place at index %d\n", i);
+            passed = false;
+        }
+    }
+
+    // Exponents with few set bits, so that the windows of the scalar path are separated by long runs of zeros. The
+    // moduli are too large for the vector lanes.
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        exponent64[i] = (next_random() & next_random() & next_random()) | ((arith_u64)1 << (i % 64));
+        modulus64[i]  = next_random() | ((arith_u64)1 << 63);
+    }
+    arith_power_mod_u64_batch(base64, exponent64, modulus64, out64, BATCH_COUNT);
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        if (out64[i] != arith_power_mod_u64(base64[i], exponent64[i], modulus64[i])) {
+            fprintf(stderr, "Failed test arith_power_mod_u64_batch at index %d (%lu, %lu, %lu)\n", i, base64[i],
+                    exponent64[i], modulus64[i]);
+            passed = false;
+        }
+    }
+
+
     if (!passed)
         return 1;
 
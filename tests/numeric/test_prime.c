@@ -0,0 +1,413 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/prime.h"
+
+#include "test_random.h"
+
+
+
+#define TEST(func, n, ans)                                                  \
+    do {                                                                    \
+        if (func(n) != ans) {                                               \
+            fprintf(stderr, "Failed test " #func "(" #n ") == " #ans "\n"); \
+            passed = false;                                                 \
+        }                                                                   \
+    } while (0)
+
+
+#define SIEVE_LIMIT  (1 << 20)
+#define RANDOM_COUNT 10000
+
+#define FACTOR_SEMIPRIME_COUNT 1000
+
+#define SIEVE_RANGE_COUNT 200
+#define SIEVE_LARGE_WIDTH 1000000
+
+#define PRIME_COUNT_RANDOM_COUNT 20
+#define PRIME_COUNT_RANDOM_BITS  27
+
+
+// Strong pseudoprimes to base 2 without prime factors below 59, which pass the first test of arith_is_prime_u32().
+static const arith_u32 strong_pseudoprimes[] = {
+    4117447441, 4139015987, 4186561633, 4192060699, 4204344601, 4232966251, 4234224601, 4237212061,
+    4250920459, 4251904273, 4255695013, 4271267333, 4275011401, 4278305651, 4282867213, 4294901761,
+};
+
+
+// Checks that `primes` and `exponents` are a factorization of `n` as specified by arith_factor_u64().
+static bool is_factorization(const arith_u64 n, const arith_u64* primes, const unsigned* exponents,
+                             const unsigned count) {
+    if (n < 2)
+        return count == 0;
+
+    arith_u64 product = 1;
+    for (unsigned i = 0; i < count; ++i) {
+        if (!arith_is_prime_u64(primes[i]) || exponents[i] == 0 || (i > 0 && primes[i] <= primes[i - 1]))
+            return false;
+
+        for (unsigned j = 0; j < exponents[i]; ++j) {
+            if (product > n / primes[i])
+                return false;
+            product *= primes[i];
+        }
+    }
+
+    return product == n;
+}
+
+// Collects the primes passed by arith_sieve_range().
+typedef struct {
+    arith_u64 primes[SIEVE_LIMIT / 8];
+    size_t count;
+    bool overflow;
+} sieved_primes;
+
+static void collect_primes(const arith_u64* primes, size_t count, void* context) {
+    sieved_primes* sieved = context;
+    for (size_t i = 0; i < count; ++i) {
+        if (sieved->count == sizeof(sieved->primes) / sizeof(sieved->primes[0])) {
+            sieved->overflow = true;
+            return;
+        }
+        sieved->primes[sieved->count++] = primes[i];
+    }
+}
+
+// Checks that arith_sieve_range() passes exactly the primes in `[lo, hi]` in increasing order, where `composite`
+// decides primality below `SIEVE_LIMIT` and arith_is_prime_u64() above it.
+static bool check_sieve_range(const arith_u64 lo, const arith_u64 hi, const bool* composite) {
+    static sieved_primes sieved;
+    sieved.count    = 0;
+    sieved.overflow = false;
+
+    if (!arith_sieve_range(lo, hi, collect_primes, &sieved) || sieved.overflow)
+        return false;
+
+    size_t index = 0;
+    for (arith_u64 n = lo; n <= hi; ++n) {
+        const bool is_prime = (n < SIEVE_LIMIT) ? !composite[n] : arith_is_prime_u64(n);
+        if (is_prime && (index == sieved.count || sieved.primes[index++] != n))
+            return false;
+        if (n == hi)
+            break;
+    }
+
+    return index == sieved.count;
+}
+
+// Accumulates the primes passed by arith_sieve_range() and arith_sieve_range_parallel() into a checksum.
+typedef struct {
+    arith_u64 count;
+    arith_u64 last;
+    arith_u64 checksum;
+    bool increasing;
+} prime_checksum;
+
+static void checksum_primes(const arith_u64* primes, size_t count, void* context) {
+    prime_checksum* checksum = context;
+    for (size_t i = 0; i < count; ++i) {
+        if (checksum->count + i > 0 && primes[i] <= checksum->last)
+            checksum->increasing = false;
+
+        checksum->last     = primes[i];
+        checksum->checksum = checksum->checksum * 0x9E3779B97F4A7C15 + primes[i];
+    }
+    checksum->count += count;
+}
+
+// Checks that arith_sieve_range_parallel() and arith_sieve_count_range() agree with arith_sieve_range().
+static bool check_parallel_sieve_range(const arith_u64 lo, const arith_u64 hi, const unsigned thread_count) {
+    prime_checksum expected = {.increasing = true};
+    prime_checksum actual   = {.increasing = true};
+    arith_u64 count         = 0;
+
+    return arith_sieve_range(lo, hi, checksum_primes, &expected)
+        && arith_sieve_range_parallel(lo, hi, thread_count, checksum_primes, &actual)
+        && arith_sieve_count_range(lo, hi, thread_count, &count) && actual.increasing && actual.count == expected.count
+        && actual.checksum == expected.checksum && count == expected.count;
+}
+
+static bool is_prime_trial_division(const arith_u32 n) {
+    if (n < 2)
+        return false;
+
+    for (arith_u32 d = 2; (arith_u64)d * d <= n; ++d) {
+        if (n % d == 0)
+            return false;
+    }
+
+    return true;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    TEST(arith_is_prime_u32, 0, false);
+    TEST(arith_is_prime_u32, 1, false);
+    TEST(arith_is_prime_u32, 2, true);
+    TEST(arith_is_prime_u32, 3, true);
+    TEST(arith_is_prime_u32, 4, false);
+    TEST(arith_is_prime_u32, 61, true);
+    TEST(arith_is_prime_u32, 63, false);
+    TEST(arith_is_prime_u32, 3481, false);  // 59^2
+    TEST(arith_is_prime_u32, 561, false);
+    TEST(arith_is_prime_u32, 2047, false);
+    TEST(arith_is_prime_u32, 1373653, false);
+    TEST(arith_is_prime_u32, 25326001, false);
+    TEST(arith_is_prime_u32, 4294967291, true);
+    TEST(arith_is_prime_u32, 4294967279, true);
+    TEST(arith_is_prime_u32, 4294967295, false);
+    TEST(arith_is_prime_u32, 3215031751, false);  // A strong pseudoprime to the bases 2, 3, 5 and 7.
+
+    TEST(arith_is_prime_u64, 0, false);
+    TEST(arith_is_prime_u64, 1, false);
+    TEST(arith_is_prime_u64, 2, true);
+    TEST(arith_is_prime_u64, 4294967291, true);
+    TEST(arith_is_prime_u64, 4294967296, false);
+    TEST(arith_is_prime_u64, 4294967311, true);
+    TEST(arith_is_prime_u64, 2152302898747, false);
+    TEST(arith_is_prime_u64, 3474749660383, false);
+    TEST(arith_is_prime_u64, 341550071728321, false);
+    TEST(arith_is_prime_u64, 3825123056546413051, false);
+    TEST(arith_is_prime_u64, 2305843009213693951, true);       // 2^61 - 1
+    TEST(arith_is_prime_u64, 1000000016000000063, false);      // 1000000007 * 1000000009
+    TEST(arith_is_prime_u64, 18446744030759878681ULL, false);  // 4294967291^2
+    TEST(arith_is_prime_u64, 18446744073709551557ULL, true);
+    TEST(arith_is_prime_u64, ARITH_U64_MAX, false);
+
+
+    for (unsigned i = 0; i < sizeof(strong_pseudoprimes) / sizeof(strong_pseudoprimes[0]); ++i) {
+        if (arith_is_prime_u32(strong_pseudoprimes[i]) || arith_is_prime_u64(strong_pseudoprimes[i])) {
+            fprintf(stderr, "Failed test arith_is_prime_u32(%u) == false\n", strong_pseudoprimes[i]);
+            passed = false;
+        }
+    }
+
+
+    static const arith_u64 factor_tests[] = {
+        0,
+        1,
+        2,
+        3,
+        720720,
+        (arith_u64)1 << 63,
+        614889782588491410,       // The product of the first 15 primes.
+        12157665459056928801ULL,  // 3^40
+        11361656654439817571ULL,  // 131^9
+        1000000016000000063,
+        18446744030759878681ULL,
+        18446744073709551557ULL,
+        ARITH_U64_MAX,
+    };
+    for (unsigned i = 0; i < sizeof(factor_tests) / sizeof(factor_tests[0]); ++i) {
+        arith_u64 primes[15];
+        unsigned exponents[15];
+        const unsigned count = arith_factor_u64(factor_tests[i], primes, exponents);
+
+        if (!is_factorization(factor_tests[i], primes, exponents, count)) {
+            fprintf(stderr, "Failed test arith_factor_u64(%lu)\n", factor_tests[i]);
+            passed = false;
+        }
+    }
+
+
+    // Compare with a sieve of Eratosthenes.
+    static bool composite[SIEVE_LIMIT];
+    memset(composite, 0, sizeof(composite));
+    composite[0] = composite[1] = true;
+    for (arith_u32 p = 2; p * p < SIEVE_LIMIT; ++p) {
+        if (!composite[p]) {
+            for (arith_u32 multiple = p * p; multiple < SIEVE_LIMIT; multiple += p)
+                composite[multiple] = true;
+        }
+    }
+
+    for (arith_u32 n = 0; n < SIEVE_LIMIT; ++n) {
+        if (arith_is_prime_u32(n) == composite[n]) {
+            fprintf(stderr, "Failed test arith_is_prime_u32(%u)\n", n);
+            passed = false;
+        }
+        if (arith_is_prime_u64(n) == composite[n]) {
+            fprintf(stderr, "Failed test arith_is_prime_u64(%u)\n", n);
+            passed = false;
+        }
+    }
+
+
+    // Compare arith_sieve_range() with the sieve on small ranges, and with arith_is_prime_u64() on large ones.
+    static const arith_u64 sieve_ranges[][2] = {
+        {0, SIEVE_LIMIT - 1},
+        {0, 0},
+        {0, 6},
+        {2, 2},
+        {4, 4},
+        {5, 7},
+        {7, 7},
+        {8, 10},
+        {11, 13},
+        {14, 16},
+        {1, 1000},
+        {29, 31},
+        {982981, 983101},  // Around the end of the first segment.
+        {(arith_u64)1 << 32, ((arith_u64)1 << 32) + SIEVE_LARGE_WIDTH},
+        {((arith_u64)1 << 40) - SIEVE_LARGE_WIDTH, ((arith_u64)1 << 40) + SIEVE_LARGE_WIDTH},
+        {(arith_u64)1 << 50, ((arith_u64)1 << 50) + SIEVE_LARGE_WIDTH},
+        {10, 9},
+    };
+    for (unsigned i = 0; i < sizeof(sieve_ranges) / sizeof(sieve_ranges[0]); ++i) {
+        if (!check_sieve_range(sieve_ranges[i][0], sieve_ranges[i][1], composite)) {
+            fprintf(stderr, "Failed test arith_sieve_range(%lu, %lu)\n", sieve_ranges[i][0], sieve_ranges[i][1]);
+            passed = false;
+        }
+    }
+
+    for (int i = 0; i < SIEVE_RANGE_COUNT; ++i) {
+        const arith_u64 lo = next_random() % SIEVE_LIMIT;
+        const arith_u64 hi = lo + next_random() % (SIEVE_LIMIT - lo);
+
+        if (!check_sieve_range(lo, hi, composite)) {
+            fprintf(stderr, "Failed test arith_sieve_range(%lu, %lu)\n", lo, hi);
+            passed = false;
+        }
+    }
+
+
+    static const arith_u64 parallel_sieve_ranges[][2] = {
+        {0, 1 << 24},
+        {1000, 30 * 32768 * 20 + 7},  // Ends in the first byte of a segment.
+        {((arith_u64)1 << 32) - (1 << 24), ((arith_u64)1 << 32) + (1 << 24)},
+        {2, 100},
+        {100, 2},
+    };
+    static const unsigned thread_counts[] = {1, 2, 3, 8};
+    for (unsigned i = 0; i < sizeof(parallel_sieve_ranges) / sizeof(parallel_sieve_ranges[0]); ++i) {
+        for (unsigned j = 0; j < sizeof(thread_counts) / sizeof(thread_counts[0]); ++j) {
+            const arith_u64 lo = parallel_sieve_ranges[i][0];
+            const arith_u64 hi = parallel_sieve_ranges[i][1];
+
+            if (!check_parallel_sieve_range(lo, hi, thread_counts[j])) {
+                fprintf(stderr, "Failed test arith_sieve_range_parallel(%lu, %lu, %u)\n", lo, hi, thread_counts[j]);
+                passed = false;
+            }
+        }
+    }
+
+
+    // Compare arith_prime_count_u64() with known values, and with arith_sieve_count_range() on random bounds.
+    static const arith_u64 prime_counts[][2] = {
+        {0, 0},
+        {1, 0},
+        {2, 1},
+        {10, 4},
+        {100, 25},
+        {1000, 168},
+        {10000, 1229},
+        {100000, 9592},
+        {1000000, 78498},
+        {1000001, 78498},
+        {10000000, 664579},
+        {100000000, 5761455},
+        {1000000000, 50847534},
+        {(arith_u64)1 << 32, 203280221},
+        {10000000000, 455052511},
+        {100000000000, 4118054813},
+        {(arith_u64)1 << 40, 41203088796},
+        {1000000000000, 37607912018},
+    };
+    for (unsigned i = 0; i < sizeof(prime_counts) / sizeof(prime_counts[0]); ++i) {
+        for (unsigned j = 0; j < sizeof(thread_counts) / sizeof(thread_counts[0]); ++j) {
+            arith_u64 count = 0;
+            if (!arith_prime_count_u64(prime_counts[i][0], thread_counts[j], &count) || count != prime_counts[i][1]) {
+                fprintf(stderr, "Failed test arith_prime_count_u64(%lu, %u) == %lu\n", prime_counts[i][0],
+                        thread_counts[j], prime_counts[i][1]);
+                passed = false;
+            }
+        }
+    }
+
+    for (int i = 0; i < PRIME_COUNT_RANDOM_COUNT; ++i) {
+        const arith_u64 x           = next_random() >> (64 - PRIME_COUNT_RANDOM_BITS);
+        const unsigned thread_count = thread_counts[i % (sizeof(thread_counts) / sizeof(thread_counts[0]))];
+        arith_u64 expected          = 0;
+        arith_u64 count             = 0;
+
+        if (!arith_sieve_count_range(0, x, 1, &expected) || !arith_prime_count_u64(x, thread_count, &count)
+            || count != expected) {
+            fprintf(stderr, "Failed test arith_prime_count_u64(%lu, %u) == %lu\n", x, thread_count, expected);
+            passed = false;
+        }
+    }
+
+
+    // Compare random 32-bit values with trial division, and check that products of two 32-bit primes are composite.
+    for (int i = 0; i < RANDOM_COUNT; ++i) {
+        const arith_u32 n = (arith_u32)next_random() | 1;
+        const bool is_prime = is_prime_trial_division(n);
+
+        if (arith_is_prime_u32(n) != is_prime || arith_is_prime_u64(n) != is_prime) {
+            fprintf(stderr, "Failed test arith_is_prime_u32(%u) == %d\n", n, is_prime);
+            passed = false;
+        }
+    }
+
+    for (int i = 0; i < RANDOM_COUNT; ++i) {
+        arith_u32 p = (arith_u32)next_random() | 1;
+        arith_u32 q = (arith_u32)next_random() | 1;
+        while (!arith_is_prime_u32(p))
+            p += 2;
+        while (!arith_is_prime_u32(q))
+            q += 2;
+
+        if (arith_is_prime_u64((arith_u64)p * q)) {
+            fprintf(stderr, "Failed test arith_is_prime_u64(%u * %u) == false\n", p, q);
+            passed = false;
+        }
+    }
+
+
+    // Factor random values, and semiprimes with factors of up to 32 bits.
+    for (int i = 0; i < RANDOM_COUNT; ++i) {
+        const arith_u64 n = next_random();
+        arith_u64 primes[15];
+        unsigned exponents[15];
+        const unsigned count = arith_factor_u64(n, primes, exponents);
+
+        if (!is_factorization(n, primes, exponents, count)) {
+            fprintf(stderr, "Failed test arith_factor_u64(%lu)\n", n);
+            passed = false;
+        }
+    }
+
+    for (int i = 0; i < FACTOR_SEMIPRIME_COUNT; ++i) {
+        const unsigned bits = 8 + (unsigned)(next_random() % 25);
+        arith_u32 p         = (arith_u32)(next_random() >> (64 - bits)) | 1;
+        arith_u32 q         = (arith_u32)(next_random() >> (64 - bits)) | 1;
+        while (!arith_is_prime_u32(p))
+            p += 2;
+        while (!arith_is_prime_u32(q))
+            q += 2;
+
+        const arith_u64 n = (arith_u64)p * q;
+        arith_u64 primes[15];
+        unsigned exponents[15];
+        const unsigned count = arith_factor_u64(n, primes, exponents);
+
+        if (!is_factorization(n, primes, exponents, count)) {
+            fprintf(stderr, "Failed test arith_factor_u64(%u * %u)\n", p, q);
+            passed = false;
+        }
+    }
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/limits.h"
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/root.h"
+
+#include "test_random.h"
+
+
+
+#define RANDOM_TESTS 100000
+
+
+// Returns `min(r^k, 2^64)`.
+static arith_u128 saturated_power(const arith_u64 r, const unsigned k) {
+    const arith_u128 limit = (arith_u128)1 << 64;
+
+    arith_u128 power = 1;
+    for (unsigned i = 0; i < k && power < limit; ++i)
+        power *= r;
+
+    return (power < limit) ? power : limit;
+}
+
+// Checks that `arith_iroot_u64(n, k)` is the largest `r` with `r^k <= n`.
+static bool check_iroot(const arith_u64 n, const unsigned k) {
+    const arith_u64 root = (k == 2) ? arith_isqrt_u64(n) : arith_iroot_u64(n, k);
+    if (saturated_power(root, k) <= n && saturated_power(root + 1, k) > n)
+        return true;
+
+    fprintf(stderr, "Failed test arith_iroot_u64(%lu, %u) == %lu\n", n, k, root);
+
+    return false;
+}
+
+// Returns the largest `k` such that `n` is a `k`-th power, by brute force.
+static unsigned largest_exponent(const arith_u64 n) {
+    if (n < 4)
+        return 1;
+
+    for (unsigned k = 63; k >= 2; --k) {
+        const arith_u64 root = arith_iroot_u64(n, k);
+        if (saturated_power(root, k) == n)
+            return k;
+    }
+
+    return 1;
+}
+
+// Checks arith_perfect_power_u64() for `n`, which is known to have largest exponent `exponent` unless that is `0`.
+static bool check_perfect_power(const arith_u64 n, unsigned exponent) {
+    if (exponent == 0)
+        exponent = largest_exponent(n);
+
+    arith_u64 root;
+    const unsigned result = arith_perfect_power_u64(n, &root);
+    if (result == exponent && saturated_power(root, result) == n && arith_perfect_power_u64(n, NULL) == result)
+        return true;
+
+    fprintf(stderr, "Failed test arith_perfect_power_u64(%lu) == %u, with root %lu\n", n, result, root);
+
+    return false;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    // Around every power of every root, including the largest ones, where rounding to double precision goes wrong.
+    for (unsigned k = 2; k <= 64; ++k) {
+        for (arith_u64 r = 1; saturated_power(r, k) <= ARITH_U64_MAX; r = (r < 100) ? r + 1 : r + r / 7 + 1) {
+            const arith_u64 power = (arith_u64)saturated_power(r, k);
+            passed = check_iroot(power - 1, k) && check_iroot(power, k) && check_iroot(power + 1, k) && passed;
+        }
+        for (arith_u64 r = arith_iroot_u64(ARITH_U64_MAX, k); r > 0 && r + 8 > arith_iroot_u64(ARITH_U64_MAX, k); --r) {
+            const arith_u64 power = (arith_u64)saturated_power(r, k);
+            passed = check_iroot(power - 1, k) && check_iroot(power, k) && check_iroot(power + 1, k) && passed;
+        }
+        passed = check_iroot(0, k) && check_iroot(ARITH_U64_MAX, k) && check_iroot(ARITH_U64_MAX - 1, k) && passed;
+    }
+    passed = check_iroot(ARITH_U64_MAX, 100) && check_iroot(12345, 1) && passed;
+
+    for (int i = 0; i < RANDOM_TESTS; ++i) {
+        const arith_u64 n = next_random() >> (next_random() & 63);
+        passed            = check_iroot(n, 2 + (unsigned)(i % 12)) && passed;
+    }
+
+    // Powers of random roots that are no perfect powers themselves, and random integers.
+    for (arith_u64 n = 0; n < 1000; ++n)
+        passed = check_perfect_power(n, 0) && passed;
+    for (int i = 0; i < RANDOM_TESTS / 10; ++i) {
+        const unsigned k = 2 + (unsigned)(next_random() % 62);
+        const arith_u64 r = 2 + next_random() % (arith_iroot_u64(ARITH_U64_MAX, k) - 1);
+        if (arith_perfect_power_u64(r, NULL) == 1)
+            passed = check_perfect_power((arith_u64)saturated_power(r, k), k) && passed;
+
+        passed = check_perfect_power(next_random() >> (next_random() & 63), 0) && passed;
+    }
+
+    if (!check_perfect_power(1ULL << 63, 63) || !check_perfect_power(1ULL << 60, 60)
+        || !check_perfect_power(12157665459056928801ULL, 40) || !check_perfect_power(18446744030759878681ULL, 2)
+        || !check_perfect_power(18446744073709551557ULL, 1) || !check_perfect_power(ARITH_U64_MAX, 1))
+        passed = false;
+
+
+    if (!passed)
+        return 1;
+
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "arithmos/core/types.h"
+#include "arithmos/numeric/gcd.h"
+#include "arithmos/numeric/sqrt_mod.h"
+
+#include "test_random.h"
+
+
+
+#define RANDOM_TESTS 100000
+
+
+static arith_u64 square_mod(const arith_u64 x, const arith_u64 modulus) {
+    return (arith_u64)((arith_u128)x * x % modulus);
+}
+
+// Returns the smallest square root of `a` modulo `modulus`, or `modulus` if there is none, by brute force.
+static arith_u64 reference_sqrt_mod(const arith_u64 a, const arith_u64 modulus) {
+    for (arith_u64 x = 0; x < modulus; ++x) {
+        if (square_mod(x, modulus) == a % modulus)
+            return x;
+    }
+
+    return modulus;
+}
+
+// Checks the square root of every residue modulo `p^k`, which must be small, against the brute force one.
+static bool check_exhaustive(const arith_u64 p, const unsigned k) {
+    arith_sqrt_prime_u64 prime;
+    if (!arith_sqrt_prime_init_u64(&prime, p, k)) {
+        fprintf(stderr, "Failed test arith_sqrt_prime_init_u64(%lu, %u)\n", p, k);
+        return false;
+    }
+
+    const arith_u64 modulus = prime.power_montgomery.modulus;
+    for (arith_u64 a = 0; a < modulus; ++a) {
+        const arith_u64 expected = reference_sqrt_mod(a, modulus);
+
+        arith_u64 root    = modulus;
+        const bool result = arith_sqrt_prime_mod_u64(&prime, a + modulus, &root);
+        if (result != (expected != modulus) || root != expected) {
+            fprintf(stderr, "Failed test arith_sqrt_prime_mod_u64(%lu) mod %lu^%u == %lu, expected %lu\n", a, p, k,
+                    root, expected);
+            return false;
+        }
+
+        if (k == 1) {
+            root = modulus;
+            if (arith_sqrt_mod_u64(a, p, &root) != result || root != expected) {
+                fprintf(stderr, "Failed test arith_sqrt_mod_u64(%lu, %lu) == %lu\n", a, p, root);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Checks the square root of `a` modulo `p^k` for the prime `p` of `prime`, where `a` is a square if and only if
+// `square` is `true`.
+static bool check_sqrt_mod(const arith_sqrt_prime_u64* prime, const arith_u64 a, const bool square) {
+    const arith_u64 modulus = prime->power_montgomery.modulus;
+
+    arith_u64 root    = 0;
+    const bool result = arith_sqrt_prime_mod_u64(prime, a, &root);
+    if (result == square
+        && (!result || (square_mod(root, modulus) == a % modulus && root <= modulus - root && root < modulus)))
+        return true;
+
+    fprintf(stderr, "Failed test arith_sqrt_prime_mod_u64(%lu) mod %lu^%u == %lu\n", a, prime->montgomery.modulus,
+            prime->exponent, root);
+
+    return false;
+}
+
+
+int main(void) {
+    bool passed = true;
+
+    // Small primes of every two-adicity up to 7, as well as small prime powers.
+    static const arith_u64 small_primes[] = {
+        3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 73, 97, 113, 193, 241, 257, 577, 769, 1153,
+    };
+    for (size_t i = 0; i < sizeof(small_primes) / sizeof(small_primes[0]); ++i)
+        passed &= check_exhaustive(small_primes[i], 1);
+
+    passed &= check_exhaustive(3, 2);
+    passed &= check_exhaustive(3, 5);
+    passed &= check_exhaustive(3, 7);
+    passed &= check_exhaustive(5, 3);
+    passed &= check_exhaustive(7, 3);
+    passed &= check_exhaustive(17, 2);
+    passed &= check_exhaustive(41, 2);
+
+    // Primes `p = 3 (mod 4)`, `5 (mod 8)`, and `1 (mod 2^s)` for two-adicities on both sides of the Cipolla threshold.
+    static const arith_u64 large_primes[] = {
+        0xffffffffffffffc5, 0xfffffffffffffe95, 0xfffffffffffff101, 0xffffffffff790001, 0xffffffffff000001,
+        0xffffffff00000001, 0xffffff0000000001, 0xffdf000000000001, 0xf700000000000001, 4294967291, 65537,
+    };
+    for (size_t i = 0; i < sizeof(large_primes) / sizeof(large_primes[0]); ++i) {
+        const arith_u64 p = large_primes[i];
+
+        arith_sqrt_prime_u64 prime;
+        if (!arith_sqrt_prime_init_u64(&prime, p, 1)) {
+            fprintf(stderr, "Failed test arith_sqrt_prime_init_u64(%lu, 1)\n", p);
+            passed = false;
+            continue;
+        }
+
+        passed &= check_sqrt_mod(&prime, 0, true);
+        passed &= check_sqrt_mod(&prime, p, true);
+        passed &= check_sqrt_mod(&prime, 1, true);
+        passed &= check_sqrt_mod(&prime, p - 1, arith_jacobi_u64(p - 1, p) == 1);
+        for (int j = 0; j < RANDOM_TESTS / 10; ++j) {
+            const arith_u64 a = next_random();
+            passed &= check_sqrt_mod(&prime, a, arith_jacobi_u64(a % p, p) != -1);
+
+            const arith_u64 x = next_random() % p;
+            passed &= check_sqrt_mod(&prime, square_mod(x, p), true);
+        }
+
+        const arith_u64 a = next_random() % p;
+        arith_u64 root    = 0;
+        if (arith_sqrt_mod_u64(a, p, &root) != (arith_jacobi_u64(a, p) != -1)) {
+            fprintf(stderr, "Failed test arith_sqrt_mod_u64(%lu, %lu) == %lu\n", a, p, root);
+            passed = false;
+        }
+    }
+
+    // Large prime powers, including residues divisible by powers of `p`.
+    static const arith_u64 power_primes[] = {3, 3, 5, 65537, 4294967291, 2147483647, 1000003};
+    static const unsigned power_exponents[] = {40, 2, 27, 3, 2, 2, 3};
+    for (size_t i = 0; i < sizeof(power_primes) / sizeof(power_primes[0]); ++i) {
+        const arith_u64 p = power_primes[i];
+
+        arith_sqrt_prime_u64 prime;
+        if (!arith_sqrt_prime_init_u64(&prime, p, power_exponents[i])) {
+            fprintf(stderr, "Failed test arith_sqrt_prime_init_u64(%lu, %u)\n", p, power_exponents[i]);
+            passed = false;
+            continue;
+        }
+
+        const arith_u64 modulus = prime.power_montgomery.modulus;
+        for (int j = 0; j < RANDOM_TESTS / 10; ++j) {
+            arith_u64 a = next_random();
+            if (a % p != 0)
+                passed &= check_sqrt_mod(&prime, a, arith_jacobi_u64(a % p, p) == 1);
+
+            arith_u64 x = next_random() % modulus;
+            for (unsigned e = next_random() % prime.exponent; e > 0; --e)
+                x = (arith_u64)((arith_u128)x * p % modulus);
+            passed &= check_sqrt_mod(&prime, square_mod(x, modulus), true);
+        }
+    }
+
+    // Invalid moduli, overflowing powers, and a composite modulus caught by the search for a non-residue.
+    arith_sqrt_prime_u64 prime;
+    passed &= !arith_sqrt_prime_init_u64(&prime, 0, 1);
+    passed &= !arith_sqrt_prime_init_u64(&prime, 1, 1);
+    passed &= !arith_sqrt_prime_init_u64(&prime, 2, 1);
+    passed &= !arith_sqrt_prime_init_u64(&prime, 3, 0);
+    passed &= !arith_sqrt_prime_init_u64(&prime, 3, 41);
+    passed &= !arith_sqrt_prime_init_u64(&prime, 4294967291, 3);
+    passed &= !arith_sqrt_prime_init_u64(&prime, 9, 1);
+    passed &= arith_sqrt_prime_init_u64(&prime, 3, 40);
+
+    arith_u64 root = 0;
+    passed &= !arith_sqrt_mod_u64(4, 2, &root) && !arith_sqrt_mod_u64(4, 1, &root) && root == 0;
+
+    if (!passed)
+        return 1;
+
+    return 0;
+}
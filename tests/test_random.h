@@ -0,0 +1,25 @@
+#ifndef ARITHMOS_TESTS_TEST_RANDOM_H_
+#define ARITHMOS_TESTS_TEST_RANDOM_H_
+
+
+#include "arithmos/core/types.h"
+
+
+
+// The state of the pseudorandom generator shared by the randomized tests. Every test starts from the same seed, so that
+// failures are reproducible.
+static arith_u64 random_state = 0x9E3779B97F4A7C15;
+
+// Returns the next pseudorandom 64-bit value.
+static arith_u64 next_random(void) {
+    // xorshift64*
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+
+    return random_state * 0x2545F4914F6CDD1D;
+}
+
+
+
+#endif  // #ifndef ARITHMOS_TESTS_TEST_RANDOM_H_